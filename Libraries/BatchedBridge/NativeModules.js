@@ -29,6 +29,7 @@ export type MethodType = 'async' | 'promise' | 'sync';
 function genModule(
   config: ?ModuleConfig,
   moduleID: number,
+  hasLazyConstants?: boolean,
 ): ?{
   name: string,
   module?: Object,
@@ -65,7 +66,34 @@ function genModule(
       module[methodName] = genMethod(moduleID, methodID, methodType);
     });
 
-  Object.assign(module, constants);
+  if (hasLazyConstants === true && constants) {
+    // `constants` is a host object which converts each key on first read.
+    // Define accessors so untouched constants never cross the bridge, and
+    // replace each one with a plain, writable value once it has been read
+    // or assigned, as if it had been copied with Object.assign.
+    Object.keys(constants).forEach(key => {
+      const defineValue = value => {
+        Object.defineProperty(module, key, {
+          configurable: true,
+          enumerable: true,
+          writable: true,
+          value,
+        });
+      };
+      Object.defineProperty(module, key, {
+        configurable: true,
+        enumerable: true,
+        get: () => {
+          const value = constants[key];
+          defineValue(value);
+          return value;
+        },
+        set: defineValue,
+      });
+    });
+  } else {
+    Object.assign(module, constants);
+  }
 
   if (module.getConstants == null) {
     module.getConstants = () => constants || Object.freeze({});
@@ -223,4 +223,36 @@ describe('MessageQueue', function() {
       expect(result).toBe('secondSucc');
     });
   });
+
+  describe('lazy constants', () => {
+    const genLazyModule = constants =>
+      global.__fbGenNativeModule(['LazyModule', constants, []], 7, true)
+        .module;
+
+    it('reads each constant once, on first access', () => {
+      const constants = {};
+      const getA = jest.fn(() => 1);
+      Object.defineProperty(constants, 'A', {enumerable: true, get: getA});
+      constants.B = null;
+
+      const module = genLazyModule(constants);
+      expect(getA).not.toBeCalled();
+      expect(module.A).toBe(1);
+      expect(module.A).toBe(1);
+      expect(getA).toBeCalledTimes(1);
+      expect(module.B).toBe(null);
+      expect(Object.keys(module)).toEqual(
+        expect.arrayContaining(['A', 'B', 'getConstants']),
+      );
+    });
+
+    it('lets constants be overwritten like eager ones', () => {
+      const module = genLazyModule({A: 1, B: 2});
+      module.A = 'replaced';
+      expect(module.A).toBe('replaced');
+      expect(module.B).toBe(2);
+      module.B = 'replaced';
+      expect(module.B).toBe('replaced');
+    });
+  });
 });
@@ -147,6 +147,8 @@ static void registerPerformanceLoggerHooks(RCTPerformanceLogger *performanceLogg
         notifyAboutModuleSetup(weakPerformanceLogger, tag);
         break;
       case ReactMarker::CREATE_REACT_CONTEXT_STOP:
+      case ReactMarker::NATIVE_MODULE_CONSTANTS_START:
+      case ReactMarker::NATIVE_MODULE_CONSTANTS_STOP:
       case ReactMarker::JS_BUNDLE_STRING_CONVERT_START:
       case ReactMarker::JS_BUNDLE_STRING_CONVERT_STOP:
       case ReactMarker::REGISTER_JS_SEGMENT_START:
@@ -593,6 +595,7 @@ struct RCTInstanceCallback : public InstanceCallback {
 #endif
 
     [self _initializeBridgeLocked:executorFactory];
+    [self _setModuleConfigCachePath];
 
 #if RCT_PROFILE
     if (RCTProfileIsProfiling()) {
@@ -617,6 +620,26 @@ struct RCTInstanceCallback : public InstanceCallback {
   _moduleRegistryCreated = YES;
 }
 
+- (void)_setModuleConfigCachePath
+{
+  NSString *cachesDirectory =
+      NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES).firstObject;
+  if (!cachesDirectory) {
+    return;
+  }
+
+  // The snapshot is only reused by the same build of the app binary.
+  NSBundle *mainBundle = [NSBundle mainBundle];
+  NSDate *executableDate =
+      [[NSFileManager defaultManager] attributesOfItemAtPath:mainBundle.executablePath error:nil].fileModificationDate;
+  NSString *buildId = [NSString stringWithFormat:@"%@/%@/%.0f",
+                                                 mainBundle.infoDictionary[@"CFBundleShortVersionString"],
+                                                 mainBundle.infoDictionary[@"CFBundleVersion"],
+                                                 executableDate.timeIntervalSince1970];
+  NSString *path = [cachesDirectory stringByAppendingPathComponent:@"RCTModuleConfigCache"];
+  _reactInstance->setModuleConfigCachePath(path.UTF8String, buildId.UTF8String);
+}
+
 - (void)updateModuleWithInstance:(id<RCTBridgeModule>)instance
 {
   NSString *const moduleName = RCTBridgeModuleNameForClass([instance class]);
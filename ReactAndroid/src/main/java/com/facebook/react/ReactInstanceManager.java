@@ -35,6 +35,8 @@ import static com.facebook.systrace.Systrace.TRACE_TAG_REACT_JS_VM_CALLS;
 import android.app.Activity;
 import android.content.Context;
 import android.content.Intent;
+import android.content.pm.PackageInfo;
+import android.content.pm.PackageManager;
 import android.content.res.Configuration;
 import android.net.Uri;
 import android.nfc.NfcAdapter;
@@ -102,6 +104,7 @@ import com.facebook.react.views.imagehelper.ResourceDrawableIdHelper;
 import com.facebook.soloader.SoLoader;
 import com.facebook.systrace.Systrace;
 import com.facebook.systrace.SystraceMessage;
+import java.io.File;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
@@ -1235,13 +1238,14 @@ public class ReactInstanceManager {
     ReactMarker.logMarker(CREATE_CATALYST_INSTANCE_START);
     // CREATE_CATALYST_INSTANCE_END is in JSCExecutor.cpp
     Systrace.beginSection(TRACE_TAG_REACT_JAVA_BRIDGE, "createCatalystInstance");
-    final CatalystInstance catalystInstance;
+    final CatalystInstanceImpl catalystInstance;
     try {
       catalystInstance = catalystInstanceBuilder.build();
     } finally {
       Systrace.endSection(TRACE_TAG_REACT_JAVA_BRIDGE);
       ReactMarker.logMarker(CREATE_CATALYST_INSTANCE_END);
     }
+    setModuleConfigCachePath(catalystInstance);
 
     reactContext.initializeWithInstance(catalystInstance);
 
@@ -1296,6 +1300,22 @@ public class ReactInstanceManager {
     return reactContext;
   }
 
+  private void setModuleConfigCachePath(CatalystInstanceImpl catalystInstance) {
+    // The snapshot is only reused by the same install of the app.
+    PackageInfo packageInfo;
+    try {
+      packageInfo =
+          mApplicationContext
+              .getPackageManager()
+              .getPackageInfo(mApplicationContext.getPackageName(), 0);
+    } catch (PackageManager.NameNotFoundException e) {
+      return;
+    }
+    String buildId = packageInfo.versionName + "/" + packageInfo.lastUpdateTime;
+    File path = new File(mApplicationContext.getCacheDir(), "RNModuleConfigCache");
+    catalystInstance.setModuleConfigCachePath(path.getAbsolutePath(), buildId);
+  }
+
   private NativeModuleRegistry processPackages(
       ReactApplicationContext reactContext,
       List<ReactPackage> packages,
@@ -227,6 +227,15 @@ public class CatalystInstanceImpl implements CatalystInstance {
     jniRegisterSegment(segmentId, path);
   }
 
+  /**
+   * Restores native module configs from a snapshot at {@code path} written by the same {@code
+   * buildId}, and saves a fresh snapshot there once the bundle has run. Call before {@link
+   * #runJSBundle()}.
+   */
+  public void setModuleConfigCachePath(String path, String buildId) {
+    jniSetModuleConfigCachePath(path, buildId);
+  }
+
   @Override
   public void loadScriptFromAssets(
       AssetManager assetManager, String assetURL, boolean loadSynchronously) {
@@ -244,6 +253,8 @@ public class CatalystInstanceImpl implements CatalystInstance {
 
   private native void jniRegisterSegment(int segmentId, String path);
 
+  private native void jniSetModuleConfigCachePath(String path, String buildId);
+
   private native void jniLoadScriptFromAssets(
       AssetManager assetManager, String assetURL, boolean loadSynchronously);
 
@@ -34,6 +34,8 @@ public enum ReactMarkerConstants {
   CREATE_UI_MANAGER_MODULE_CONSTANTS_END,
   NATIVE_MODULE_SETUP_START,
   NATIVE_MODULE_SETUP_END,
+  NATIVE_MODULE_CONSTANTS_START,
+  NATIVE_MODULE_CONSTANTS_END,
   CREATE_MODULE_START,
   CREATE_MODULE_END,
   PROCESS_CORE_REACT_PACKAGE_START,
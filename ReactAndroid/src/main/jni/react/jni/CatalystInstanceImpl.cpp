@@ -109,6 +109,9 @@ void CatalystInstanceImpl::registerNatives() {
           "jniSetSourceURL", CatalystInstanceImpl::jniSetSourceURL),
       makeNativeMethod(
           "jniRegisterSegment", CatalystInstanceImpl::jniRegisterSegment),
+      makeNativeMethod(
+          "jniSetModuleConfigCachePath",
+          CatalystInstanceImpl::jniSetModuleConfigCachePath),
       makeNativeMethod(
           "jniLoadScriptFromAssets",
           CatalystInstanceImpl::jniLoadScriptFromAssets),
@@ -204,6 +207,12 @@ void CatalystInstanceImpl::jniRegisterSegment(
   instance_->registerBundle((uint32_t)segmentId, path);
 }
 
+void CatalystInstanceImpl::jniSetModuleConfigCachePath(
+    const std::string &path,
+    const std::string &buildId) {
+  instance_->setModuleConfigCachePath(path, buildId);
+}
+
 void CatalystInstanceImpl::jniLoadScriptFromAssets(
     jni::alias_ref<JAssetManager::javaobject> assetManager,
     const std::string &assetURL,
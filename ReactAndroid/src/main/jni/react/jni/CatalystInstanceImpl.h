@@ -77,6 +77,14 @@ class CatalystInstanceImpl : public jni::HybridClass<CatalystInstanceImpl> {
    */
   void jniRegisterSegment(int segmentId, const std::string &path);
 
+  /**
+   * Restores and saves native module configs at the given path, see
+   * Instance::setModuleConfigCachePath().
+   */
+  void jniSetModuleConfigCachePath(
+      const std::string &path,
+      const std::string &buildId);
+
   void jniLoadScriptFromAssets(
       jni::alias_ref<JAssetManager::javaobject> assetManager,
       const std::string &assetURL,
@@ -59,6 +59,12 @@ void JReactMarker::logPerfMarker(
     case ReactMarker::JS_BUNDLE_STRING_CONVERT_STOP:
       JReactMarker::logMarker("loadApplicationScript_endStringConvert");
       break;
+    case ReactMarker::NATIVE_MODULE_CONSTANTS_START:
+      JReactMarker::logMarker("NATIVE_MODULE_CONSTANTS_START", tag);
+      break;
+    case ReactMarker::NATIVE_MODULE_CONSTANTS_STOP:
+      JReactMarker::logMarker("NATIVE_MODULE_CONSTANTS_END", tag);
+      break;
     case ReactMarker::NATIVE_MODULE_SETUP_START:
       JReactMarker::logMarker("NATIVE_MODULE_SETUP_START", tag);
       break;
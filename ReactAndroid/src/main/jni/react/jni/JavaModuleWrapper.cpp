@@ -51,32 +51,8 @@ std::string JavaNativeModule::getName() {
 }
 
 std::vector<MethodDescriptor> JavaNativeModule::getMethods() {
-  std::vector<MethodDescriptor> ret;
-  syncMethods_.clear();
-  auto descs = wrapper_->getMethodDescriptors();
-  for (const auto &desc : *descs) {
-    auto methodName = desc->getName();
-    auto methodType = desc->getType();
-
-    if (methodType == "sync") {
-      // allow for the sync methods vector to have empty values, resize on
-      // demand
-      size_t methodIndex = ret.size();
-      if (methodIndex >= syncMethods_.size()) {
-        syncMethods_.resize(methodIndex + 1);
-      }
-      syncMethods_.insert(
-          syncMethods_.begin() + methodIndex,
-          MethodInvoker(
-              desc->getMethod(),
-              desc->getSignature(),
-              getName() + "." + methodName,
-              true));
-    }
-
-    ret.emplace_back(std::move(methodName), std::move(methodType));
-  }
-  return ret;
+  loadMethods();
+  return methods_;
 }
 
 folly::dynamic JavaNativeModule::getConstants() {
@@ -96,6 +72,8 @@ void JavaNativeModule::invoke(
     int callId) {
   messageQueueThread_->runOnQueue(
       [this, reactMethodId, params = std::move(params), callId] {
+        // JavaModuleWrapper drops calls until it has found its methods.
+        loadMethods();
         static auto invokeMethod =
             wrapper_->getClass()
                 ->getMethod<void(jint, ReadableNativeArray::javaobject)>(
@@ -116,6 +94,7 @@ MethodCallResult JavaNativeModule::callSerializableNativeHook(
     unsigned int reactMethodId,
     folly::dynamic &&params) {
   // TODO: evaluate whether calling through invoke is potentially faster
+  loadMethods();
   if (reactMethodId >= syncMethods_.size()) {
     throw std::invalid_argument(folly::to<std::string>(
         "methodId ",
@@ -131,6 +110,37 @@ MethodCallResult JavaNativeModule::callSerializableNativeHook(
   return method->invoke(instance_, wrapper_->getModule(), params);
 }
 
+void JavaNativeModule::loadMethods() {
+  // ModuleRegistry skips getMethods() when it has a cached config for this
+  // module, so the first call may come from the module's own thread (invoke)
+  // rather than the JS thread.
+  std::call_once(methodsLoadedFlag_, [this] {
+    auto descs = wrapper_->getMethodDescriptors();
+    for (const auto &desc : *descs) {
+      auto methodName = desc->getName();
+      auto methodType = desc->getType();
+
+      if (methodType == "sync") {
+        // allow for the sync methods vector to have empty values, resize on
+        // demand
+        size_t methodIndex = methods_.size();
+        if (methodIndex >= syncMethods_.size()) {
+          syncMethods_.resize(methodIndex + 1);
+        }
+        syncMethods_.insert(
+            syncMethods_.begin() + methodIndex,
+            MethodInvoker(
+                desc->getMethod(),
+                desc->getSignature(),
+                getName() + "." + methodName,
+                true));
+      }
+
+      methods_.emplace_back(std::move(methodName), std::move(methodType));
+    }
+  });
+}
+
 NewJavaNativeModule::NewJavaNativeModule(
     std::weak_ptr<Instance> instance,
     jni::alias_ref<JavaModuleWrapper::javaobject> wrapper,
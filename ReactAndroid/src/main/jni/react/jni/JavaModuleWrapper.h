@@ -11,6 +11,8 @@
 #include <fbjni/fbjni.h>
 #include <folly/Optional.h>
 
+#include <mutex>
+
 #include "MethodInvoker.h"
 
 namespace facebook {
@@ -78,9 +80,13 @@ class JavaNativeModule : public NativeModule {
       folly::dynamic &&params) override;
 
  private:
+  void loadMethods();
+
   std::weak_ptr<Instance> instance_;
   jni::global_ref<JavaModuleWrapper::javaobject> wrapper_;
   std::shared_ptr<MessageQueueThread> messageQueueThread_;
+  std::once_flag methodsLoadedFlag_;
+  std::vector<MethodDescriptor> methods_;
   std::vector<folly::Optional<MethodInvoker>> syncMethods_;
 };
 
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "BatchedCallInvoker.h"
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+size_t roundUpToPowerOfTwo(size_t value) {
+  size_t result = 2;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+} // namespace
+
+constexpr size_t InlineTask::kInlineSize;
+constexpr size_t BatchedCallInvoker::kDefaultCapacity;
+constexpr size_t BatchedCallInvoker::kDefaultMaxBatchSize;
+
+BatchedCallInvoker::BatchedCallInvoker(
+    std::shared_ptr<CallInvoker> target,
+    size_t capacity,
+    size_t maxBatchSize)
+    : target_(std::move(target)),
+      maxBatchSize_(maxBatchSize > 0 ? maxBatchSize : 1),
+      mask_(roundUpToPowerOfTwo(capacity) - 1),
+      cells_(new Cell[mask_ + 1]) {
+  for (size_t i = 0; i <= mask_; i++) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+BatchedCallInvoker::~BatchedCallInvoker() {}
+
+void BatchedCallInvoker::invokeAsync(std::function<void()> &&func) {
+  invokeAsyncInline(std::move(func));
+}
+
+void BatchedCallInvoker::invokeSync(std::function<void()> &&func) {
+  target_->invokeSync(std::move(func));
+}
+
+BatchedCallInvoker::Stats BatchedCallInvoker::getStats() const {
+  return Stats{batches_.load(std::memory_order_relaxed),
+               invocations_.load(std::memory_order_relaxed),
+               overflows_.load(std::memory_order_relaxed)};
+}
+
+bool BatchedCallInvoker::tryPop(InlineTask &task) {
+  Cell &cell = cells_[popPosition_ & mask_];
+  if (cell.sequence.load(std::memory_order_acquire) != popPosition_ + 1) {
+    return false;
+  }
+  task = std::move(cell.task);
+  cell.sequence.store(popPosition_ + mask_ + 1, std::memory_order_release);
+  popPosition_++;
+  return true;
+}
+
+bool BatchedCallInvoker::hasPendingWork() const {
+  if (overflowIndex_ < overflowBatch_.size()) {
+    return true;
+  }
+  const Cell &cell = cells_[popPosition_ & mask_];
+  return cell.sequence.load(std::memory_order_acquire) == popPosition_ + 1 ||
+      overflowing_.load(std::memory_order_acquire);
+}
+
+void BatchedCallInvoker::scheduleDrain() {
+  // Pairs with the fence in finishDrain: either the drain sees the task that
+  // was just pushed, or this sees that no drain is scheduled.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (drainScheduled_.load(std::memory_order_relaxed) ||
+      drainScheduled_.exchange(true)) {
+    return;
+  }
+  // The target may hold on to the drain for a while, e.g. the bridge's JS
+  // CallInvoker buffers work until the bridge is ready, and this owns the
+  // target, so a strong reference here would form a cycle.
+  std::weak_ptr<BatchedCallInvoker> weakSelf = shared_from_this();
+  target_->invokeAsync([weakSelf]() {
+    if (auto self = weakSelf.lock()) {
+      self->drain();
+    }
+  });
+}
+
+void BatchedCallInvoker::drain() {
+  batches_.fetch_add(1, std::memory_order_relaxed);
+  size_t count = 0;
+  InlineTask task;
+  try {
+    while (count < maxBatchSize_) {
+      // Overflow batches are taken once the ring is empty, so anything left
+      // of them is older than what is in the ring now.
+      if (overflowIndex_ < overflowBatch_.size()) {
+        task = std::move(overflowBatch_[overflowIndex_++]);
+      } else if (!tryPop(task)) {
+        if (!overflowing_.load(std::memory_order_acquire)) {
+          break;
+        }
+        overflowBatch_.clear();
+        overflowIndex_ = 0;
+        std::lock_guard<std::mutex> lock(overflowMutex_);
+        overflowBatch_.swap(overflow_);
+        overflowing_.store(false, std::memory_order_release);
+        continue;
+      }
+      count++;
+      task();
+      task.reset();
+    }
+  } catch (...) {
+    invocations_.fetch_add(count, std::memory_order_relaxed);
+    finishDrain();
+    throw;
+  }
+  invocations_.fetch_add(count, std::memory_order_relaxed);
+  finishDrain();
+}
+
+void BatchedCallInvoker::finishDrain() {
+  drainScheduled_.store(false);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (hasPendingWork()) {
+    scheduleDrain();
+  }
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <ReactCommon/CallInvoker.h>
+
+namespace facebook {
+namespace react {
+
+/**
+ * A move-only `void()` callable which stores closures of up to kInlineSize
+ * bytes in place. Larger closures are moved to the heap.
+ */
+class InlineTask {
+ public:
+  static constexpr size_t kInlineSize = 48;
+
+  InlineTask() = default;
+  InlineTask(const InlineTask &) = delete;
+  InlineTask &operator=(const InlineTask &) = delete;
+
+  InlineTask(InlineTask &&other) noexcept {
+    moveFrom(other);
+  }
+
+  InlineTask &operator=(InlineTask &&other) noexcept {
+    if (this != &other) {
+      reset();
+      moveFrom(other);
+    }
+    return *this;
+  }
+
+  ~InlineTask() {
+    reset();
+  }
+
+  template <typename F>
+  void emplace(F &&func) {
+    using Fn = typename std::decay<F>::type;
+    reset();
+    emplace<Fn>(
+        std::forward<F>(func),
+        std::integral_constant<bool, fitsInline<Fn>()>());
+  }
+
+  explicit operator bool() const {
+    return ops_ != nullptr;
+  }
+
+  void operator()() {
+    ops_->invoke(&storage_);
+  }
+
+  void reset() {
+    if (ops_ != nullptr) {
+      ops_->destroy(&storage_);
+      ops_ = nullptr;
+    }
+  }
+
+ private:
+  using Storage = typename std::
+      aligned_storage<kInlineSize, alignof(std::max_align_t)>::type;
+
+  struct Ops {
+    void (*invoke)(void *storage);
+    // Move-constructs into `to` and destroys `from`.
+    void (*relocate)(void *from, void *to);
+    void (*destroy)(void *storage);
+  };
+
+  template <typename Fn>
+  static constexpr bool fitsInline() {
+    return sizeof(Fn) <= kInlineSize &&
+        alignof(Fn) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible<Fn>::value;
+  }
+
+  template <typename Fn>
+  struct InlineOps {
+    static void invoke(void *storage) {
+      (*static_cast<Fn *>(storage))();
+    }
+    static void relocate(void *from, void *to) {
+      new (to) Fn(std::move(*static_cast<Fn *>(from)));
+      static_cast<Fn *>(from)->~Fn();
+    }
+    static void destroy(void *storage) {
+      static_cast<Fn *>(storage)->~Fn();
+    }
+    static constexpr Ops ops{invoke, relocate, destroy};
+  };
+
+  template <typename Fn>
+  struct HeapOps {
+    static void invoke(void *storage) {
+      (**static_cast<Fn **>(storage))();
+    }
+    static void relocate(void *from, void *to) {
+      new (to) Fn *(*static_cast<Fn **>(from));
+    }
+    static void destroy(void *storage) {
+      delete *static_cast<Fn **>(storage);
+    }
+    static constexpr Ops ops{invoke, relocate, destroy};
+  };
+
+  template <typename Fn, typename F>
+  void emplace(F &&func, std::true_type /* fitsInline */) {
+    new (&storage_) Fn(std::forward<F>(func));
+    ops_ = &InlineOps<Fn>::ops;
+  }
+
+  template <typename Fn, typename F>
+  void emplace(F &&func, std::false_type /* fitsInline */) {
+    new (&storage_) Fn *(new Fn(std::forward<F>(func)));
+    ops_ = &HeapOps<Fn>::ops;
+  }
+
+  void moveFrom(InlineTask &other) noexcept {
+    if (other.ops_ != nullptr) {
+      other.ops_->relocate(&other.storage_, &storage_);
+      ops_ = other.ops_;
+      other.ops_ = nullptr;
+    }
+  }
+
+  Storage storage_;
+  const Ops *ops_{nullptr};
+};
+
+template <typename Fn>
+constexpr InlineTask::Ops InlineTask::InlineOps<Fn>::ops;
+
+template <typename Fn>
+constexpr InlineTask::Ops InlineTask::HeapOps<Fn>::ops;
+
+/**
+ * A CallInvoker which coalesces async work into batches before handing it to
+ * the target invoker, typically the bridge's JS CallInvoker.
+ *
+ * Producers push closures into a bounded lock-free ring without taking a
+ * lock or, for closures that fit in an InlineTask, allocating. Only the first
+ * push after a drain schedules work on the target, so a burst of calls from
+ * native threads costs one wakeup of the target thread. Each drain runs at
+ * most maxBatchSize closures and reschedules itself if more are queued, which
+ * gives other work on the target thread a chance to run in between.
+ *
+ * Closures from the same producer thread run in the order they were pushed.
+ * If the ring is full, calls spill into a locked overflow list until the
+ * consumer catches up.
+ *
+ * Must be owned by a std::shared_ptr. A scheduled drain only holds a weak
+ * reference, so work still queued when the invoker is destroyed is dropped.
+ */
+class BatchedCallInvoker
+    : public CallInvoker,
+      public std::enable_shared_from_this<BatchedCallInvoker> {
+ public:
+  static constexpr size_t kDefaultCapacity = 1024;
+  static constexpr size_t kDefaultMaxBatchSize = 1024;
+
+  struct Stats {
+    // Number of drains run on the target, i.e. target thread wakeups.
+    size_t batches;
+    size_t invocations;
+    // Number of calls which found the ring full.
+    size_t overflows;
+  };
+
+  /**
+   * capacity is rounded up to a power of two.
+   */
+  explicit BatchedCallInvoker(
+      std::shared_ptr<CallInvoker> target,
+      size_t capacity = kDefaultCapacity,
+      size_t maxBatchSize = kDefaultMaxBatchSize);
+  ~BatchedCallInvoker() override;
+
+  void invokeAsync(std::function<void()> &&func) override;
+
+  /**
+   * Forwards to the target invoker. Work queued with invokeAsync is not
+   * drained first.
+   */
+  void invokeSync(std::function<void()> &&func) override;
+
+  /**
+   * Same as invokeAsync, but stores the closure directly instead of going
+   * through std::function, which saves an allocation for captures that are
+   * too large for std::function's own small buffer.
+   */
+  template <typename F>
+  void invokeAsyncInline(F &&func) {
+    // tryPush only consumes func if it succeeds.
+    if (overflowing_.load(std::memory_order_acquire) ||
+        !tryPush(std::forward<F>(func))) {
+      pushOverflow(std::forward<F>(func));
+    }
+    scheduleDrain();
+  }
+
+  Stats getStats() const;
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    InlineTask task;
+  };
+
+  // Vyukov's bounded queue: a cell is free for position p when its sequence
+  // is p and holds a task for p when its sequence is p + 1.
+  template <typename F>
+  bool tryPush(F &&func) {
+    size_t position = pushPosition_.load(std::memory_order_relaxed);
+    while (true) {
+      Cell &cell = cells_[position & mask_];
+      size_t sequence = cell.sequence.load(std::memory_order_acquire);
+      auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+      if (difference == 0) {
+        if (pushPosition_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          cell.task.emplace(std::forward<F>(func));
+          cell.sequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = pushPosition_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  template <typename F>
+  void pushOverflow(F &&func) {
+    std::lock_guard<std::mutex> lock(overflowMutex_);
+    overflow_.emplace_back();
+    overflow_.back().emplace(std::forward<F>(func));
+    overflowing_.store(true, std::memory_order_release);
+    overflows_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  bool tryPop(InlineTask &task);
+  bool hasPendingWork() const;
+  void scheduleDrain();
+  void drain();
+  void finishDrain();
+
+  std::shared_ptr<CallInvoker> target_;
+  const size_t maxBatchSize_;
+  const size_t mask_;
+  std::unique_ptr<Cell[]> cells_;
+
+  alignas(64) std::atomic<size_t> pushPosition_{0};
+  // popPosition_ and overflowBatch_ are only touched by the drain, which
+  // never runs concurrently with itself.
+  alignas(64) size_t popPosition_{0};
+  std::atomic<bool> drainScheduled_{false};
+
+  std::mutex overflowMutex_;
+  std::vector<InlineTask> overflow_;
+  std::atomic<bool> overflowing_{false};
+  // Overflow taken by the drain and not run yet.
+  std::vector<InlineTask> overflowBatch_;
+  size_t overflowIndex_{0};
+
+  std::atomic<size_t> batches_{0};
+  std::atomic<size_t> invocations_{0};
+  std::atomic<size_t> overflows_{0};
+};
+
+} // namespace react
+} // namespace facebook
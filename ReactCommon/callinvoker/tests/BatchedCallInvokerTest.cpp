@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <ReactCommon/BatchedCallInvoker.h>
+
+using namespace facebook::react;
+
+namespace {
+
+// Queues work until the test runs it, standing in for the JS thread.
+class ManualCallInvoker : public CallInvoker {
+ public:
+  void invokeAsync(std::function<void()> &&func) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push_back(std::move(func));
+    scheduled++;
+    condition_.notify_one();
+  }
+
+  void invokeSync(std::function<void()> &&func) override {
+    func();
+  }
+
+  // Runs the oldest queued work item. Returns false if there was none.
+  bool runOne() {
+    std::function<void()> func;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (queue_.empty()) {
+        return false;
+      }
+      func = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    func();
+    return true;
+  }
+
+  void runAll() {
+    while (runOne()) {
+    }
+  }
+
+  bool waitAndRunOne() {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait_for(lock, std::chrono::milliseconds(10), [this] {
+        return !queue_.empty();
+      });
+    }
+    return runOne();
+  }
+
+  std::atomic<int> scheduled{0};
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::function<void()>> queue_;
+};
+
+} // namespace
+
+TEST(BatchedCallInvokerTest, burstCostsOneWakeup) {
+  auto target = std::make_shared<ManualCallInvoker>();
+  auto invoker = std::make_shared<BatchedCallInvoker>(target);
+
+  std::vector<int> order;
+  for (int i = 0; i < 1000; i++) {
+    invoker->invokeAsync([&order, i] { order.push_back(i); });
+  }
+  EXPECT_EQ(target->scheduled, 1);
+  EXPECT_TRUE(order.empty());
+
+  target->runAll();
+  ASSERT_EQ(order.size(), 1000);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(order[i], i);
+  }
+  EXPECT_EQ(target->scheduled, 1);
+  EXPECT_EQ(invoker->getStats().batches, 1);
+  EXPECT_EQ(invoker->getStats().invocations, 1000);
+
+  invoker->invokeAsync([&order] { order.push_back(-1); });
+  EXPECT_EQ(target->scheduled, 2);
+}
+
+TEST(BatchedCallInvokerTest, maxBatchSizeReschedules) {
+  auto target = std::make_shared<ManualCallInvoker>();
+  auto invoker = std::make_shared<BatchedCallInvoker>(target, 64, 10);
+
+  int count = 0;
+  for (int i = 0; i < 25; i++) {
+    invoker->invokeAsync([&count] { count++; });
+  }
+
+  ASSERT_TRUE(target->runOne());
+  EXPECT_EQ(count, 10);
+  EXPECT_EQ(target->scheduled, 2);
+
+  target->runAll();
+  EXPECT_EQ(count, 25);
+  EXPECT_EQ(invoker->getStats().batches, 3);
+}
+
+TEST(BatchedCallInvokerTest, overflowKeepsOrder) {
+  auto target = std::make_shared<ManualCallInvoker>();
+  auto invoker = std::make_shared<BatchedCallInvoker>(target, 4, 6);
+
+  std::vector<int> order;
+  for (int i = 0; i < 10; i++) {
+    invoker->invokeAsync([&order, i] { order.push_back(i); });
+  }
+  EXPECT_EQ(invoker->getStats().overflows, 6);
+
+  // Runs 4 from the ring and 2 from the overflow, then pushes more while the
+  // rest of the overflow is still pending.
+  ASSERT_TRUE(target->runOne());
+  EXPECT_EQ(order.size(), 6);
+  for (int i = 10; i < 13; i++) {
+    invoker->invokeAsync([&order, i] { order.push_back(i); });
+  }
+
+  target->runAll();
+  ASSERT_EQ(order.size(), 13);
+  for (int i = 0; i < 13; i++) {
+    EXPECT_EQ(order[i], i);
+  }
+}
+
+TEST(BatchedCallInvokerTest, largeClosuresAreHeapAllocated) {
+  auto target = std::make_shared<ManualCallInvoker>();
+  auto invoker = std::make_shared<BatchedCallInvoker>(target);
+
+  std::array<int, 64> values;
+  values.fill(7);
+  auto shared = std::make_shared<int>(0);
+  int sum = 0;
+  invoker->invokeAsyncInline([&sum, values, shared] {
+    for (int value : values) {
+      sum += value;
+    }
+  });
+  EXPECT_EQ(shared.use_count(), 2);
+
+  target->runAll();
+  EXPECT_EQ(sum, 7 * 64);
+  // The closure is destroyed once it has run.
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(BatchedCallInvokerTest, exceptionKeepsRemainingWork) {
+  auto target = std::make_shared<ManualCallInvoker>();
+  auto invoker = std::make_shared<BatchedCallInvoker>(target);
+
+  int count = 0;
+  invoker->invokeAsync([&count] { count++; });
+  invoker->invokeAsync([] { throw std::runtime_error("failed"); });
+  invoker->invokeAsync([&count] { count++; });
+
+  EXPECT_THROW(target->runOne(), std::runtime_error);
+  EXPECT_EQ(count, 1);
+  target->runAll();
+  EXPECT_EQ(count, 2);
+}
+
+TEST(BatchedCallInvokerTest, scheduledDrainDoesNotKeepInvokerAlive) {
+  auto target = std::make_shared<ManualCallInvoker>();
+  auto invoker = std::make_shared<BatchedCallInvoker>(target);
+  std::weak_ptr<BatchedCallInvoker> weakInvoker = invoker;
+
+  // The target holds the drain, as the bridge's JS CallInvoker does before
+  // the bridge is set, while the invoker owns the target.
+  auto work = std::make_shared<int>(0);
+  invoker->invokeAsync([work] { (*work)++; });
+  invoker.reset();
+  EXPECT_TRUE(weakInvoker.expired());
+  EXPECT_EQ(work.use_count(), 1);
+
+  // The drain is a no-op once the invoker is gone.
+  target->runAll();
+  EXPECT_EQ(*work, 0);
+}
+
+TEST(BatchedCallInvokerTest, concurrentProducersKeepPerThreadOrder) {
+  constexpr int kThreads = 4;
+  constexpr int kCallsPerThread = 20000;
+
+  auto target = std::make_shared<ManualCallInvoker>();
+  // A small ring makes producers hit the overflow path as well.
+  auto invoker = std::make_shared<BatchedCallInvoker>(target, 64, 100);
+
+  std::array<int, kThreads> lastSeen;
+  lastSeen.fill(-1);
+  std::atomic<int> outOfOrder{0};
+  std::atomic<int> total{0};
+
+  std::vector<std::thread> producers;
+  for (int t = 0; t < kThreads; t++) {
+    producers.emplace_back([&, t] {
+      for (int i = 0; i < kCallsPerThread; i++) {
+        invoker->invokeAsync([&, t, i] {
+          if (lastSeen[t] != i - 1) {
+            outOfOrder++;
+          }
+          lastSeen[t] = i;
+          total++;
+        });
+      }
+    });
+  }
+
+  while (total < kThreads * kCallsPerThread) {
+    target->waitAndRunOne();
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  target->runAll();
+
+  EXPECT_EQ(total, kThreads * kCallsPerThread);
+  EXPECT_EQ(outOfOrder, 0);
+  EXPECT_EQ(invoker->getStats().invocations, kThreads * kCallsPerThread);
+}
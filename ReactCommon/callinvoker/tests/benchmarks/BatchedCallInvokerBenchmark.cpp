@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ReactCommon/BatchedCallInvoker.h>
+
+// Compares scheduling work on a MessageQueueThread-like invoker directly, one
+// locked std::function per call, with going through BatchedCallInvoker.
+// Throughput is measured for bursts posted from one or more native threads;
+// latency is the round trip of a single call to an idle JS thread.
+
+using namespace facebook::react;
+
+namespace {
+
+// A thread draining a locked queue of std::functions, like
+// MessageQueueThread.
+class LoopCallInvoker : public CallInvoker {
+ public:
+  LoopCallInvoker() : thread_([this] { run(); }) {}
+
+  ~LoopCallInvoker() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+    }
+    condition_.notify_one();
+    thread_.join();
+  }
+
+  void invokeAsync(std::function<void()> &&func) override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push_back(std::move(func));
+    }
+    condition_.notify_one();
+  }
+
+  void invokeSync(std::function<void()> &&) override {}
+
+  size_t wakeups() const {
+    return wakeups_.load();
+  }
+
+ private:
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      condition_.wait(lock, [this] { return stopped_ || !queue_.empty(); });
+      if (stopped_) {
+        return;
+      }
+      auto func = std::move(queue_.front());
+      queue_.pop_front();
+      lock.unlock();
+      wakeups_++;
+      func();
+      lock.lock();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::function<void()>> queue_;
+  bool stopped_{false};
+  std::atomic<size_t> wakeups_{0};
+  std::thread thread_;
+};
+
+// Resolving a promise captures a few pointers, as in CallbackWrapper.
+struct Resolution {
+  std::atomic<int64_t> *remaining;
+  void *callback;
+  void *result;
+
+  void operator()() const {
+    remaining->fetch_sub(1, std::memory_order_release);
+  }
+};
+
+void waitUntilZero(const std::atomic<int64_t> &remaining) {
+  while (remaining.load(std::memory_order_acquire) != 0) {
+    std::this_thread::yield();
+  }
+}
+
+std::shared_ptr<CallInvoker> makeInvoker(
+    bool batched,
+    const std::shared_ptr<LoopCallInvoker> &loop) {
+  if (batched) {
+    return std::make_shared<BatchedCallInvoker>(loop);
+  }
+  return loop;
+}
+
+void burstThroughput(benchmark::State &state, bool batched) {
+  auto loop = std::make_shared<LoopCallInvoker>();
+  auto invoker = makeInvoker(batched, loop);
+  int64_t burst = state.range(0);
+  std::atomic<int64_t> remaining{0};
+  for (auto _ : state) {
+    remaining = burst;
+    for (int64_t i = 0; i < burst; i++) {
+      invoker->invokeAsync(Resolution{&remaining, nullptr, nullptr});
+    }
+    waitUntilZero(remaining);
+  }
+  state.SetItemsProcessed(state.iterations() * burst);
+  state.counters["wakeupsPerBurst"] =
+      static_cast<double>(loop->wakeups()) / state.iterations();
+}
+
+void directBurstThroughput(benchmark::State &state) {
+  burstThroughput(state, false);
+}
+BENCHMARK(directBurstThroughput)->Range(8, 4 << 10)->UseRealTime();
+
+void batchedBurstThroughput(benchmark::State &state) {
+  burstThroughput(state, true);
+}
+BENCHMARK(batchedBurstThroughput)->Range(8, 4 << 10)->UseRealTime();
+
+void batchedInlineBurstThroughput(benchmark::State &state) {
+  auto loop = std::make_shared<LoopCallInvoker>();
+  auto invoker = std::make_shared<BatchedCallInvoker>(loop);
+  int64_t burst = state.range(0);
+  std::atomic<int64_t> remaining{0};
+  for (auto _ : state) {
+    remaining = burst;
+    for (int64_t i = 0; i < burst; i++) {
+      invoker->invokeAsyncInline(Resolution{&remaining, nullptr, nullptr});
+    }
+    waitUntilZero(remaining);
+  }
+  state.SetItemsProcessed(state.iterations() * burst);
+}
+BENCHMARK(batchedInlineBurstThroughput)->Range(8, 4 << 10)->UseRealTime();
+
+void producersThroughput(benchmark::State &state, bool batched) {
+  constexpr int64_t kCallsPerProducer = 1000;
+  auto loop = std::make_shared<LoopCallInvoker>();
+  auto invoker = makeInvoker(batched, loop);
+  int64_t producerCount = state.range(0);
+  std::atomic<int64_t> remaining{0};
+  for (auto _ : state) {
+    remaining = producerCount * kCallsPerProducer;
+    std::vector<std::thread> producers;
+    for (int64_t p = 0; p < producerCount; p++) {
+      producers.emplace_back([&] {
+        for (int64_t i = 0; i < kCallsPerProducer; i++) {
+          invoker->invokeAsync(Resolution{&remaining, nullptr, nullptr});
+        }
+      });
+    }
+    for (auto &producer : producers) {
+      producer.join();
+    }
+    waitUntilZero(remaining);
+  }
+  state.SetItemsProcessed(
+      state.iterations() * producerCount * kCallsPerProducer);
+}
+
+void directProducersThroughput(benchmark::State &state) {
+  producersThroughput(state, false);
+}
+BENCHMARK(directProducersThroughput)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+
+void batchedProducersThroughput(benchmark::State &state) {
+  producersThroughput(state, true);
+}
+BENCHMARK(batchedProducersThroughput)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+
+void singleCallLatency(benchmark::State &state, bool batched) {
+  auto loop = std::make_shared<LoopCallInvoker>();
+  auto invoker = makeInvoker(batched, loop);
+  std::atomic<int64_t> remaining{0};
+  for (auto _ : state) {
+    remaining = 1;
+    invoker->invokeAsync(Resolution{&remaining, nullptr, nullptr});
+    waitUntilZero(remaining);
+  }
+}
+
+void directSingleCallLatency(benchmark::State &state) {
+  singleCallLatency(state, false);
+}
+BENCHMARK(directSingleCallLatency)->UseRealTime();
+
+void batchedSingleCallLatency(benchmark::State &state) {
+  singleCallLatency(state, true);
+}
+BENCHMARK(batchedSingleCallLatency)->UseRealTime();
+
+} // namespace
+
+BENCHMARK_MAIN();
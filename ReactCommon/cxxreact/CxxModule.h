@@ -12,6 +12,7 @@
 #include <tuple>
 #include <vector>
 
+#include <folly/Optional.h>
 #include <folly/dynamic.h>
 
 using namespace std::placeholders;
@@ -227,6 +228,39 @@ class CxxModule {
     return {};
   };
 
+  /**
+   * Return true to have constants read by JS one key at a time instead of
+   * all at once when the module is first required.  This is worthwhile for
+   * modules exporting large maps which JS rarely reads in full; such
+   * modules should also override getConstantNames() and getConstant() so
+   * that the full map is never built.  The defaults call getConstants()
+   * once and keep the result.
+   */
+  virtual bool hasLazyConstants() {
+    return false;
+  }
+
+  /**
+   * @return the names of the constants this module exports to JS.
+   */
+  virtual auto getConstantNames() -> std::vector<std::string> {
+    std::vector<std::string> names;
+    for (auto &pair : getCachedConstants()) {
+      names.push_back(pair.first);
+    }
+    return names;
+  }
+
+  /**
+   * @return the value of a single constant, or null if there is no such
+   * constant.
+   */
+  virtual folly::dynamic getConstant(const std::string &name) {
+    const auto &constants = getCachedConstants();
+    auto it = constants.find(name);
+    return it == constants.end() ? nullptr : it->second;
+  }
+
   /**
    * @return a list of methods this module exports to JS.
    */
@@ -250,7 +284,15 @@ class CxxModule {
   }
 
  private:
+  const std::map<std::string, folly::dynamic> &getCachedConstants() {
+    if (!cachedConstants_) {
+      cachedConstants_ = getConstants();
+    }
+    return *cachedConstants_;
+  }
+
   std::weak_ptr<react::Instance> instance_;
+  folly::Optional<std::map<std::string, folly::dynamic>> cachedConstants_;
 };
 
 } // namespace module
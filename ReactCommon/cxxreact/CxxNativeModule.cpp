@@ -82,10 +82,35 @@ folly::dynamic CxxNativeModule::getConstants() {
   return constants;
 }
 
+bool CxxNativeModule::hasLazyConstants() {
+  lazyInit();
+  return module_ && module_->hasLazyConstants();
+}
+
+std::vector<std::string> CxxNativeModule::getConstantNames() {
+  lazyInit();
+
+  if (!module_) {
+    return {};
+  }
+  return module_->getConstantNames();
+}
+
+folly::dynamic CxxNativeModule::getConstant(const std::string &name) {
+  lazyInit();
+
+  if (!module_) {
+    return nullptr;
+  }
+  return module_->getConstant(name);
+}
+
 void CxxNativeModule::invoke(
     unsigned int reactMethodId,
     folly::dynamic &&params,
     int callId) {
+  lazyInit();
+
   if (reactMethodId >= methods_.size()) {
     throw std::invalid_argument(folly::to<std::string>(
         "methodId ",
@@ -180,6 +205,8 @@ void CxxNativeModule::invoke(
 MethodCallResult CxxNativeModule::callSerializableNativeHook(
     unsigned int hookId,
     folly::dynamic &&args) {
+  lazyInit();
+
   if (hookId >= methods_.size()) {
     throw std::invalid_argument(folly::to<std::string>(
         "methodId ", hookId, " out of range [0..", methods_.size(), "]"));
@@ -196,17 +223,21 @@ MethodCallResult CxxNativeModule::callSerializableNativeHook(
 }
 
 void CxxNativeModule::lazyInit() {
-  if (module_ || !provider_) {
-    return;
-  }
+  // With a module config cache, the first call may come from the module's
+  // own thread (invoke) rather than the JS thread, so guard against races.
+  std::call_once(lazyInitFlag_, [this] {
+    if (module_ || !provider_) {
+      return;
+    }
 
-  // TODO 17216751: providers should never return null modules
-  module_ = provider_();
-  provider_ = nullptr;
-  if (module_) {
-    methods_ = module_->getMethods();
-    module_->setInstance(instance_);
-  }
+    // TODO 17216751: providers should never return null modules
+    module_ = provider_();
+    provider_ = nullptr;
+    if (module_) {
+      methods_ = module_->getMethods();
+      module_->setInstance(instance_);
+    }
+  });
 }
 
 } // namespace react
@@ -10,6 +10,8 @@
 #include <cxxreact/CxxModule.h>
 #include <cxxreact/NativeModule.h>
 
+#include <mutex>
+
 #ifndef RN_EXPORT
 #define RN_EXPORT __attribute__((visibility("default")))
 #endif
@@ -39,6 +41,9 @@ class RN_EXPORT CxxNativeModule : public NativeModule {
   std::string getName() override;
   std::vector<MethodDescriptor> getMethods() override;
   folly::dynamic getConstants() override;
+  bool hasLazyConstants() override;
+  std::vector<std::string> getConstantNames() override;
+  folly::dynamic getConstant(const std::string &name) override;
   void invoke(unsigned int reactMethodId, folly::dynamic &&params, int callId)
       override;
   MethodCallResult callSerializableNativeHook(
@@ -52,6 +57,7 @@ class RN_EXPORT CxxNativeModule : public NativeModule {
   std::string name_;
   xplat::module::CxxModule::Provider provider_;
   std::shared_ptr<MessageQueueThread> messageQueueThread_;
+  std::once_flag lazyInitFlag_;
   std::unique_ptr<xplat::module::CxxModule> module_;
   std::vector<xplat::module::CxxModule::Method> methods_;
 };
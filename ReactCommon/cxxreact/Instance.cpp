@@ -12,6 +12,8 @@
 #include "JSExecutor.h"
 #include "MessageQueueThread.h"
 #include "MethodCall.h"
+#include "ModuleConfigCache.h"
+#include "ModuleRegistry.h"
 #include "NativeToJsBridge.h"
 #include "RAMBundleRegistry.h"
 #include "RecoverableError.h"
@@ -24,6 +26,7 @@
 #include <glog/logging.h>
 
 #include <condition_variable>
+#include <cstdio>
 #include <exception>
 #include <fstream>
 #include <memory>
@@ -75,6 +78,7 @@ void Instance::loadBundle(
   SystraceSection s("Instance::loadBundle", "sourceURL", sourceURL);
   nativeToJsBridge_->loadBundle(
       std::move(bundleRegistry), std::move(string), std::move(sourceURL));
+  saveModuleConfigCache();
 }
 
 void Instance::loadBundleSync(
@@ -87,6 +91,67 @@ void Instance::loadBundleSync(
   SystraceSection s("Instance::loadBundleSync", "sourceURL", sourceURL);
   nativeToJsBridge_->loadBundleSync(
       std::move(bundleRegistry), std::move(string), std::move(sourceURL));
+  saveModuleConfigCache();
+}
+
+void Instance::setModuleConfigCachePath(
+    std::string path,
+    std::string buildId) {
+  moduleConfigCachePath_ = std::move(path);
+  moduleConfigCacheBuildId_ = std::move(buildId);
+
+  // Queued ahead of the bundle, so the cache is in place before JS
+  // requires its first module.
+  nativeToJsBridge_->runOnExecutorQueue(
+      [moduleRegistry = moduleRegistry_,
+       path = moduleConfigCachePath_,
+       buildId = moduleConfigCacheBuildId_](JSExecutor *) {
+        SystraceSection s("Instance::loadModuleConfigCache");
+        std::unique_ptr<const JSBigFileString> snapshot;
+        try {
+          snapshot = JSBigFileString::fromPath(path);
+        } catch (const std::system_error &) {
+          // No snapshot yet, e.g. on the first launch.
+          return;
+        }
+        moduleRegistry->setConfigCache(
+            ModuleConfigCache::load(std::move(snapshot), buildId));
+      });
+}
+
+void Instance::saveModuleConfigCache() {
+  if (moduleConfigCachePath_.empty() || moduleConfigCacheSaved_) {
+    return;
+  }
+  moduleConfigCacheSaved_ = true;
+
+  // Runs after the bundle, so the snapshot holds the method tables of the
+  // modules required during startup.
+  nativeToJsBridge_->runOnExecutorQueue(
+      [moduleRegistry = moduleRegistry_,
+       path = moduleConfigCachePath_,
+       buildId = moduleConfigCacheBuildId_](JSExecutor *) {
+        SystraceSection s("Instance::saveModuleConfigCache");
+        std::string snapshot = moduleRegistry->snapshotConfigs(buildId);
+
+        // The previous snapshot may still be mapped by the registry, so it
+        // is replaced rather than rewritten in place.
+        std::string tempPath = path + ".tmp";
+        {
+          std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+          file.write(snapshot.data(), snapshot.size());
+          if (!file) {
+            LOG(WARNING) << "Could not write native module config cache to "
+                         << tempPath;
+            return;
+          }
+        }
+        if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+          LOG(WARNING) << "Could not replace native module config cache at "
+                       << path;
+          std::remove(tempPath.c_str());
+        }
+      });
 }
 
 void Instance::setSourceURL(std::string sourceURL) {
@@ -226,7 +291,7 @@ void Instance::handleMemoryPressure(int pressureLevel) {
 }
 
 std::shared_ptr<CallInvoker> Instance::getJSCallInvoker() {
-  return std::static_pointer_cast<CallInvoker>(jsCallInvoker_);
+  return std::static_pointer_cast<CallInvoker>(batchedJSCallInvoker_);
 }
 
 std::shared_ptr<CallInvoker> Instance::getDecoratedNativeCallInvoker(
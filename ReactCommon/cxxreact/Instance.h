@@ -12,6 +12,7 @@
 #include <memory>
 #include <mutex>
 
+#include <ReactCommon/BatchedCallInvoker.h>
 #include <cxxreact/NativeToJsBridge.h>
 
 #ifndef RN_EXPORT
@@ -85,6 +86,14 @@ class RN_EXPORT Instance {
   // This method is experimental, and may be modified or removed.
   void registerBundle(uint32_t bundleId, const std::string &bundlePath);
 
+  /**
+   * Restores native module configs from the snapshot at path if it was
+   * written for buildId (see ModuleConfigCache), and writes a fresh
+   * snapshot there once the first bundle has run.  Call after
+   * initializeBridge() and before loading the bundle.
+   */
+  void setModuleConfigCachePath(std::string path, std::string buildId);
+
   const ModuleRegistry &getModuleRegistry() const;
   ModuleRegistry &getModuleRegistry();
 
@@ -99,6 +108,10 @@ class RN_EXPORT Instance {
    *   needs to flush all queued NativeModule method calls. The bridge must
    *   also dispatch onBatchComplete if the queue of NativeModule method calls
    *   was not empty.
+   *
+   * - Work is batched by a BatchedCallInvoker, so that a burst of calls from
+   *   native threads (e.g. resolving many promises) is run, and flushed, in
+   *   one trip to the JS thread.
    */
   std::shared_ptr<CallInvoker> getJSCallInvoker();
 
@@ -139,11 +152,16 @@ class RN_EXPORT Instance {
       std::unique_ptr<RAMBundleRegistry> bundleRegistry,
       std::unique_ptr<const JSBigString> startupScript,
       std::string startupScriptSourceURL);
+  void saveModuleConfigCache();
 
   std::shared_ptr<InstanceCallback> callback_;
   std::shared_ptr<NativeToJsBridge> nativeToJsBridge_;
   std::shared_ptr<ModuleRegistry> moduleRegistry_;
 
+  std::string moduleConfigCachePath_;
+  std::string moduleConfigCacheBuildId_;
+  bool moduleConfigCacheSaved_ = false;
+
   std::mutex m_syncMutex;
   std::condition_variable m_syncCV;
   bool m_syncReady = false;
@@ -166,6 +184,8 @@ class RN_EXPORT Instance {
 
   std::shared_ptr<JSCallInvoker> jsCallInvoker_ =
       std::make_shared<JSCallInvoker>();
+  std::shared_ptr<BatchedCallInvoker> batchedJSCallInvoker_ =
+      std::make_shared<BatchedCallInvoker>(jsCallInvoker_);
 };
 
 } // namespace react
@@ -7,31 +7,154 @@
 
 #include "JSDeltaBundleClient.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
-#include <sstream>
 
 namespace facebook {
 namespace react {
 
 namespace {
+
+// Extra room given to every module so that small edits, which are the
+// common case in a dev loop, can be patched in place.
+size_t capacityForLength(size_t length) {
+  size_t capacity = length + length / 8;
+  return (capacity + 7) & ~static_cast<size_t>(7);
+}
+
 std::string startupCode(const folly::dynamic *pre, const folly::dynamic *post) {
-  std::ostringstream startupCode;
+  std::string startupCode;
+
+  size_t size = 0;
+  for (auto section : {pre, post}) {
+    if (section != nullptr) {
+      size += section->getString().size() + 1;
+    }
+  }
+  startupCode.reserve(size);
 
   for (auto section : {pre, post}) {
     if (section != nullptr) {
-      startupCode << section->getString() << '\n';
+      startupCode.append(section->getString());
+      startupCode.push_back('\n');
     }
   }
 
-  return startupCode.str();
+  return startupCode;
 }
+
+// Lets callers hold on to the startup code without copying it.
+class SharedStdString : public JSBigString {
+ public:
+  SharedStdString(std::shared_ptr<const std::string> str)
+      : m_str(std::move(str)) {}
+
+  bool isAscii() const override {
+    return false;
+  }
+
+  const char *c_str() const override {
+    return m_str->c_str();
+  }
+
+  size_t size() const override {
+    return m_str->size();
+  }
+
+ private:
+  std::shared_ptr<const std::string> m_str;
+};
+
 } // namespace
 
+constexpr size_t JSDeltaBundleClient::kDefaultSegmentSize;
+
+JSDeltaBundleClient::JSDeltaBundleClient(size_t segmentSize)
+    : segmentSize_(segmentSize),
+      startupCode_(std::make_shared<const std::string>()) {}
+
+JSDeltaBundleClient::Span JSDeltaBundleClient::allocate(size_t length) {
+  size_t capacity = capacityForLength(length);
+
+  // Segments are filled in order, so every segment after the current one is
+  // empty (they are only left over from before the last clear()).
+  while (currentSegment_ < segments_.size()) {
+    auto &segment = segments_[currentSegment_];
+    if (segment.size - segment.used >= capacity) {
+      break;
+    }
+    currentSegment_++;
+  }
+  if (currentSegment_ == segments_.size()) {
+    size_t size = std::max(segmentSize_, capacity);
+    segments_.push_back({std::unique_ptr<char[]>(new char[size]), size, 0});
+  }
+
+  auto &segment = segments_[currentSegment_];
+  Span span{static_cast<uint32_t>(currentSegment_),
+            static_cast<uint32_t>(segment.used),
+            0,
+            static_cast<uint32_t>(capacity)};
+  segment.used += capacity;
+  return span;
+}
+
+void JSDeltaBundleClient::setModule(uint32_t moduleId, const std::string &code) {
+  auto it = index_.find(moduleId);
+  if (it == index_.end()) {
+    it = index_.emplace(moduleId, allocate(code.size())).first;
+  } else if (code.size() > it->second.capacity) {
+    deadBytes_ += it->second.capacity;
+    it->second = allocate(code.size());
+  }
+
+  auto &span = it->second;
+  memcpy(
+      segments_[span.segment].data.get() + span.offset,
+      code.data(),
+      code.size());
+  span.length = static_cast<uint32_t>(code.size());
+}
+
+void JSDeltaBundleClient::eraseModule(uint32_t moduleId) {
+  auto it = index_.find(moduleId);
+  if (it != index_.end()) {
+    deadBytes_ += it->second.capacity;
+    index_.erase(it);
+  }
+}
+
+void JSDeltaBundleClient::compactIfNeeded() {
+  size_t usedBytes = 0;
+  for (const auto &segment : segments_) {
+    usedBytes += segment.used;
+  }
+  // Only compact once most of the arena is garbage, which keeps the cost
+  // amortized over many incremental patches.
+  if (deadBytes_ < segmentSize_ || deadBytes_ < usedBytes - deadBytes_) {
+    return;
+  }
+
+  auto oldSegments = std::move(segments_);
+  segments_.clear();
+  currentSegment_ = 0;
+  deadBytes_ = 0;
+  for (auto &entry : index_) {
+    auto oldSpan = entry.second;
+    auto span = allocate(oldSpan.length);
+    memcpy(
+        segments_[span.segment].data.get() + span.offset,
+        oldSegments[oldSpan.segment].data.get() + oldSpan.offset,
+        oldSpan.length);
+    span.length = oldSpan.length;
+    entry.second = span;
+  }
+}
+
 void JSDeltaBundleClient::patchModules(const folly::dynamic *modules) {
   for (const folly::dynamic &pair : *modules) {
-    auto id = pair[0].getInt();
-    auto module = pair[1];
-    modules_[id] = std::move(module.getString());
+    setModule(static_cast<uint32_t>(pair[0].getInt()), pair[1].getString());
   }
 }
 
@@ -44,17 +167,18 @@ void JSDeltaBundleClient::patch(const folly::dynamic &delta) {
     auto const pre = delta.get_ptr("pre");
     auto const post = delta.get_ptr("post");
 
-    startupCode_ = startupCode(pre, post);
+    startupCode_ = std::make_shared<const std::string>(startupCode(pre, post));
 
     const folly::dynamic *modules = delta.get_ptr("modules");
     if (modules != nullptr) {
+      index_.reserve(modules->size());
       patchModules(modules);
     }
   } else {
     const folly::dynamic *deleted = delta.get_ptr("deleted");
     if (deleted != nullptr) {
       for (const folly::dynamic &id : *deleted) {
-        modules_.erase(id.getInt());
+        eraseModule(static_cast<uint32_t>(id.getInt()));
       }
     }
 
@@ -74,26 +198,41 @@ void JSDeltaBundleClient::patch(const folly::dynamic &delta) {
     if (modified != nullptr) {
       patchModules(modified);
     }
+
+    compactIfNeeded();
   }
 }
 
-JSModulesUnbundle::Module JSDeltaBundleClient::getModule(
-    uint32_t moduleId) const {
-  auto search = modules_.find(moduleId);
-  if (search != modules_.end()) {
-    return {folly::to<std::string>(search->first, ".js"), search->second};
+folly::StringPiece JSDeltaBundleClient::getModuleCode(uint32_t moduleId) const {
+  auto search = index_.find(moduleId);
+  if (search != index_.end()) {
+    const auto &span = search->second;
+    return folly::StringPiece(
+        segments_[span.segment].data.get() + span.offset, span.length);
   }
 
   throw JSModulesUnbundle::ModuleNotFound(moduleId);
 }
 
+JSModulesUnbundle::Module JSDeltaBundleClient::getModule(
+    uint32_t moduleId) const {
+  auto code = getModuleCode(moduleId);
+  return {folly::to<std::string>(moduleId, ".js"), code.str()};
+}
+
 std::unique_ptr<const JSBigString> JSDeltaBundleClient::getStartupCode() const {
-  return std::make_unique<JSBigStdString>(startupCode_);
+  return std::make_unique<SharedStdString>(startupCode_);
 }
 
 void JSDeltaBundleClient::clear() {
-  modules_.clear();
-  startupCode_.clear();
+  // Keep the segments around; a base patch usually refills them right away.
+  for (auto &segment : segments_) {
+    segment.used = 0;
+  }
+  currentSegment_ = 0;
+  index_.clear();
+  deadBytes_ = 0;
+  startupCode_ = std::make_shared<const std::string>();
 }
 
 } // namespace react
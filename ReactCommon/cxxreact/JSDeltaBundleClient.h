@@ -11,26 +11,76 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/JSModulesUnbundle.h>
+#include <folly/Range.h>
 #include <folly/dynamic.h>
 
 namespace facebook {
 namespace react {
 
+/**
+ * Holds the modules of a delta bundle.  Module code is stored back to back
+ * in a few large arena segments with an id -> span index, so applying a
+ * delta does not allocate per module, and modified modules are overwritten
+ * in place whenever the new code fits in the old span.  Segments are reused
+ * across base reloads.
+ */
 class JSDeltaBundleClient {
  public:
+  static constexpr size_t kDefaultSegmentSize = 256 * 1024;
+
+  explicit JSDeltaBundleClient(size_t segmentSize = kDefaultSegmentSize);
+
   void patch(const folly::dynamic &delta);
   JSModulesUnbundle::Module getModule(uint32_t moduleId) const;
+
+  /**
+   * Zero-copy variant of getModule().  The returned view is valid until the
+   * next call to patch() or clear().
+   */
+  folly::StringPiece getModuleCode(uint32_t moduleId) const;
+
+  /**
+   * The returned string shares its storage with the client and stays valid
+   * after later patches.
+   */
   std::unique_ptr<const JSBigString> getStartupCode() const;
   void clear();
 
+  size_t moduleCount() const {
+    return index_.size();
+  }
+
  private:
-  std::unordered_map<uint32_t, std::string> modules_;
-  std::string startupCode_;
+  struct Segment {
+    std::unique_ptr<char[]> data;
+    size_t size;
+    size_t used;
+  };
+
+  struct Span {
+    uint32_t segment;
+    uint32_t offset;
+    uint32_t length;
+    uint32_t capacity;
+  };
+
+  size_t segmentSize_;
+  std::vector<Segment> segments_;
+  size_t currentSegment_{0};
+  std::unordered_map<uint32_t, Span> index_;
+  // Bytes held by spans which were replaced or deleted.
+  size_t deadBytes_{0};
+  std::shared_ptr<const std::string> startupCode_;
 
-  void patchModules(const folly::dynamic *delta);
+  void patchModules(const folly::dynamic *modules);
+  void setModule(uint32_t moduleId, const std::string &code);
+  void eraseModule(uint32_t moduleId);
+  Span allocate(size_t length);
+  void compactIfNeeded();
 };
 
 class JSDeltaBundleClientRAMBundle : public JSModulesUnbundle {
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ModuleConfigCache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <folly/hash/Hash.h>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+// All integers are stored in native byte order, which is little-endian on
+// every platform React Native runs on.
+constexpr char kMagic[4] = {'R', 'N', 'M', 'C'};
+constexpr uint32_t kUnknownMethods = UINT32_MAX;
+
+struct Header {
+  char magic[4];
+  uint32_t version;
+  uint64_t buildHash;
+  uint32_t moduleCount;
+  uint32_t methodCount;
+  uint32_t stringsSize;
+  uint32_t reserved;
+};
+
+struct ModuleRecord {
+  uint32_t nameOffset;
+  uint32_t nameLength;
+  uint32_t index;
+  uint32_t firstMethod;
+  // kUnknownMethods if only the name was recorded.
+  uint32_t methodCount;
+};
+
+struct MethodRecord {
+  uint32_t nameOffset;
+  uint32_t nameLength;
+  uint32_t typeOffset;
+  uint32_t typeLength;
+};
+
+static_assert(sizeof(Header) == 32, "Snapshot header layout changed");
+static_assert(sizeof(ModuleRecord) == 20, "Snapshot module layout changed");
+static_assert(sizeof(MethodRecord) == 16, "Snapshot method layout changed");
+
+template <typename T>
+T readAt(const char *base, size_t offset) {
+  // The buffer may not be suitably aligned, so never dereference in place.
+  T value;
+  memcpy(&value, base + offset, sizeof(T));
+  return value;
+}
+
+template <typename T>
+void append(std::string &out, const T &value) {
+  out.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+size_t modulesOffset() {
+  return sizeof(Header);
+}
+
+size_t methodsOffset(const Header &header) {
+  return modulesOffset() + header.moduleCount * sizeof(ModuleRecord);
+}
+
+size_t stringsOffset(const Header &header) {
+  return methodsOffset(header) + header.methodCount * sizeof(MethodRecord);
+}
+
+bool inStrings(const Header &header, uint32_t offset, uint32_t length) {
+  return offset <= header.stringsSize &&
+      length <= header.stringsSize - offset;
+}
+
+int compareName(
+    const char *strings,
+    const ModuleRecord &record,
+    const std::string &name) {
+  size_t length = std::min<size_t>(record.nameLength, name.size());
+  int result = memcmp(strings + record.nameOffset, name.data(), length);
+  if (result != 0) {
+    return result;
+  }
+  if (record.nameLength == name.size()) {
+    return 0;
+  }
+  return record.nameLength < name.size() ? -1 : 1;
+}
+
+} // namespace
+
+constexpr uint32_t ModuleConfigCache::kVersion;
+
+void ModuleConfigCache::Builder::addModule(std::string name, size_t index) {
+  entries_.push_back({std::move(name), index, false, {}});
+}
+
+void ModuleConfigCache::Builder::addModule(
+    std::string name,
+    size_t index,
+    std::vector<MethodDescriptor> methods) {
+  entries_.push_back({std::move(name), index, true, std::move(methods)});
+}
+
+std::string ModuleConfigCache::Builder::build(
+    const std::string &buildId) const {
+  // Binary search needs unique names.  Like ModuleRegistry, the module
+  // added last wins, so entries are visited newest first and the sort is
+  // stable.
+  std::vector<const Entry *> sorted;
+  sorted.reserve(entries_.size());
+  for (auto it = entries_.rbegin(); it != entries_.rend(); ++it) {
+    sorted.push_back(&*it);
+  }
+  std::stable_sort(
+      sorted.begin(), sorted.end(), [](const Entry *a, const Entry *b) {
+        return a->name < b->name;
+      });
+  sorted.erase(
+      std::unique(
+          sorted.begin(),
+          sorted.end(),
+          [](const Entry *a, const Entry *b) { return a->name == b->name; }),
+      sorted.end());
+
+  std::string strings;
+  auto addString = [&strings](const std::string &value) {
+    uint32_t offset = static_cast<uint32_t>(strings.size());
+    strings.append(value);
+    return offset;
+  };
+
+  std::vector<ModuleRecord> modules;
+  std::vector<MethodRecord> methods;
+  modules.reserve(sorted.size());
+  for (const Entry *entry : sorted) {
+    ModuleRecord record;
+    record.nameOffset = addString(entry->name);
+    record.nameLength = static_cast<uint32_t>(entry->name.size());
+    record.index = static_cast<uint32_t>(entry->index);
+    record.firstMethod = static_cast<uint32_t>(methods.size());
+    record.methodCount = entry->hasMethods
+        ? static_cast<uint32_t>(entry->methods.size())
+        : kUnknownMethods;
+    for (const auto &method : entry->methods) {
+      MethodRecord methodRecord;
+      methodRecord.nameOffset = addString(method.name);
+      methodRecord.nameLength = static_cast<uint32_t>(method.name.size());
+      methodRecord.typeOffset = addString(method.type);
+      methodRecord.typeLength = static_cast<uint32_t>(method.type.size());
+      methods.push_back(methodRecord);
+    }
+    modules.push_back(record);
+  }
+
+  Header header;
+  memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.buildHash = folly::hash::fnv64(buildId);
+  header.moduleCount = static_cast<uint32_t>(modules.size());
+  header.methodCount = static_cast<uint32_t>(methods.size());
+  header.stringsSize = static_cast<uint32_t>(strings.size());
+  header.reserved = 0;
+
+  std::string out;
+  out.reserve(stringsOffset(header) + strings.size());
+  append(out, header);
+  for (const auto &record : modules) {
+    append(out, record);
+  }
+  for (const auto &record : methods) {
+    append(out, record);
+  }
+  out.append(strings);
+  return out;
+}
+
+ModuleConfigCache::ModuleConfigCache(std::unique_ptr<const JSBigString> data)
+    : data_(std::move(data)) {
+  moduleCount_ = readAt<Header>(data_->c_str(), 0).moduleCount;
+}
+
+std::unique_ptr<const ModuleConfigCache> ModuleConfigCache::load(
+    std::unique_ptr<const JSBigString> data,
+    const std::string &buildId) {
+  if (!data || data->size() < sizeof(Header)) {
+    return nullptr;
+  }
+  const char *base = data->c_str();
+  auto header = readAt<Header>(base, 0);
+  if (memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+      header.version != kVersion ||
+      header.buildHash != folly::hash::fnv64(buildId)) {
+    return nullptr;
+  }
+
+  // Bounds are checked once here so that lookups can trust the records.
+  uint64_t expectedSize = sizeof(Header) +
+      uint64_t(header.moduleCount) * sizeof(ModuleRecord) +
+      uint64_t(header.methodCount) * sizeof(MethodRecord) + header.stringsSize;
+  if (expectedSize != data->size()) {
+    return nullptr;
+  }
+
+  const char *strings = base + stringsOffset(header);
+  for (uint32_t i = 0; i < header.moduleCount; i++) {
+    auto record = readAt<ModuleRecord>(
+        base, modulesOffset() + i * sizeof(ModuleRecord));
+    if (!inStrings(header, record.nameOffset, record.nameLength)) {
+      return nullptr;
+    }
+    if (record.methodCount != kUnknownMethods &&
+        (record.firstMethod > header.methodCount ||
+         record.methodCount > header.methodCount - record.firstMethod)) {
+      return nullptr;
+    }
+    if (i > 0) {
+      auto previous = readAt<ModuleRecord>(
+          base, modulesOffset() + (i - 1) * sizeof(ModuleRecord));
+      std::string name(strings + record.nameOffset, record.nameLength);
+      if (compareName(strings, previous, name) >= 0) {
+        return nullptr;
+      }
+    }
+  }
+  for (uint32_t i = 0; i < header.methodCount; i++) {
+    auto record = readAt<MethodRecord>(
+        base, methodsOffset(header) + i * sizeof(MethodRecord));
+    if (!inStrings(header, record.nameOffset, record.nameLength) ||
+        !inStrings(header, record.typeOffset, record.typeLength)) {
+      return nullptr;
+    }
+  }
+
+  return std::unique_ptr<const ModuleConfigCache>(
+      new ModuleConfigCache(std::move(data)));
+}
+
+folly::Optional<ModuleConfigCache::Module> ModuleConfigCache::find(
+    const std::string &name) const {
+  const char *base = data_->c_str();
+  auto header = readAt<Header>(base, 0);
+  const char *strings = base + stringsOffset(header);
+
+  size_t low = 0;
+  size_t high = header.moduleCount;
+  while (low < high) {
+    size_t middle = low + (high - low) / 2;
+    auto record = readAt<ModuleRecord>(
+        base, modulesOffset() + middle * sizeof(ModuleRecord));
+    int comparison = compareName(strings, record, name);
+    if (comparison < 0) {
+      low = middle + 1;
+    } else if (comparison > 0) {
+      high = middle;
+    } else {
+      Module module{record.index, record.methodCount != kUnknownMethods, {}};
+      if (module.hasMethods) {
+        module.methods.reserve(record.methodCount);
+        for (uint32_t i = 0; i < record.methodCount; i++) {
+          auto method = readAt<MethodRecord>(
+              base,
+              methodsOffset(header) +
+                  (record.firstMethod + i) * sizeof(MethodRecord));
+          module.methods.emplace_back(
+              std::string(strings + method.nameOffset, method.nameLength),
+              std::string(strings + method.typeOffset, method.typeLength));
+        }
+      }
+      return module;
+    }
+  }
+  return folly::none;
+}
+
+} // namespace react
+} // namespace facebook
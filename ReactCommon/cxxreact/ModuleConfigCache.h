@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cxxreact/JSBigString.h>
+#include <cxxreact/NativeModule.h>
+#include <folly/Optional.h>
+
+namespace facebook {
+namespace react {
+
+/**
+ * A read-only snapshot of the parts of the native module configs which do
+ * not change between launches of the same app build: normalized module
+ * names, their registry indices, and their method tables.  ModuleRegistry
+ * uses it to skip name normalization and NativeModule::getMethods() when
+ * JS first requires a module.
+ *
+ * The snapshot is a flat little-endian binary which is searched in place,
+ * so it can be backed by a memory-mapped file (see
+ * JSBigFileString::fromPath()).  Layout:
+ *
+ *   Header
+ *   ModuleRecord[moduleCount]    sorted by name
+ *   MethodRecord[methodCount]
+ *   char strings[]               names, not NUL-terminated
+ *
+ * A snapshot is only accepted by load() if its format version and build id
+ * match; anything else is treated as a cache miss.
+ */
+class ModuleConfigCache {
+ public:
+  static constexpr uint32_t kVersion = 1;
+
+  struct Module {
+    size_t index;
+    // False if the snapshot only knows the module's name.
+    bool hasMethods;
+    std::vector<MethodDescriptor> methods;
+  };
+
+  /**
+   * Collects module configs and serializes them into a snapshot.
+   */
+  class Builder {
+   public:
+    void addModule(std::string name, size_t index);
+    void addModule(
+        std::string name,
+        size_t index,
+        std::vector<MethodDescriptor> methods);
+    std::string build(const std::string &buildId) const;
+
+   private:
+    struct Entry {
+      std::string name;
+      size_t index;
+      bool hasMethods;
+      std::vector<MethodDescriptor> methods;
+    };
+    std::vector<Entry> entries_;
+  };
+
+  /**
+   * @return the cache, or nullptr if data is not a valid snapshot for this
+   * format version and buildId.
+   */
+  static std::unique_ptr<const ModuleConfigCache> load(
+      std::unique_ptr<const JSBigString> data,
+      const std::string &buildId);
+
+  size_t moduleCount() const {
+    return moduleCount_;
+  }
+
+  folly::Optional<Module> find(const std::string &name) const;
+
+ private:
+  ModuleConfigCache(std::unique_ptr<const JSBigString> data);
+
+  std::unique_ptr<const JSBigString> data_;
+  size_t moduleCount_{0};
+};
+
+} // namespace react
+} // namespace facebook
@@ -10,6 +10,7 @@
 #include <glog/logging.h>
 
 #include "NativeModule.h"
+#include "ReactMarker.h"
 #include "SystraceSection.h"
 
 namespace facebook {
@@ -86,28 +87,84 @@ std::vector<std::string> ModuleRegistry::moduleNames() {
   return names;
 }
 
+void ModuleRegistry::setConfigCache(
+    std::unique_ptr<const ModuleConfigCache> configCache) {
+  configCache_ = std::move(configCache);
+}
+
+std::string ModuleRegistry::snapshotConfigs(const std::string &buildId) {
+  SystraceSection s_("ModuleRegistry::snapshotConfigs");
+  ModuleConfigCache::Builder builder;
+  for (size_t index = 0; index < modules_.size(); index++) {
+    std::string name = normalizeName(modules_[index]->getName());
+    auto methods = configuredMethods_.find(index);
+    if (methods != configuredMethods_.end()) {
+      builder.addModule(std::move(name), index, methods->second);
+    } else if (configCache_) {
+      // Carry over what the previous snapshot knew about this module.
+      auto cached = configCache_->find(name);
+      if (cached.hasValue() && cached->index == index && cached->hasMethods) {
+        builder.addModule(std::move(name), index, std::move(cached->methods));
+      } else {
+        builder.addModule(std::move(name), index);
+      }
+    } else {
+      builder.addModule(std::move(name), index);
+    }
+  }
+  return builder.build(buildId);
+}
+
+folly::Optional<ModuleConfigCache::Module> ModuleRegistry::findCachedModule(
+    const std::string &name) {
+  if (!configCache_) {
+    return folly::none;
+  }
+  auto cached = configCache_->find(name);
+  if (!cached.hasValue()) {
+    return folly::none;
+  }
+  // Only the module being configured is checked, which is what saves
+  // normalizing every other module name.
+  if (cached->index >= modules_.size() ||
+      normalizeName(modules_[cached->index]->getName()) != name) {
+    LOG(WARNING) << "Dropping stale native module config cache at module "
+                 << name;
+    configCache_.reset();
+    return folly::none;
+  }
+  return cached;
+}
+
 folly::Optional<ModuleConfig> ModuleRegistry::getConfig(
     const std::string &name) {
   SystraceSection s("ModuleRegistry::getConfig", "module", name);
 
-  // Initialize modulesByName_
-  if (modulesByName_.empty() && !modules_.empty()) {
-    moduleNames();
-  }
+  auto cached = findCachedModule(name);
+  size_t index;
 
-  auto it = modulesByName_.find(name);
-
-  if (it == modulesByName_.end()) {
-    if (unknownModules_.find(name) != unknownModules_.end()) {
-      return folly::none;
+  if (cached.hasValue()) {
+    index = cached->index;
+  } else {
+    // Initialize modulesByName_
+    if (modulesByName_.empty() && !modules_.empty()) {
+      moduleNames();
     }
-    if (!moduleNotFoundCallback_ || !moduleNotFoundCallback_(name) ||
-        (it = modulesByName_.find(name)) == modulesByName_.end()) {
-      unknownModules_.insert(name);
-      return folly::none;
+
+    auto it = modulesByName_.find(name);
+
+    if (it == modulesByName_.end()) {
+      if (unknownModules_.find(name) != unknownModules_.end()) {
+        return folly::none;
+      }
+      if (!moduleNotFoundCallback_ || !moduleNotFoundCallback_(name) ||
+          (it = modulesByName_.find(name)) == modulesByName_.end()) {
+        unknownModules_.insert(name);
+        return folly::none;
+      }
     }
+    index = it->second;
   }
-  size_t index = it->second;
 
   CHECK(index < modules_.size());
   NativeModule *module = modules_[index].get();
@@ -115,15 +172,34 @@ folly::Optional<ModuleConfig> ModuleRegistry::getConfig(
   // string name, object constants, array methodNames (methodId is index),
   // [array promiseMethodIds], [array syncMethodIds]
   folly::dynamic config = folly::dynamic::array(name);
+  bool lazyConstants = module->hasLazyConstants();
 
-  {
+  if (lazyConstants) {
+    // Read on demand through getConstant().
+    config.push_back(nullptr);
+  } else {
     SystraceSection s_("ModuleRegistry::getConstants", "module", name);
+    bool hasLogger(ReactMarker::logTaggedMarker);
+    if (hasLogger) {
+      ReactMarker::logTaggedMarker(
+          ReactMarker::NATIVE_MODULE_CONSTANTS_START, name.c_str());
+    }
     config.push_back(module->getConstants());
+    if (hasLogger) {
+      ReactMarker::logTaggedMarker(
+          ReactMarker::NATIVE_MODULE_CONSTANTS_STOP, name.c_str());
+    }
   }
 
   {
     SystraceSection s_("ModuleRegistry::getMethods", "module", name);
-    std::vector<MethodDescriptor> methods = module->getMethods();
+    std::vector<MethodDescriptor> methods;
+    if (cached.hasValue() && cached->hasMethods) {
+      methods = std::move(cached->methods);
+    } else {
+      methods = module->getMethods();
+    }
+    configuredMethods_[index] = methods;
 
     folly::dynamic methodNames = folly::dynamic::array;
     folly::dynamic promiseMethodIds = folly::dynamic::array;
@@ -150,12 +226,45 @@ folly::Optional<ModuleConfig> ModuleRegistry::getConfig(
     }
   }
 
-  if (config.size() == 2 && config[1].empty()) {
+  if (!lazyConstants && config.size() == 2 && config[1].empty()) {
     // no constants or methods
     return folly::none;
   } else {
-    return ModuleConfig{index, config};
+    return ModuleConfig{index, config, lazyConstants};
+  }
+}
+
+std::vector<std::string> ModuleRegistry::getConstantNames(size_t moduleId) {
+  if (moduleId >= modules_.size()) {
+    throw std::runtime_error(folly::to<std::string>(
+        "moduleId ", moduleId, " out of range [0..", modules_.size(), ")"));
+  }
+  return modules_[moduleId]->getConstantNames();
+}
+
+folly::dynamic ModuleRegistry::getConstant(
+    size_t moduleId,
+    const std::string &name) {
+  if (moduleId >= modules_.size()) {
+    throw std::runtime_error(folly::to<std::string>(
+        "moduleId ", moduleId, " out of range [0..", modules_.size(), ")"));
+  }
+  NativeModule *module = modules_[moduleId].get();
+  std::string moduleName = module->getName();
+  SystraceSection s_(
+      "ModuleRegistry::getConstant", "module", moduleName, "name", name);
+
+  bool hasLogger(ReactMarker::logTaggedMarker);
+  if (hasLogger) {
+    ReactMarker::logTaggedMarker(
+        ReactMarker::NATIVE_MODULE_CONSTANTS_START, moduleName.c_str());
+  }
+  folly::dynamic constant = module->getConstant(name);
+  if (hasLogger) {
+    ReactMarker::logTaggedMarker(
+        ReactMarker::NATIVE_MODULE_CONSTANTS_STOP, moduleName.c_str());
   }
+  return constant;
 }
 
 void ModuleRegistry::callNativeMethod(
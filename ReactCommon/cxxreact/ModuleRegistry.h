@@ -12,6 +12,7 @@
 #include <vector>
 
 #include <cxxreact/JSExecutor.h>
+#include <cxxreact/ModuleConfigCache.h>
 #include <folly/Optional.h>
 #include <folly/dynamic.h>
 
@@ -27,6 +28,9 @@ class NativeModule;
 struct ModuleConfig {
   size_t index;
   folly::dynamic config;
+  // When set, the constants slot of config is null and the constants must
+  // be read one at a time with ModuleRegistry::getConstant().
+  bool lazyConstants{false};
 };
 
 class RN_EXPORT ModuleRegistry {
@@ -49,6 +53,24 @@ class RN_EXPORT ModuleRegistry {
 
   folly::Optional<ModuleConfig> getConfig(const std::string &name);
 
+  /**
+   * Lets getConfig() take module indices and method tables from a snapshot
+   * written by a previous launch of the same build.  Entries are checked
+   * against the registered module before use, and the whole cache is
+   * dropped on the first mismatch.
+   */
+  void setConfigCache(std::unique_ptr<const ModuleConfigCache> configCache);
+
+  /**
+   * Serializes the names of all registered modules, plus the method tables
+   * of every module whose config has been built so far, for use with
+   * setConfigCache() on the next launch.
+   */
+  std::string snapshotConfigs(const std::string &buildId);
+
+  std::vector<std::string> getConstantNames(size_t moduleId);
+  folly::dynamic getConstant(size_t moduleId, const std::string &name);
+
   void callNativeMethod(
       unsigned int moduleId,
       unsigned int methodId,
@@ -76,6 +98,14 @@ class RN_EXPORT ModuleRegistry {
   // registry.
   std::unordered_set<std::string> unknownModules_;
 
+  std::unique_ptr<const ModuleConfigCache> configCache_;
+
+  // Method tables computed by getConfig(), kept for snapshotConfigs().
+  std::unordered_map<size_t, std::vector<MethodDescriptor>> configuredMethods_;
+
+  folly::Optional<ModuleConfigCache::Module> findCachedModule(
+      const std::string &name);
+
   // Function will be called if a module was requested but was not found.
   // If the function returns true, ModuleRegistry will try to find the module
   // again (assuming it's registered) If the functon returns false,
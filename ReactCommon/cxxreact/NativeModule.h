@@ -33,11 +33,48 @@ class NativeModule {
   virtual std::string getName() = 0;
   virtual std::vector<MethodDescriptor> getMethods() = 0;
   virtual folly::dynamic getConstants() = 0;
+
+  // Modules which return true here have their constants exposed to JS one
+  // key at a time, through getConstantNames() and getConstant(), instead
+  // of being converted in full by getConstants() when the module is first
+  // required.  The defaults call getConstants() once and keep the result.
+  virtual bool hasLazyConstants() {
+    return false;
+  }
+  virtual std::vector<std::string> getConstantNames() {
+    std::vector<std::string> names;
+    const folly::dynamic &constants = getCachedConstants();
+    if (constants.isObject()) {
+      for (const auto &key : constants.keys()) {
+        names.push_back(key.asString());
+      }
+    }
+    return names;
+  }
+  virtual folly::dynamic getConstant(const std::string &name) {
+    const folly::dynamic &constants = getCachedConstants();
+    if (!constants.isObject()) {
+      return nullptr;
+    }
+    auto it = constants.find(name);
+    return it == constants.items().end() ? nullptr : it->second;
+  }
+
   virtual void
   invoke(unsigned int reactMethodId, folly::dynamic &&params, int callId) = 0;
   virtual MethodCallResult callSerializableNativeHook(
       unsigned int reactMethodId,
       folly::dynamic &&args) = 0;
+
+ private:
+  const folly::dynamic &getCachedConstants() {
+    if (!cachedConstants_) {
+      cachedConstants_ = getConstants();
+    }
+    return *cachedConstants_;
+  }
+
+  folly::Optional<folly::dynamic> cachedConstants_;
 };
 
 } // namespace react
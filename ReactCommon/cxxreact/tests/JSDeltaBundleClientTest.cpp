@@ -131,3 +131,70 @@ TEST(JSDeltaBundleClient, Clear) {
 
   EXPECT_STREQ(client.getStartupCode()->c_str(), "");
 }
+
+TEST(JSDeltaBundleClient, GetModuleCode) {
+  JSDeltaBundleClient client;
+
+  folly::dynamic delta1 = folly::parseJson(R"({
+    "base": true,
+    "revisionId": "rev0",
+    "pre": "pre",
+    "post": "post",
+    "modules": [
+      [0, "zero"],
+      [1, "one"]
+    ]
+  })");
+
+  client.patch(delta1);
+
+  auto startupCode = client.getStartupCode();
+
+  folly::dynamic delta2 = folly::parseJson(R"({
+    "base": false,
+    "revisionId": "rev1",
+    "modified": [
+      [0, "0"],
+      [1, "a much longer replacement for module one"]
+    ]
+  })");
+
+  client.patch(delta2);
+
+  EXPECT_EQ(client.getModuleCode(0), "0");
+  EXPECT_EQ(
+      client.getModuleCode(1), "a much longer replacement for module one");
+  ASSERT_THROW(client.getModuleCode(2), JSModulesUnbundle::ModuleNotFound);
+  EXPECT_EQ(client.moduleCount(), 2);
+
+  // Startup code handed out earlier is not affected by later patches.
+  client.clear();
+  EXPECT_STREQ(startupCode->c_str(), "pre\npost\n");
+}
+
+TEST(JSDeltaBundleClient, PatchManyModules) {
+  // A tiny segment size forces modules across segments and compaction.
+  JSDeltaBundleClient client(64);
+
+  folly::dynamic modules = folly::dynamic::array;
+  for (int i = 0; i < 100; i++) {
+    modules.push_back(folly::dynamic::array(i, folly::to<std::string>(i)));
+  }
+  client.patch(folly::dynamic::object("base", true)("modules", modules));
+
+  for (int round = 0; round < 10; round++) {
+    folly::dynamic modified = folly::dynamic::array;
+    for (int i = 0; i < 100; i += 2) {
+      modified.push_back(folly::dynamic::array(
+          i, folly::to<std::string>(i, ":", std::string(round * 10, 'x'))));
+    }
+    client.patch(folly::dynamic::object("base", false)("modified", modified)(
+        "deleted", folly::dynamic::array(round * 2 + 1)));
+  }
+
+  EXPECT_EQ(client.moduleCount(), 90);
+  EXPECT_EQ(client.getModule(42).code, "42:" + std::string(90, 'x'));
+  EXPECT_EQ(client.getModule(43).code, "43");
+  ASSERT_THROW(client.getModule(19), JSModulesUnbundle::ModuleNotFound);
+  EXPECT_EQ(client.getModule(21).code, "21");
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include <cxxreact/ModuleConfigCache.h>
+
+using namespace facebook::react;
+
+namespace {
+
+std::string buildSnapshot(const std::string &buildId) {
+  ModuleConfigCache::Builder builder;
+  builder.addModule(
+      "Networking",
+      3,
+      {MethodDescriptor("sendRequest", "async"),
+       MethodDescriptor("abortRequest", "promise")});
+  builder.addModule("AppState", 0);
+  builder.addModule("Timing", 7, {});
+  return builder.build(buildId);
+}
+
+std::unique_ptr<const ModuleConfigCache> load(
+    std::string data,
+    const std::string &buildId) {
+  return ModuleConfigCache::load(
+      std::make_unique<JSBigStdString>(std::move(data)), buildId);
+}
+
+} // namespace
+
+TEST(ModuleConfigCacheTest, roundTrip) {
+  auto cache = load(buildSnapshot("build-1"), "build-1");
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(cache->moduleCount(), 3);
+
+  auto networking = cache->find("Networking");
+  ASSERT_TRUE(networking.hasValue());
+  EXPECT_EQ(networking->index, 3);
+  EXPECT_TRUE(networking->hasMethods);
+  ASSERT_EQ(networking->methods.size(), 2);
+  EXPECT_EQ(networking->methods[1].name, "abortRequest");
+  EXPECT_EQ(networking->methods[1].type, "promise");
+
+  auto appState = cache->find("AppState");
+  ASSERT_TRUE(appState.hasValue());
+  EXPECT_EQ(appState->index, 0);
+  EXPECT_FALSE(appState->hasMethods);
+
+  auto timing = cache->find("Timing");
+  ASSERT_TRUE(timing.hasValue());
+  EXPECT_TRUE(timing->hasMethods);
+  EXPECT_TRUE(timing->methods.empty());
+
+  EXPECT_FALSE(cache->find("Timin").hasValue());
+  EXPECT_FALSE(cache->find("Unknown").hasValue());
+}
+
+TEST(ModuleConfigCacheTest, rejectsOtherBuild) {
+  EXPECT_EQ(load(buildSnapshot("build-1"), "build-2"), nullptr);
+}
+
+TEST(ModuleConfigCacheTest, rejectsCorruptData) {
+  auto snapshot = buildSnapshot("build-1");
+  EXPECT_EQ(load(snapshot.substr(0, snapshot.size() - 1), "build-1"), nullptr);
+  EXPECT_EQ(load(snapshot + "x", "build-1"), nullptr);
+  EXPECT_EQ(load("", "build-1"), nullptr);
+
+  auto badMagic = snapshot;
+  badMagic[0] = 'X';
+  EXPECT_EQ(load(badMagic, "build-1"), nullptr);
+}
+
+TEST(ModuleConfigCacheTest, lastAddedModuleWins) {
+  ModuleConfigCache::Builder builder;
+  builder.addModule("Dup", 0);
+  builder.addModule("Dup", 4);
+  auto cache = load(builder.build("build-1"), "build-1");
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(cache->moduleCount(), 1);
+  EXPECT_EQ(cache->find("Dup")->index, 4);
+}
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cxxreact/CxxModule.h>
+#include <cxxreact/CxxNativeModule.h>
+#include <cxxreact/MessageQueueThread.h>
+#include <cxxreact/ModuleRegistry.h>
+#include <cxxreact/NativeModule.h>
+
+using namespace facebook::react;
+using facebook::xplat::module::CxxModule;
+
+namespace {
+
+class TestNativeModule : public NativeModule {
+ public:
+  TestNativeModule(std::string name, bool lazyConstants)
+      : name_(std::move(name)), lazyConstants_(lazyConstants) {}
+
+  std::string getName() override {
+    return name_;
+  }
+
+  std::vector<MethodDescriptor> getMethods() override {
+    getMethodsCount++;
+    return {MethodDescriptor("doWork", "async")};
+  }
+
+  folly::dynamic getConstants() override {
+    getConstantsCount++;
+    return folly::dynamic::object("A", 1)("B", "two");
+  }
+
+  bool hasLazyConstants() override {
+    return lazyConstants_;
+  }
+
+  void invoke(unsigned int, folly::dynamic &&, int) override {}
+
+  MethodCallResult callSerializableNativeHook(unsigned int, folly::dynamic &&)
+      override {
+    return folly::none;
+  }
+
+  int getConstantsCount{0};
+  int getMethodsCount{0};
+
+ private:
+  std::string name_;
+  bool lazyConstants_;
+};
+
+class InlineMessageQueueThread : public MessageQueueThread {
+ public:
+  void runOnQueue(std::function<void()> &&func) override {
+    func();
+  }
+  void runOnQueueSync(std::function<void()> &&func) override {
+    func();
+  }
+  void quitSynchronous() override {}
+};
+
+class CountingCxxModule : public CxxModule {
+ public:
+  explicit CountingCxxModule(std::vector<std::string> &calls)
+      : calls_(calls) {}
+
+  std::string getName() override {
+    return "Counting";
+  }
+
+  std::vector<Method> getMethods() override {
+    return {Method("first", [this] { calls_.push_back("first"); }),
+            Method("second", [this] { calls_.push_back("second"); })};
+  }
+
+ private:
+  std::vector<std::string> &calls_;
+};
+
+std::unique_ptr<NativeModule> makeCountingModule(
+    std::vector<std::string> &calls) {
+  return std::make_unique<CxxNativeModule>(
+      std::weak_ptr<Instance>(),
+      "Counting",
+      [&calls] { return std::make_unique<CountingCxxModule>(calls); },
+      std::make_shared<InlineMessageQueueThread>());
+}
+
+} // namespace
+
+TEST(ModuleRegistryTest, eagerConstantsAreInlinedInConfig) {
+  auto module = std::make_unique<TestNativeModule>("RCTEager", false);
+  auto modulePtr = module.get();
+  std::vector<std::unique_ptr<NativeModule>> modules;
+  modules.push_back(std::move(module));
+  ModuleRegistry registry(std::move(modules));
+
+  auto config = registry.getConfig("Eager");
+  ASSERT_TRUE(config.hasValue());
+  EXPECT_FALSE(config->lazyConstants);
+  EXPECT_EQ(config->config[1]["A"], 1);
+  EXPECT_EQ(modulePtr->getConstantsCount, 1);
+}
+
+TEST(ModuleRegistryTest, lazyConstantsAreReadOnDemand) {
+  auto module = std::make_unique<TestNativeModule>("Lazy", true);
+  auto modulePtr = module.get();
+  std::vector<std::unique_ptr<NativeModule>> modules;
+  modules.push_back(std::move(module));
+  ModuleRegistry registry(std::move(modules));
+
+  auto config = registry.getConfig("Lazy");
+  ASSERT_TRUE(config.hasValue());
+  EXPECT_TRUE(config->lazyConstants);
+  EXPECT_TRUE(config->config[1].isNull());
+  EXPECT_EQ(config->config[2][0], "doWork");
+  EXPECT_EQ(modulePtr->getConstantsCount, 0);
+
+  auto names = registry.getConstantNames(config->index);
+  EXPECT_EQ(names.size(), 2);
+  EXPECT_EQ(registry.getConstant(config->index, "B"), "two");
+  EXPECT_TRUE(registry.getConstant(config->index, "C").isNull());
+
+  // The default implementations build the constants once.
+  EXPECT_EQ(modulePtr->getConstantsCount, 1);
+}
+
+TEST(ModuleRegistryTest, configCacheSkipsMethodReflection) {
+  std::string snapshot;
+  {
+    std::vector<std::unique_ptr<NativeModule>> modules;
+    modules.push_back(std::make_unique<TestNativeModule>("RCTFirst", false));
+    modules.push_back(std::make_unique<TestNativeModule>("Second", false));
+    ModuleRegistry registry(std::move(modules));
+    ASSERT_TRUE(registry.getConfig("Second").hasValue());
+    snapshot = registry.snapshotConfigs("build-1");
+  }
+
+  auto first = std::make_unique<TestNativeModule>("RCTFirst", false);
+  auto second = std::make_unique<TestNativeModule>("Second", false);
+  auto firstPtr = first.get();
+  auto secondPtr = second.get();
+  std::vector<std::unique_ptr<NativeModule>> modules;
+  modules.push_back(std::move(first));
+  modules.push_back(std::move(second));
+  ModuleRegistry registry(std::move(modules));
+  registry.setConfigCache(ModuleConfigCache::load(
+      std::make_unique<JSBigStdString>(snapshot), "build-1"));
+
+  auto config = registry.getConfig("Second");
+  ASSERT_TRUE(config.hasValue());
+  EXPECT_EQ(config->index, 1);
+  EXPECT_EQ(config->config[2][0], "doWork");
+  EXPECT_EQ(secondPtr->getMethodsCount, 0);
+
+  // Only the name of First was recorded, so its methods are reflected.
+  config = registry.getConfig("First");
+  ASSERT_TRUE(config.hasValue());
+  EXPECT_EQ(config->index, 0);
+  EXPECT_EQ(firstPtr->getMethodsCount, 1);
+}
+
+TEST(ModuleRegistryTest, staleConfigCacheIsDropped) {
+  ModuleConfigCache::Builder builder;
+  builder.addModule("Moved", 1, {MethodDescriptor("stale", "sync")});
+  auto cache = ModuleConfigCache::load(
+      std::make_unique<JSBigStdString>(builder.build("build-1")), "build-1");
+  ASSERT_NE(cache, nullptr);
+
+  auto module = std::make_unique<TestNativeModule>("Moved", false);
+  auto modulePtr = module.get();
+  std::vector<std::unique_ptr<NativeModule>> modules;
+  modules.push_back(std::move(module));
+  ModuleRegistry registry(std::move(modules));
+  registry.setConfigCache(std::move(cache));
+
+  auto config = registry.getConfig("Moved");
+  ASSERT_TRUE(config.hasValue());
+  EXPECT_EQ(config->index, 0);
+  EXPECT_EQ(config->config[2][0], "doWork");
+  EXPECT_EQ(modulePtr->getMethodsCount, 1);
+}
+
+TEST(ModuleRegistryTest, asyncCallsAfterCachedConfigAreDelivered) {
+  std::vector<std::string> calls;
+  std::string snapshot;
+  {
+    std::vector<std::unique_ptr<NativeModule>> modules;
+    modules.push_back(makeCountingModule(calls));
+    ModuleRegistry registry(std::move(modules));
+    ASSERT_TRUE(registry.getConfig("Counting").hasValue());
+    snapshot = registry.snapshotConfigs("build-1");
+  }
+
+  std::vector<std::unique_ptr<NativeModule>> modules;
+  modules.push_back(makeCountingModule(calls));
+  ModuleRegistry registry(std::move(modules));
+  registry.setConfigCache(ModuleConfigCache::load(
+      std::make_unique<JSBigStdString>(snapshot), "build-1"));
+
+  auto config = registry.getConfig("Counting");
+  ASSERT_TRUE(config.hasValue());
+  EXPECT_EQ(config->config[2][1], "second");
+
+  registry.callNativeMethod(config->index, 1, folly::dynamic::array(), -1);
+  registry.callNativeMethod(config->index, 0, folly::dynamic::array(), -1);
+  EXPECT_EQ(calls, (std::vector<std::string>{"second", "first"}));
+}
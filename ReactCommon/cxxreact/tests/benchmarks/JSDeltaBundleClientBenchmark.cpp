@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cxxreact/JSDeltaBundleClient.h>
+#include <folly/Conv.h>
+#include <folly/dynamic.h>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+// Roughly the size of a transformed module in a large app.
+static std::string moduleCode(int64_t id, size_t revision) {
+  return folly::to<std::string>(
+      "__d(function(global, require, module, exports) {",
+      std::string(1500, ' '),
+      "}, ",
+      id,
+      ", [], \"rev",
+      revision,
+      "\");");
+}
+
+static folly::dynamic baseDelta(int64_t moduleCount) {
+  folly::dynamic modules = folly::dynamic::array;
+  for (int64_t i = 0; i < moduleCount; i++) {
+    modules.push_back(folly::dynamic::array(i, moduleCode(i, 0)));
+  }
+  return folly::dynamic::object("base", true)("pre", "var __DEV__=true;")(
+      "post", "require(0);")("modules", std::move(modules));
+}
+
+// Models a fast refresh touching one percent of the modules.
+static folly::dynamic incrementalDelta(int64_t moduleCount, size_t revision) {
+  folly::dynamic modified = folly::dynamic::array;
+  for (int64_t i = 0; i < moduleCount; i += 100) {
+    modified.push_back(folly::dynamic::array(i, moduleCode(i, revision)));
+  }
+  return folly::dynamic::object("base", false)("modified", std::move(modified));
+}
+
+static void baseReload(benchmark::State &state) {
+  auto delta = baseDelta(state.range(0));
+  JSDeltaBundleClient client;
+  for (auto _ : state) {
+    client.patch(delta);
+    benchmark::DoNotOptimize(client.getStartupCode());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(baseReload)->Arg(1000)->Arg(10000)->Arg(30000);
+
+static void incrementalReload(benchmark::State &state) {
+  JSDeltaBundleClient client;
+  client.patch(baseDelta(state.range(0)));
+  folly::dynamic deltas[] = {incrementalDelta(state.range(0), 1),
+                             incrementalDelta(state.range(0), 22)};
+  size_t revision = 0;
+  for (auto _ : state) {
+    client.patch(deltas[revision++ % 2]);
+    benchmark::DoNotOptimize(client.getStartupCode());
+  }
+}
+BENCHMARK(incrementalReload)->Arg(1000)->Arg(10000)->Arg(30000);
+
+static void requireAllModules(benchmark::State &state) {
+  JSDeltaBundleClient client;
+  client.patch(baseDelta(state.range(0)));
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); i++) {
+      benchmark::DoNotOptimize(client.getModule(i));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(requireAllModules)->Arg(1000)->Arg(10000)->Arg(30000);
+
+static void viewAllModules(benchmark::State &state) {
+  JSDeltaBundleClient client;
+  client.patch(baseDelta(state.range(0)));
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); i++) {
+      benchmark::DoNotOptimize(client.getModuleCode(i));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(viewAllModules)->Arg(1000)->Arg(10000)->Arg(30000);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
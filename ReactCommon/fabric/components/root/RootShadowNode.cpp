@@ -46,5 +46,63 @@ RootShadowNode::Unshared RootShadowNode::clone(
   return newRootShadowNode;
 }
 
+void RootShadowNode::enableIndex() const {
+  indexEnabled_ = true;
+}
+
+ShadowNodeIndex const *RootShadowNode::getIndex() const {
+  if (!indexEnabled_) {
+    return nullptr;
+  }
+
+  if (indexLookupCount_++ == 0) {
+    // The first lookup searches the tree; building the index costs more.
+    return nullptr;
+  }
+
+  std::call_once(indexOnceFlag_, [this]() {
+    SystraceSection s("RootShadowNode::buildIndex");
+    index_ = std::make_unique<ShadowNodeIndex const>(*this);
+  });
+  return index_.get();
+}
+
+void RootShadowNode::inheritHitTestIndex(
+    RootShadowNode const &previousRootShadowNode) const {
+  auto previousHitTestIndex = HitTestIndex::Shared{};
+  {
+    std::lock_guard<std::mutex> lock(previousRootShadowNode.hitTestIndexMutex_);
+    previousHitTestIndex = previousRootShadowNode.hitTestIndex_
+        ? previousRootShadowNode.hitTestIndex_
+        : previousRootShadowNode.previousHitTestIndex_;
+  }
+
+  if (!previousHitTestIndex) {
+    return;
+  }
+
+  // The previous tree is alive for the duration of the call, so the index
+  // can be pruned against this one now.
+  auto prunedHitTestIndex = HitTestIndex::prune(*this, *previousHitTestIndex);
+
+  std::lock_guard<std::mutex> lock(hitTestIndexMutex_);
+  previousHitTestIndex_ = std::move(prunedHitTestIndex);
+}
+
+HitTestIndex::Shared RootShadowNode::getHitTestIndex() const {
+  if (!indexEnabled_) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(hitTestIndexMutex_);
+  if (!hitTestIndex_) {
+    hitTestIndex_ = std::make_shared<HitTestIndex const>(
+        *this, previousHitTestIndex_.get());
+    // Everything reusable is now part of the new index.
+    previousHitTestIndex_ = nullptr;
+  }
+  return hitTestIndex_;
+}
+
 } // namespace react
 } // namespace facebook
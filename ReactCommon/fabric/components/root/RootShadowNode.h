@@ -7,11 +7,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include <react/components/root/RootProps.h>
 #include <react/components/view/ConcreteViewShadowNode.h>
+#include <react/core/HitTestIndex.h>
 #include <react/core/LayoutContext.h>
+#include <react/core/ShadowNodeIndex.h>
 
 namespace facebook {
 namespace react {
@@ -47,6 +51,44 @@ class RootShadowNode final
   RootShadowNode::Unshared clone(
       LayoutConstraints const &layoutConstraints,
       LayoutContext const &layoutContext) const;
+
+  /*
+   * Allows lookups relative to this node to use a `ShadowNodeIndex` of the
+   * tree. Must be called only after the tree is sealed for good, i.e. when it
+   * is committed. The index is built lazily on the second lookup, so
+   * revisions which are only looked up once (e.g. by `setNativeProps`) never
+   * pay for it, while a burst of `measure` calls on the same revision shares
+   * one index.
+   */
+  void enableIndex() const;
+
+  /*
+   * Makes the hit-test index of this tree (once built) reuse the parts of
+   * the index of `previousRootShadowNode` (or of the one that node would
+   * have reused) describing subtrees shared with this tree. Only those
+   * parts are kept, so older revisions are not retained.
+   * Call on committed trees only, before they are shared.
+   */
+  void inheritHitTestIndex(RootShadowNode const &previousRootShadowNode) const;
+
+  /*
+   * Returns the hit-test index of the tree, building it if needed, or
+   * `nullptr` if the index is not enabled (see `enableIndex`).
+   */
+  HitTestIndex::Shared getHitTestIndex() const;
+
+ protected:
+  ShadowNodeIndex const *getIndex() const override;
+
+ private:
+  mutable std::atomic<bool> indexEnabled_{false};
+  mutable std::atomic<int> indexLookupCount_{0};
+  mutable std::once_flag indexOnceFlag_;
+  mutable std::unique_ptr<ShadowNodeIndex const> index_;
+
+  mutable std::mutex hitTestIndexMutex_;
+  mutable HitTestIndex::Shared hitTestIndex_;
+  mutable HitTestIndex::Shared previousHitTestIndex_;
 };
 
 } // namespace react
@@ -10,88 +10,101 @@
 namespace facebook {
 namespace react {
 
-static jsi::Value scrollViewMetricsPayload(
+ScrollViewEventPayload::ScrollViewEventPayload(
+    ScrollViewMetrics const &scrollViewMetrics)
+    : scrollViewMetrics_(scrollViewMetrics) {}
+
+jsi::Value ScrollViewEventPayload::asJSIValue(
     jsi::Runtime &runtime,
-    const ScrollViewMetrics &scrollViewMetrics) {
+    EventPayloadPropertyNames &propertyNames) const {
+  auto setProperty = [&](jsi::Object &object, char const *name, double value) {
+    object.setProperty(runtime, propertyNames.get(runtime, name), value);
+  };
+
   auto payload = jsi::Object(runtime);
 
   {
     auto contentOffset = jsi::Object(runtime);
-    contentOffset.setProperty(runtime, "x", scrollViewMetrics.contentOffset.x);
-    contentOffset.setProperty(runtime, "y", scrollViewMetrics.contentOffset.y);
-    payload.setProperty(runtime, "contentOffset", contentOffset);
+    setProperty(contentOffset, "x", scrollViewMetrics_.contentOffset.x);
+    setProperty(contentOffset, "y", scrollViewMetrics_.contentOffset.y);
+    payload.setProperty(
+        runtime, propertyNames.get(runtime, "contentOffset"), contentOffset);
   }
 
   {
     auto contentInset = jsi::Object(runtime);
-    contentInset.setProperty(
-        runtime, "top", scrollViewMetrics.contentInset.top);
-    contentInset.setProperty(
-        runtime, "left", scrollViewMetrics.contentInset.left);
-    contentInset.setProperty(
-        runtime, "bottom", scrollViewMetrics.contentInset.bottom);
-    contentInset.setProperty(
-        runtime, "right", scrollViewMetrics.contentInset.right);
-    payload.setProperty(runtime, "contentInset", contentInset);
+    setProperty(contentInset, "top", scrollViewMetrics_.contentInset.top);
+    setProperty(contentInset, "left", scrollViewMetrics_.contentInset.left);
+    setProperty(
+        contentInset, "bottom", scrollViewMetrics_.contentInset.bottom);
+    setProperty(contentInset, "right", scrollViewMetrics_.contentInset.right);
+    payload.setProperty(
+        runtime, propertyNames.get(runtime, "contentInset"), contentInset);
   }
 
   {
     auto contentSize = jsi::Object(runtime);
-    contentSize.setProperty(
-        runtime, "width", scrollViewMetrics.contentSize.width);
-    contentSize.setProperty(
-        runtime, "height", scrollViewMetrics.contentSize.height);
-    payload.setProperty(runtime, "contentSize", contentSize);
+    setProperty(contentSize, "width", scrollViewMetrics_.contentSize.width);
+    setProperty(contentSize, "height", scrollViewMetrics_.contentSize.height);
+    payload.setProperty(
+        runtime, propertyNames.get(runtime, "contentSize"), contentSize);
   }
 
   {
     auto containerSize = jsi::Object(runtime);
-    containerSize.setProperty(
-        runtime, "width", scrollViewMetrics.containerSize.width);
-    containerSize.setProperty(
-        runtime, "height", scrollViewMetrics.containerSize.height);
-    payload.setProperty(runtime, "layoutMeasurement", containerSize);
+    setProperty(
+        containerSize, "width", scrollViewMetrics_.containerSize.width);
+    setProperty(
+        containerSize, "height", scrollViewMetrics_.containerSize.height);
+    payload.setProperty(
+        runtime,
+        propertyNames.get(runtime, "layoutMeasurement"),
+        containerSize);
   }
 
-  payload.setProperty(runtime, "zoomScale", scrollViewMetrics.zoomScale);
+  setProperty(payload, "zoomScale", scrollViewMetrics_.zoomScale);
 
   return payload;
 }
 
 void ScrollViewEventEmitter::onScroll(
     const ScrollViewMetrics &scrollViewMetrics) const {
-  dispatchScrollViewEvent("scroll", scrollViewMetrics);
+  static auto const type =
+      EventType{"scroll", EventType::Coalescing::Enabled};
+  dispatchScrollViewEvent(type, scrollViewMetrics);
 }
 
 void ScrollViewEventEmitter::onScrollBeginDrag(
     const ScrollViewMetrics &scrollViewMetrics) const {
-  dispatchScrollViewEvent("scrollBeginDrag", scrollViewMetrics);
+  static auto const type = EventType{"scrollBeginDrag"};
+  dispatchScrollViewEvent(type, scrollViewMetrics);
 }
 
 void ScrollViewEventEmitter::onScrollEndDrag(
     const ScrollViewMetrics &scrollViewMetrics) const {
-  dispatchScrollViewEvent("scrollEndDrag", scrollViewMetrics);
+  static auto const type = EventType{"scrollEndDrag"};
+  dispatchScrollViewEvent(type, scrollViewMetrics);
 }
 
 void ScrollViewEventEmitter::onMomentumScrollBegin(
     const ScrollViewMetrics &scrollViewMetrics) const {
-  dispatchScrollViewEvent("momentumScrollBegin", scrollViewMetrics);
+  static auto const type = EventType{"momentumScrollBegin"};
+  dispatchScrollViewEvent(type, scrollViewMetrics);
 }
 
 void ScrollViewEventEmitter::onMomentumScrollEnd(
     const ScrollViewMetrics &scrollViewMetrics) const {
-  dispatchScrollViewEvent("momentumScrollEnd", scrollViewMetrics);
+  static auto const type = EventType{"momentumScrollEnd"};
+  dispatchScrollViewEvent(type, scrollViewMetrics);
 }
 
 void ScrollViewEventEmitter::dispatchScrollViewEvent(
-    const std::string &name,
+    EventType type,
     const ScrollViewMetrics &scrollViewMetrics,
     EventPriority priority) const {
   dispatchEvent(
-      name,
-      [scrollViewMetrics](jsi::Runtime &runtime) {
-        return scrollViewMetricsPayload(runtime, scrollViewMetrics);
-      },
+      type,
+      std::make_shared<ScrollViewEventPayload>(scrollViewMetrics),
       priority);
 }
 
@@ -12,6 +12,7 @@
 #include <folly/dynamic.h>
 #include <react/components/view/ViewEventEmitter.h>
 #include <react/core/EventEmitter.h>
+#include <react/core/EventPayload.h>
 #include <react/graphics/Geometry.h>
 
 namespace facebook {
@@ -26,6 +27,21 @@ class ScrollViewMetrics {
   Float zoomScale;
 };
 
+/*
+ * Typed payload of scroll view events.
+ */
+class ScrollViewEventPayload final : public EventPayload {
+ public:
+  ScrollViewEventPayload(ScrollViewMetrics const &scrollViewMetrics);
+
+  jsi::Value asJSIValue(
+      jsi::Runtime &runtime,
+      EventPayloadPropertyNames &propertyNames) const override;
+
+ private:
+  ScrollViewMetrics scrollViewMetrics_;
+};
+
 class ScrollViewEventEmitter;
 
 using SharedScrollViewEventEmitter =
@@ -43,7 +59,7 @@ class ScrollViewEventEmitter : public ViewEventEmitter {
 
  private:
   void dispatchScrollViewEvent(
-      const std::string &name,
+      EventType type,
       const ScrollViewMetrics &scrollViewMetrics,
       EventPriority priority = EventPriority::AsynchronousBatched) const;
 };
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+#include <react/components/scrollview/ScrollViewEventEmitter.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * The `ValueFactory` based payload which `ScrollViewEventPayload` replaced;
+ * both must produce the same JavaScript value.
+ */
+static jsi::Value referenceScrollViewMetricsPayload(
+    jsi::Runtime &runtime,
+    const ScrollViewMetrics &scrollViewMetrics) {
+  auto payload = jsi::Object(runtime);
+
+  {
+    auto contentOffset = jsi::Object(runtime);
+    contentOffset.setProperty(runtime, "x", scrollViewMetrics.contentOffset.x);
+    contentOffset.setProperty(runtime, "y", scrollViewMetrics.contentOffset.y);
+    payload.setProperty(runtime, "contentOffset", contentOffset);
+  }
+
+  {
+    auto contentInset = jsi::Object(runtime);
+    contentInset.setProperty(
+        runtime, "top", scrollViewMetrics.contentInset.top);
+    contentInset.setProperty(
+        runtime, "left", scrollViewMetrics.contentInset.left);
+    contentInset.setProperty(
+        runtime, "bottom", scrollViewMetrics.contentInset.bottom);
+    contentInset.setProperty(
+        runtime, "right", scrollViewMetrics.contentInset.right);
+    payload.setProperty(runtime, "contentInset", contentInset);
+  }
+
+  {
+    auto contentSize = jsi::Object(runtime);
+    contentSize.setProperty(
+        runtime, "width", scrollViewMetrics.contentSize.width);
+    contentSize.setProperty(
+        runtime, "height", scrollViewMetrics.contentSize.height);
+    payload.setProperty(runtime, "contentSize", contentSize);
+  }
+
+  {
+    auto containerSize = jsi::Object(runtime);
+    containerSize.setProperty(
+        runtime, "width", scrollViewMetrics.containerSize.width);
+    containerSize.setProperty(
+        runtime, "height", scrollViewMetrics.containerSize.height);
+    payload.setProperty(runtime, "layoutMeasurement", containerSize);
+  }
+
+  payload.setProperty(runtime, "zoomScale", scrollViewMetrics.zoomScale);
+
+  return payload;
+}
+
+class ScrollViewEventPayloadTest : public jsi::JSITestBase {};
+
+TEST_P(ScrollViewEventPayloadTest, matchesValueFactory) {
+  auto scrollViewMetrics = ScrollViewMetrics{};
+  scrollViewMetrics.contentSize = {320, 2000.5};
+  scrollViewMetrics.contentOffset = {0, 123.25};
+  scrollViewMetrics.contentInset = {1, 2, 3, 4};
+  scrollViewMetrics.containerSize = {320, 480};
+  scrollViewMetrics.zoomScale = 1.5;
+
+  auto propertyNames = EventPayloadPropertyNames{};
+  auto payload = ScrollViewEventPayload(scrollViewMetrics);
+  auto expected = jsi::dynamicFromValue(
+      rt, referenceScrollViewMetricsPayload(rt, scrollViewMetrics));
+
+  EXPECT_EQ(
+      jsi::dynamicFromValue(rt, payload.asJSIValue(rt, propertyNames)),
+      expected);
+  // Property names are cached by the first conversion.
+  EXPECT_EQ(
+      jsi::dynamicFromValue(rt, payload.asJSIValue(rt, propertyNames)),
+      expected);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    ScrollViewEventPayloadTest,
+    ::testing::ValuesIn(jsi::runtimeGenerators()));
+
+} // namespace react
+} // namespace facebook
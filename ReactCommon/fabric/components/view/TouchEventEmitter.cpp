@@ -7,76 +7,131 @@
 
 #include "TouchEventEmitter.h"
 
+#include <algorithm>
+
 namespace facebook {
 namespace react {
 
 #pragma mark - Touches
 
-static jsi::Value touchPayload(jsi::Runtime &runtime, Touch const &touch) {
+static jsi::Value touchPayload(
+    jsi::Runtime &runtime,
+    EventPayloadPropertyNames &propertyNames,
+    Touch const &touch) {
   auto object = jsi::Object(runtime);
-  object.setProperty(runtime, "locationX", touch.offsetPoint.x);
-  object.setProperty(runtime, "locationY", touch.offsetPoint.y);
-  object.setProperty(runtime, "pageX", touch.pagePoint.x);
-  object.setProperty(runtime, "pageY", touch.pagePoint.y);
-  object.setProperty(runtime, "screenX", touch.screenPoint.x);
-  object.setProperty(runtime, "screenY", touch.screenPoint.y);
-  object.setProperty(runtime, "identifier", touch.identifier);
-  object.setProperty(runtime, "target", touch.target);
-  object.setProperty(runtime, "timestamp", touch.timestamp * 1000);
-  object.setProperty(runtime, "force", touch.force);
+  auto setProperty = [&](char const *name, double value) {
+    object.setProperty(runtime, propertyNames.get(runtime, name), value);
+  };
+  setProperty("locationX", touch.offsetPoint.x);
+  setProperty("locationY", touch.offsetPoint.y);
+  setProperty("pageX", touch.pagePoint.x);
+  setProperty("pageY", touch.pagePoint.y);
+  setProperty("screenX", touch.screenPoint.x);
+  setProperty("screenY", touch.screenPoint.y);
+  setProperty("identifier", touch.identifier);
+  setProperty("target", touch.target);
+  setProperty("timestamp", touch.timestamp * 1000);
+  setProperty("force", touch.force);
   return object;
 }
 
 static jsi::Value touchesPayload(
     jsi::Runtime &runtime,
-    Touches const &touches) {
+    EventPayloadPropertyNames &propertyNames,
+    TouchEventPayload::TouchList const &touches) {
   auto array = jsi::Array(runtime, touches.size());
   int i = 0;
   for (auto const &touch : touches) {
-    array.setValueAtIndex(runtime, i++, touchPayload(runtime, touch));
+    array.setValueAtIndex(
+        runtime, i++, touchPayload(runtime, propertyNames, touch));
   }
   return array;
 }
 
-static jsi::Value touchEventPayload(
+#pragma mark - TouchEventPayload
+
+TouchEventPayload::TouchEventPayload(TouchEvent const &event)
+    : touches_(event.touches.begin(), event.touches.end()),
+      changedTouches_(event.changedTouches.begin(), event.changedTouches.end()),
+      targetTouches_(event.targetTouches.begin(), event.targetTouches.end()) {}
+
+jsi::Value TouchEventPayload::asJSIValue(
     jsi::Runtime &runtime,
-    TouchEvent const &event) {
+    EventPayloadPropertyNames &propertyNames) const {
   auto object = jsi::Object(runtime);
   object.setProperty(
-      runtime, "touches", touchesPayload(runtime, event.touches));
+      runtime,
+      propertyNames.get(runtime, "touches"),
+      touchesPayload(runtime, propertyNames, touches_));
   object.setProperty(
-      runtime, "changedTouches", touchesPayload(runtime, event.changedTouches));
+      runtime,
+      propertyNames.get(runtime, "changedTouches"),
+      touchesPayload(runtime, propertyNames, changedTouches_));
   object.setProperty(
-      runtime, "targetTouches", touchesPayload(runtime, event.targetTouches));
+      runtime,
+      propertyNames.get(runtime, "targetTouches"),
+      touchesPayload(runtime, propertyNames, targetTouches_));
   return object;
 }
 
+static bool haveSameIdentifiers(
+    TouchEventPayload::TouchList const &lhs,
+    TouchEventPayload::TouchList const &rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  // Identifiers are unique within a list, and lists are short.
+  for (auto const &touch : lhs) {
+    auto iterator =
+        std::find_if(rhs.begin(), rhs.end(), [&](Touch const &other) {
+          return other.identifier == touch.identifier;
+        });
+    if (iterator == rhs.end()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TouchEventPayload::isSupersededBy(
+    EventPayload const &newerPayload) const {
+  auto newerTouchEventPayload =
+      dynamic_cast<TouchEventPayload const *>(&newerPayload);
+  return newerTouchEventPayload &&
+      haveSameIdentifiers(
+             changedTouches_, newerTouchEventPayload->changedTouches_);
+}
+
+#pragma mark - TouchEventEmitter
+
 void TouchEventEmitter::dispatchTouchEvent(
-    std::string const &type,
+    EventType type,
     TouchEvent const &event,
     EventPriority const &priority) const {
-  dispatchEvent(
-      type,
-      [event](jsi::Runtime &runtime) {
-        return touchEventPayload(runtime, event);
-      },
-      priority);
+  dispatchEvent(type, std::make_shared<TouchEventPayload>(event), priority);
 }
 
 void TouchEventEmitter::onTouchStart(TouchEvent const &event) const {
-  dispatchTouchEvent("touchStart", event, EventPriority::AsynchronousBatched);
+  static auto const type = EventType{"touchStart"};
+  dispatchTouchEvent(type, event, EventPriority::AsynchronousBatched);
 }
 
 void TouchEventEmitter::onTouchMove(TouchEvent const &event) const {
-  dispatchTouchEvent("touchMove", event, EventPriority::AsynchronousBatched);
+  // A pending `touchMove` is dropped in favor of a newer one that moves the
+  // same touches; if other touches moved in between, both are delivered.
+  static auto const type =
+      EventType{"touchMove", EventType::Coalescing::Enabled};
+  dispatchTouchEvent(type, event, EventPriority::AsynchronousBatched);
 }
 
 void TouchEventEmitter::onTouchEnd(TouchEvent const &event) const {
-  dispatchTouchEvent("touchEnd", event, EventPriority::AsynchronousBatched);
+  static auto const type = EventType{"touchEnd"};
+  dispatchTouchEvent(type, event, EventPriority::AsynchronousBatched);
 }
 
 void TouchEventEmitter::onTouchCancel(TouchEvent const &event) const {
-  dispatchTouchEvent("touchCancel", event, EventPriority::AsynchronousBatched);
+  static auto const type = EventType{"touchCancel"};
+  dispatchTouchEvent(type, event, EventPriority::AsynchronousBatched);
 }
 
 } // namespace react
@@ -7,8 +7,10 @@
 
 #pragma once
 
+#include <better/small_vector.h>
 #include <react/components/view/TouchEvent.h>
 #include <react/core/EventEmitter.h>
+#include <react/core/EventPayload.h>
 #include <react/core/LayoutMetrics.h>
 #include <react/core/ReactPrimitives.h>
 #include <react/debug/DebugStringConvertible.h>
@@ -16,6 +18,32 @@
 namespace facebook {
 namespace react {
 
+/*
+ * Typed payload of touch events. Touches are stored inline (for up to two
+ * points of contact) instead of in hash sets.
+ */
+class TouchEventPayload final : public EventPayload {
+ public:
+  using TouchList = better::small_vector<Touch, 2>;
+
+  TouchEventPayload(TouchEvent const &event);
+
+  jsi::Value asJSIValue(
+      jsi::Runtime &runtime,
+      EventPayloadPropertyNames &propertyNames) const override;
+
+  /*
+   * `changedTouches` only lists the touches that changed, so a pending event
+   * is only superseded by one which changes the same touches.
+   */
+  bool isSupersededBy(EventPayload const &newerPayload) const override;
+
+ private:
+  TouchList touches_;
+  TouchList changedTouches_;
+  TouchList targetTouches_;
+};
+
 class TouchEventEmitter;
 
 using SharedTouchEventEmitter = std::shared_ptr<TouchEventEmitter const>;
@@ -31,7 +59,7 @@ class TouchEventEmitter : public EventEmitter {
 
  private:
   void dispatchTouchEvent(
-      std::string const &type,
+      EventType type,
       TouchEvent const &event,
       EventPriority const &priority) const;
 };
@@ -46,16 +46,29 @@ void ViewEventEmitter::onLayout(const LayoutMetrics &layoutMetrics) const {
     lastLayoutMetrics_ = layoutMetrics;
   }
 
-  dispatchEvent("layout", [frame = layoutMetrics.frame](jsi::Runtime &runtime) {
-    auto layout = jsi::Object(runtime);
-    layout.setProperty(runtime, "x", frame.origin.x);
-    layout.setProperty(runtime, "y", frame.origin.y);
-    layout.setProperty(runtime, "width", frame.size.width);
-    layout.setProperty(runtime, "height", frame.size.height);
-    auto payload = jsi::Object(runtime);
-    payload.setProperty(runtime, "layout", std::move(layout));
-    return payload;
-  });
+  static auto const type = EventType{"layout"};
+  dispatchEvent(
+      type, std::make_shared<LayoutEventPayload>(layoutMetrics.frame));
+}
+
+#pragma mark - LayoutEventPayload
+
+LayoutEventPayload::LayoutEventPayload(Rect const &frame) : frame_(frame) {}
+
+jsi::Value LayoutEventPayload::asJSIValue(
+    jsi::Runtime &runtime,
+    EventPayloadPropertyNames &propertyNames) const {
+  auto layout = jsi::Object(runtime);
+  layout.setProperty(runtime, propertyNames.get(runtime, "x"), frame_.origin.x);
+  layout.setProperty(runtime, propertyNames.get(runtime, "y"), frame_.origin.y);
+  layout.setProperty(
+      runtime, propertyNames.get(runtime, "width"), frame_.size.width);
+  layout.setProperty(
+      runtime, propertyNames.get(runtime, "height"), frame_.size.height);
+  auto payload = jsi::Object(runtime);
+  payload.setProperty(
+      runtime, propertyNames.get(runtime, "layout"), std::move(layout));
+  return payload;
 }
 
 } // namespace react
@@ -18,6 +18,21 @@
 namespace facebook {
 namespace react {
 
+/*
+ * Typed payload of `layout` events.
+ */
+class LayoutEventPayload final : public EventPayload {
+ public:
+  LayoutEventPayload(Rect const &frame);
+
+  jsi::Value asJSIValue(
+      jsi::Runtime &runtime,
+      EventPayloadPropertyNames &propertyNames) const override;
+
+ private:
+  Rect frame_;
+};
+
 class ViewEventEmitter;
 
 using SharedViewEventEmitter = std::shared_ptr<const ViewEventEmitter>;
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/components/view/TouchEventEmitter.h>
+
+namespace facebook {
+namespace react {
+
+static Touch createTouch(int identifier, Float x) {
+  auto touch = Touch{};
+  touch.identifier = identifier;
+  touch.target = 1;
+  touch.pagePoint = {x, x};
+  return touch;
+}
+
+static TouchEventPayload createPayload(
+    Touches const &touches,
+    Touches const &changedTouches) {
+  auto event = TouchEvent{};
+  event.touches = touches;
+  event.changedTouches = changedTouches;
+  event.targetTouches = touches;
+  return TouchEventPayload(event);
+}
+
+TEST(TouchEventPayloadTest, supersededByMoveOfSameTouches) {
+  auto older = createPayload(
+      {createTouch(1, 0), createTouch(2, 0)},
+      {createTouch(1, 0), createTouch(2, 0)});
+  auto newer = createPayload(
+      {createTouch(2, 10), createTouch(1, 10)},
+      {createTouch(2, 10), createTouch(1, 10)});
+
+  EXPECT_TRUE(older.isSupersededBy(newer));
+}
+
+TEST(TouchEventPayloadTest, notSupersededByMoveOfOtherTouches) {
+  // Both touches are active, but each event only moves one of them; dropping
+  // the first one would lose the last position of touch 1.
+  auto touches = Touches{createTouch(1, 0), createTouch(2, 0)};
+  auto older = createPayload(touches, {createTouch(1, 5)});
+  auto newer = createPayload(touches, {createTouch(2, 5)});
+  auto both = createPayload(touches, {createTouch(1, 5), createTouch(2, 5)});
+
+  EXPECT_FALSE(older.isSupersededBy(newer));
+  EXPECT_FALSE(older.isSupersededBy(both));
+  EXPECT_FALSE(both.isSupersededBy(older));
+}
+
+} // namespace react
+} // namespace facebook
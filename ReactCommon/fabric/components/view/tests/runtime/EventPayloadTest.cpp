@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+#include <react/components/view/TouchEventEmitter.h>
+#include <react/components/view/ViewEventEmitter.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * The `ValueFactory` based payloads which the typed payloads replaced; the
+ * typed payloads must produce the same JavaScript values.
+ */
+namespace reference {
+
+static jsi::Value touchPayload(jsi::Runtime &runtime, Touch const &touch) {
+  auto object = jsi::Object(runtime);
+  object.setProperty(runtime, "locationX", touch.offsetPoint.x);
+  object.setProperty(runtime, "locationY", touch.offsetPoint.y);
+  object.setProperty(runtime, "pageX", touch.pagePoint.x);
+  object.setProperty(runtime, "pageY", touch.pagePoint.y);
+  object.setProperty(runtime, "screenX", touch.screenPoint.x);
+  object.setProperty(runtime, "screenY", touch.screenPoint.y);
+  object.setProperty(runtime, "identifier", touch.identifier);
+  object.setProperty(runtime, "target", touch.target);
+  object.setProperty(runtime, "timestamp", touch.timestamp * 1000);
+  object.setProperty(runtime, "force", touch.force);
+  return object;
+}
+
+static jsi::Value touchesPayload(
+    jsi::Runtime &runtime,
+    Touches const &touches) {
+  auto array = jsi::Array(runtime, touches.size());
+  int i = 0;
+  for (auto const &touch : touches) {
+    array.setValueAtIndex(runtime, i++, touchPayload(runtime, touch));
+  }
+  return array;
+}
+
+static jsi::Value touchEventPayload(
+    jsi::Runtime &runtime,
+    TouchEvent const &event) {
+  auto object = jsi::Object(runtime);
+  object.setProperty(
+      runtime, "touches", touchesPayload(runtime, event.touches));
+  object.setProperty(
+      runtime, "changedTouches", touchesPayload(runtime, event.changedTouches));
+  object.setProperty(
+      runtime, "targetTouches", touchesPayload(runtime, event.targetTouches));
+  return object;
+}
+
+static jsi::Value layoutEventPayload(jsi::Runtime &runtime, Rect frame) {
+  auto layout = jsi::Object(runtime);
+  layout.setProperty(runtime, "x", frame.origin.x);
+  layout.setProperty(runtime, "y", frame.origin.y);
+  layout.setProperty(runtime, "width", frame.size.width);
+  layout.setProperty(runtime, "height", frame.size.height);
+  auto payload = jsi::Object(runtime);
+  payload.setProperty(runtime, "layout", std::move(layout));
+  return payload;
+}
+
+} // namespace reference
+
+class EventPayloadTest : public jsi::JSITestBase {
+ protected:
+  folly::dynamic toDynamic(EventPayload const &payload) {
+    return jsi::dynamicFromValue(rt, payload.asJSIValue(rt, propertyNames));
+  }
+
+  folly::dynamic toDynamic(jsi::Value const &value) {
+    return jsi::dynamicFromValue(rt, value);
+  }
+
+  EventPayloadPropertyNames propertyNames;
+};
+
+static Touch createTouch(int identifier, Float offset) {
+  auto touch = Touch{};
+  touch.pagePoint = {offset + 1, offset + 2};
+  touch.offsetPoint = {offset + 3, offset + 4};
+  touch.screenPoint = {offset + 5, offset + 6};
+  touch.identifier = identifier;
+  touch.target = 42;
+  touch.force = 0.5;
+  touch.timestamp = 12.25;
+  return touch;
+}
+
+TEST_P(EventPayloadTest, touchEventPayloadMatchesValueFactory) {
+  auto event = TouchEvent{};
+  event.touches = {createTouch(1, 0), createTouch(2, 10), createTouch(3, 20)};
+  event.changedTouches = {createTouch(2, 10)};
+  event.targetTouches = {createTouch(1, 0), createTouch(3, 20)};
+
+  auto payload = TouchEventPayload(event);
+  auto expected = toDynamic(reference::touchEventPayload(rt, event));
+
+  EXPECT_EQ(toDynamic(payload), expected);
+  // Property names are cached by the first conversion.
+  EXPECT_EQ(toDynamic(payload), expected);
+}
+
+TEST_P(EventPayloadTest, emptyTouchEventPayloadMatchesValueFactory) {
+  auto event = TouchEvent{};
+
+  EXPECT_EQ(
+      toDynamic(TouchEventPayload(event)),
+      toDynamic(reference::touchEventPayload(rt, event)));
+}
+
+TEST_P(EventPayloadTest, layoutEventPayloadMatchesValueFactory) {
+  auto frame = Rect{{1.5, -2}, {100, 200.25}};
+
+  EXPECT_EQ(
+      toDynamic(LayoutEventPayload(frame)),
+      toDynamic(reference::layoutEventPayload(rt, frame)));
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    EventPayloadTest,
+    ::testing::ValuesIn(jsi::runtimeGenerators()));
+
+} // namespace react
+} // namespace facebook
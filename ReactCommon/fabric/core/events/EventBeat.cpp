@@ -13,6 +13,11 @@ namespace react {
 EventBeat::EventBeat(SharedOwnerBox const &ownerBox) : ownerBox_(ownerBox) {}
 
 void EventBeat::request() const {
+  // The request time is written before the flag, so a beat which sees the
+  // flag also sees the time of the request.
+  if (!isRequested_) {
+    requestTime_ = telemetryTimePointNow();
+  }
   isRequested_ = true;
 }
 
@@ -21,6 +26,10 @@ void EventBeat::beat(jsi::Runtime &runtime) const {
     return;
   }
 
+  // The request time must be read before resetting the flag; otherwise,
+  // a concurrent request for the next beat could overwrite it.
+  beatRequestTime_ = requestTime_;
+  beatTime_ = telemetryTimePointNow();
   isRequested_ = false;
 
   if (beatCallback_) {
@@ -36,5 +45,13 @@ void EventBeat::setBeatCallback(const BeatCallback &beatCallback) {
   beatCallback_ = beatCallback;
 }
 
+TelemetryTimePoint EventBeat::getBeatRequestTime() const {
+  return beatRequestTime_;
+}
+
+TelemetryTimePoint EventBeat::getBeatTime() const {
+  return beatTime_;
+}
+
 } // namespace react
 } // namespace facebook
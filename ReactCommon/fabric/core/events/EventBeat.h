@@ -12,6 +12,8 @@
 #include <functional>
 #include <memory>
 
+#include <react/utils/Telemetry.h>
+
 namespace facebook {
 namespace react {
 
@@ -75,6 +77,14 @@ class EventBeat {
    */
   void setBeatCallback(const BeatCallback &beatCallback);
 
+  /*
+   * Return the time when the current beat was requested (the first request
+   * after the previous beat) and the time when it started.
+   * Must be called from the beat callback.
+   */
+  TelemetryTimePoint getBeatRequestTime() const;
+  TelemetryTimePoint getBeatTime() const;
+
  protected:
   /*
    * Should be used by sublasses to send a beat.
@@ -85,6 +95,12 @@ class EventBeat {
   BeatCallback beatCallback_;
   SharedOwnerBox ownerBox_;
   mutable std::atomic<bool> isRequested_{false};
+
+ private:
+  mutable std::atomic<TelemetryTimePoint> requestTime_{
+      kTelemetryUndefinedTimePoint};
+  mutable TelemetryTimePoint beatRequestTime_{kTelemetryUndefinedTimePoint};
+  mutable TelemetryTimePoint beatTime_{kTelemetryUndefinedTimePoint};
 };
 
 } // namespace react
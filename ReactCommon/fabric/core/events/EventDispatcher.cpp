@@ -55,6 +55,11 @@ void EventDispatcher::dispatchStateUpdate(
   getEventQueue(priority).enqueueStateUpdate(std::move(stateUpdate));
 }
 
+EventTelemetry const &EventDispatcher::getEventTelemetry(
+    EventPriority priority) const {
+  return getEventQueue(priority).getTelemetry();
+}
+
 const EventQueue &EventDispatcher::getEventQueue(EventPriority priority) const {
   return *eventQueues_[(int)priority];
 }
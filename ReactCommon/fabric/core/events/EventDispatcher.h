@@ -49,6 +49,12 @@ class EventDispatcher {
   void dispatchStateUpdate(StateUpdate &&stateUpdate, EventPriority priority)
       const;
 
+  /*
+   * Returns the event delivery latency telemetry of the queue with given
+   * priority.
+   */
+  EventTelemetry const &getEventTelemetry(EventPriority priority) const;
+
  private:
   EventQueue const &getEventQueue(EventPriority priority) const;
 
@@ -17,20 +17,6 @@
 namespace facebook {
 namespace react {
 
-// TODO(T29874519): Get rid of "top" prefix once and for all.
-/*
- * Capitalizes the first letter of the event type and adds "top" prefix if
- * necessary (e.g. "layout" becames "topLayout").
- */
-static std::string normalizeEventType(const std::string &type) {
-  auto prefixedType = type;
-  if (type.find("top", 0) != 0) {
-    prefixedType.insert(0, "top");
-    prefixedType[3] = toupper(prefixedType[3]);
-  }
-  return prefixedType;
-}
-
 std::mutex &EventEmitter::DispatchMutex() {
   static std::mutex mutex;
   return mutex;
@@ -49,22 +35,53 @@ EventEmitter::EventEmitter(
     : eventTarget_(std::move(eventTarget)),
       eventDispatcher_(std::move(eventDispatcher)) {}
 
+namespace {
+
+/*
+ * A `folly::dynamic` payload (used by emitters without typed payloads) which
+ * is shared rather than copied as the event moves through the queues.
+ */
+class DynamicEventPayload final : public EventPayload {
+ public:
+  DynamicEventPayload(folly::dynamic payload) : payload_(std::move(payload)) {}
+
+  jsi::Value asJSIValue(jsi::Runtime &runtime, EventPayloadPropertyNames &)
+      const override {
+    return valueFromDynamic(runtime, payload_);
+  }
+
+ private:
+  folly::dynamic payload_;
+};
+
+} // namespace
+
 void EventEmitter::dispatchEvent(
-    const std::string &type,
+    EventType type,
     const folly::dynamic &payload,
     const EventPriority &priority) const {
   dispatchEvent(
-      type,
-      [payload](jsi::Runtime &runtime) {
-        return valueFromDynamic(runtime, payload);
-      },
-      priority);
+      type, std::make_shared<DynamicEventPayload>(payload), priority);
 }
 
 void EventEmitter::dispatchEvent(
-    const std::string &type,
+    EventType type,
     const ValueFactory &payloadFactory,
     const EventPriority &priority) const {
+  dispatchRawEvent_(RawEvent(type, payloadFactory, eventTarget_), priority);
+}
+
+void EventEmitter::dispatchEvent(
+    EventType type,
+    EventPayload::Shared payload,
+    const EventPriority &priority) const {
+  dispatchRawEvent_(
+      RawEvent(type, std::move(payload), eventTarget_), priority);
+}
+
+void EventEmitter::dispatchRawEvent_(
+    RawEvent &&rawEvent,
+    const EventPriority &priority) const {
   SystraceSection s("EventEmitter::dispatchEvent");
 
   auto eventDispatcher = eventDispatcher_.lock();
@@ -72,9 +89,7 @@ void EventEmitter::dispatchEvent(
     return;
   }
 
-  eventDispatcher->dispatchEvent(
-      RawEvent(normalizeEventType(type), payloadFactory, eventTarget_),
-      priority);
+  eventDispatcher->dispatchEvent(std::move(rawEvent), priority);
 }
 
 void EventEmitter::setEnabled(bool enabled) const {
@@ -12,8 +12,10 @@
 
 #include <folly/dynamic.h>
 #include <react/core/EventDispatcher.h>
+#include <react/core/EventPayload.h>
 #include <react/core/EventPriority.h>
 #include <react/core/EventTarget.h>
+#include <react/core/EventType.h>
 #include <react/core/ReactPrimitives.h>
 
 namespace facebook {
@@ -68,19 +70,31 @@ class EventEmitter {
    * Is used by particular subclasses only.
    */
   void dispatchEvent(
-      const std::string &type,
+      EventType type,
       const ValueFactory &payloadFactory =
           EventEmitter::defaultPayloadFactory(),
       const EventPriority &priority = EventPriority::AsynchronousBatched) const;
 
   void dispatchEvent(
-      const std::string &type,
+      EventType type,
       const folly::dynamic &payload,
       const EventPriority &priority = EventPriority::AsynchronousBatched) const;
 
+  /*
+   * Prefer typed payloads for frequently dispatched events: the payload is
+   * allocated once and written to JavaScript directly.
+   */
+  void dispatchEvent(
+      EventType type,
+      EventPayload::Shared payload,
+      const EventPriority &priority = EventPriority::AsynchronousBatched) const;
+
  private:
   void toggleEventTargetOwnership_() const;
 
+  void dispatchRawEvent_(RawEvent &&rawEvent, const EventPriority &priority)
+      const;
+
   friend class UIManagerBinding;
 
   mutable SharedEventTarget eventTarget_;
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "EventPayload.h"
+
+namespace facebook {
+namespace react {
+
+jsi::PropNameID const &EventPayloadPropertyNames::get(
+    jsi::Runtime &runtime,
+    char const *name) {
+  auto iterator = propNameIDs_.find(name);
+  if (iterator != propNameIDs_.end()) {
+    return iterator->second;
+  }
+
+  return propNameIDs_
+      .emplace(name, jsi::PropNameID::forAscii(runtime, name))
+      .first->second;
+}
+
+bool EventPayload::isSupersededBy(EventPayload const &newerPayload) const {
+  return true;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include <jsi/jsi.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Property names used by event payloads, created once per runtime.
+ * Names are identified by the address of the string, so only string literals
+ * (or other strings with static storage duration) can be used.
+ * Must be owned by an object with the lifetime of the runtime and only be
+ * used on the JavaScript thread.
+ */
+class EventPayloadPropertyNames final {
+ public:
+  jsi::PropNameID const &get(jsi::Runtime &runtime, char const *name);
+
+ private:
+  std::unordered_map<char const *, jsi::PropNameID> propNameIDs_;
+};
+
+/*
+ * Base class for typed event payloads: plain data captured on the thread
+ * which dispatches an event and converted to a JavaScript object on the
+ * JavaScript thread when the event is delivered.
+ * Unlike a `ValueFactory` capturing the same data, a payload is allocated
+ * once and shared (not copied) as the event moves through the queues.
+ */
+class EventPayload {
+ public:
+  using Shared = std::shared_ptr<EventPayload const>;
+
+  virtual ~EventPayload() = default;
+
+  /*
+   * Creates the JavaScript value of the payload.
+   * Called on the JavaScript thread.
+   */
+  virtual jsi::Value asJSIValue(
+      jsi::Runtime &runtime,
+      EventPayloadPropertyNames &propertyNames) const = 0;
+
+  /*
+   * Returns whether a pending event with this payload can be dropped in
+   * favor of a newer event of the same coalescable type and target with
+   * `newerPayload` (see `EventType::Coalescing`). Payloads which only
+   * describe part of a state (e.g. the touches that moved) override this to
+   * keep the events that describe different parts.
+   * Called on the thread which flushes the event queue.
+   */
+  virtual bool isSupersededBy(EventPayload const &newerPayload) const;
+};
+
+} // namespace react
+} // namespace facebook
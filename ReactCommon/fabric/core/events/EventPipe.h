@@ -8,20 +8,15 @@
 #pragma once
 
 #include <functional>
-#include <string>
 
 #include <jsi/jsi.h>
-#include <react/core/EventTarget.h>
-#include <react/core/ValueFactory.h>
+#include <react/core/RawEvent.h>
 
 namespace facebook {
 namespace react {
 
-using EventPipe = std::function<void(
-    jsi::Runtime &runtime,
-    const EventTarget *eventTarget,
-    const std::string &type,
-    const ValueFactory &payloadFactory)>;
+using EventPipe =
+    std::function<void(jsi::Runtime &runtime, const RawEvent &rawEvent)>;
 
 } // namespace react
 } // namespace facebook
@@ -7,7 +7,8 @@
 
 #include "EventQueue.h"
 
-#include "EventEmitter.h"
+#include <algorithm>
+#include <unordered_map>
 
 namespace facebook {
 namespace react {
@@ -24,23 +25,31 @@ EventQueue::EventQueue(
 }
 
 void EventQueue::enqueueEvent(const RawEvent &rawEvent) const {
-  {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    eventQueue_.push_back(rawEvent);
-  }
+  auto event = rawEvent;
+  event.enqueueTime = telemetryTimePointNow();
+  eventQueue_.insertHead(std::move(event));
 
   onEnqueue();
 }
 
 void EventQueue::enqueueStateUpdate(const StateUpdate &stateUpdate) const {
-  {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    stateUpdateQueue_.push_back(stateUpdate);
-  }
+  stateUpdateQueue_.insertHead(stateUpdate);
 
   onEnqueue();
 }
 
+size_t EventQueue::getCoalescedEventCount() const {
+  return coalescedEventCount_;
+}
+
+size_t EventQueue::getDeliveredEventCount() const {
+  return deliveredEventCount_;
+}
+
+EventTelemetry const &EventQueue::getTelemetry() const {
+  return telemetry_;
+}
+
 void EventQueue::onEnqueue() const {
   // Default implementation does nothing.
 }
@@ -50,63 +59,97 @@ void EventQueue::onBeat(jsi::Runtime &runtime) const {
   flushStateUpdates();
 }
 
-void EventQueue::flushEvents(jsi::Runtime &runtime) const {
-  std::vector<RawEvent> queue;
-
-  {
-    std::lock_guard<std::mutex> lock(queueMutex_);
+std::vector<RawEvent> EventQueue::takeEvents() const {
+  // `reverseSweep` takes all the events enqueued so far at once (newest
+  // first); events enqueued concurrently will be taken on the next beat.
+  auto events = std::vector<RawEvent>{};
+  eventQueue_.reverseSweep(
+      [&](RawEvent &&event) { events.push_back(std::move(event)); });
+
+  auto hasCoalescableEvents = std::any_of(
+      events.begin(), events.end(), [](RawEvent const &event) {
+        return event.type.isCoalescable();
+      });
+  if (!hasCoalescableEvents) {
+    std::reverse(events.begin(), events.end());
+    return events;
+  }
 
-    if (eventQueue_.size() == 0) {
-      return;
+  // Going from the newest event to the oldest one, an event is dropped if
+  // the next event of the same target supersedes it.
+  // Dropping an event never reorders the events of a target.
+  auto result = std::vector<RawEvent>{};
+  result.reserve(events.size());
+  auto nextEventIndexByTarget =
+      std::unordered_map<EventTarget const *, size_t>{};
+
+  for (auto &event : events) {
+    auto iterator = nextEventIndexByTarget.find(event.eventTarget.get());
+    if (iterator != nextEventIndexByTarget.end()) {
+      if (event.isSupersededBy(result[iterator->second])) {
+        coalescedEventCount_++;
+        continue;
+      }
+      iterator->second = result.size();
+    } else {
+      nextEventIndexByTarget.emplace(event.eventTarget.get(), result.size());
     }
+    result.push_back(std::move(event));
+  }
+
+  std::reverse(result.begin(), result.end());
+  return result;
+}
 
-    queue = std::move(eventQueue_);
-    eventQueue_.clear();
+void EventQueue::flushEvents(jsi::Runtime &runtime) const {
+  auto flushStartTime = telemetryTimePointNow();
+  auto queue = takeEvents();
+  if (queue.empty()) {
+    return;
   }
 
-  {
-    std::lock_guard<std::mutex> lock(EventEmitter::DispatchMutex());
+  auto beatTime = eventBeat_->getBeatTime();
+  telemetry_.recordBeat(eventBeat_->getBeatRequestTime(), beatTime);
 
-    for (const auto &event : queue) {
-      if (event.eventTarget) {
-        event.eventTarget->retain(runtime);
-      }
+  // `EventTarget::retain` does not require `EventEmitter::DispatchMutex()`:
+  // the enabled flag of a target is atomic and `instanceHandle` cannot be
+  // deallocated while the event (and therefore the target) is retained here.
+  for (const auto &event : queue) {
+    if (event.eventTarget) {
+      event.eventTarget->retain(runtime);
     }
   }
 
   for (const auto &event : queue) {
-    eventPipe_(
-        runtime, event.eventTarget.get(), event.type, event.payloadFactory);
+    auto pipeStartTime = telemetryTimePointNow();
+    eventPipe_(runtime, event);
+    auto pipeEndTime = telemetryTimePointNow();
+    telemetry_.recordEvent(
+        event.type, event.enqueueTime, beatTime, pipeStartTime, pipeEndTime);
   }
 
-  // No need to lock `EventEmitter::DispatchMutex()` here.
-  // The mutex protects from a situation when the `instanceHandle` can be
-  // deallocated during accessing, but that's impossible at this point because
-  // we have a strong pointer to it.
   for (const auto &event : queue) {
     if (event.eventTarget) {
       event.eventTarget->release(runtime);
     }
   }
+
+  deliveredEventCount_ += queue.size();
+  telemetry_.recordFlush(telemetryTimePointNow() - flushStartTime);
 }
 
 void EventQueue::flushStateUpdates() const {
-  std::vector<StateUpdate> stateUpdateQueue;
-
-  {
-    std::lock_guard<std::mutex> lock(queueMutex_);
+  auto stateUpdateQueue = std::vector<StateUpdate>{};
+  stateUpdateQueue_.reverseSweep([&](StateUpdate &&stateUpdate) {
+    stateUpdateQueue.push_back(std::move(stateUpdate));
+  });
 
-    if (stateUpdateQueue_.size() == 0) {
-      return;
-    }
-
-    stateUpdateQueue = std::move(stateUpdateQueue_);
-    stateUpdateQueue_.clear();
+  if (stateUpdateQueue.empty()) {
+    return;
   }
 
-  for (const auto &stateUpdate : stateUpdateQueue) {
-    statePipe_(stateUpdate);
-  }
+  std::reverse(stateUpdateQueue.begin(), stateUpdateQueue.end());
+  statePipe_(stateUpdateQueue);
 }
 
 } // namespace react
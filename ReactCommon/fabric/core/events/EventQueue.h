@@ -7,13 +7,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
-#include <mutex>
 #include <vector>
 
+#include <folly/AtomicLinkedList.h>
 #include <jsi/jsi.h>
 #include <react/core/EventBeat.h>
 #include <react/core/EventPipe.h>
+#include <react/core/EventTelemetry.h>
 #include <react/core/RawEvent.h>
 #include <react/core/StatePipe.h>
 #include <react/core/StateUpdate.h>
@@ -35,16 +37,38 @@ class EventQueue {
 
   /*
    * Enqueues and (probably later) dispatch a given event.
-   * Can be called on any thread.
+   * A pending event is dropped if the next pending event for the same
+   * target supersedes it (see `RawEvent::isSupersededBy`).
+   * Can be called on any thread; lock-free.
    */
   void enqueueEvent(const RawEvent &rawEvent) const;
 
   /*
    * Enqueues and (probably later) dispatch a given state update.
-   * Can be called on any thread.
+   * Can be called on any thread; lock-free.
    */
   void enqueueStateUpdate(const StateUpdate &stateUpdate) const;
 
+  /*
+   * Returns the number of events which were replaced by newer ones before
+   * being delivered.
+   * Can be called on any thread.
+   */
+  size_t getCoalescedEventCount() const;
+
+  /*
+   * Returns the number of events which were delivered via the event pipe.
+   * Can be called on any thread.
+   */
+  size_t getDeliveredEventCount() const;
+
+  /*
+   * Returns the latency of beats and event delivery aggregated per event
+   * type.
+   * Can be called on any thread.
+   */
+  EventTelemetry const &getTelemetry() const;
+
  protected:
   /*
    * Called on any enqueue operation.
@@ -57,13 +81,23 @@ class EventQueue {
   void flushEvents(jsi::Runtime &runtime) const;
   void flushStateUpdates() const;
 
+  /*
+   * Removes all pending events from the queue and returns them in the order
+   * of enqueueing, without the ones superseded by coalescing.
+   * Must be called on the thread that flushes the queue.
+   */
+  std::vector<RawEvent> takeEvents() const;
+
   const EventPipe eventPipe_;
   const StatePipe statePipe_;
   const std::unique_ptr<EventBeat> eventBeat_;
-  // Thread-safe, protected by `queueMutex_`.
-  mutable std::vector<RawEvent> eventQueue_;
-  mutable std::vector<StateUpdate> stateUpdateQueue_;
-  mutable std::mutex queueMutex_;
+  // Thread-safe; multiple producers, a single consumer (the beat thread).
+  mutable folly::AtomicLinkedList<RawEvent> eventQueue_;
+  mutable folly::AtomicLinkedList<StateUpdate> stateUpdateQueue_;
+
+  mutable std::atomic<size_t> coalescedEventCount_{0};
+  mutable std::atomic<size_t> deliveredEventCount_{0};
+  mutable EventTelemetry telemetry_;
 };
 
 } // namespace react
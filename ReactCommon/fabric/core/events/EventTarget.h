@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include <jsi/jsi.h>
@@ -40,6 +41,7 @@ class EventTarget {
   /*
    * Sets the `enabled` flag that allows creating a strong instance handle from
    * a weak one.
+   * Can be called on any thread.
    */
   void setEnabled(bool enabled) const;
 
@@ -66,7 +68,7 @@ class EventTarget {
   Tag getTag() const;
 
  private:
-  mutable bool enabled_{false}; // Protected by `EventEmitter::DispatchMutex()`.
+  mutable std::atomic<bool> enabled_{false}; // Thread-safe.
   mutable jsi::WeakObject weakInstanceHandle_; // Protected by `jsi::Runtime &`.
   mutable jsi::Value strongInstanceHandle_; // Protected by `jsi::Runtime &`.
   Tag tag_;
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "EventTelemetry.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook {
+namespace react {
+
+constexpr size_t EventLatencyHistogram::kBucketCount;
+
+static size_t bucketIndexForDuration(TelemetryDuration duration) {
+  auto microseconds =
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+  auto index = size_t{0};
+  while (microseconds > 0 && index < EventLatencyHistogram::kBucketCount - 1) {
+    microseconds >>= 1;
+    index++;
+  }
+  return index;
+}
+
+/*
+ * Durations of events enqueued while the beat was already happening might
+ * come out slightly negative.
+ */
+static TelemetryDuration durationBetween(
+    TelemetryTimePoint startTime,
+    TelemetryTimePoint endTime) {
+  return std::max(
+      TelemetryDuration{0},
+      std::chrono::duration_cast<TelemetryDuration>(endTime - startTime));
+}
+
+#pragma mark - EventLatencyHistogram
+
+void EventLatencyHistogram::record(TelemetryDuration duration) {
+  bucketCounts_[bucketIndexForDuration(duration)]++;
+  count_++;
+  total_ += duration;
+  max_ = std::max(max_, duration);
+}
+
+size_t EventLatencyHistogram::getCount() const {
+  return count_;
+}
+
+TelemetryDuration EventLatencyHistogram::getMean() const {
+  if (count_ == 0) {
+    return TelemetryDuration{0};
+  }
+  return total_ / count_;
+}
+
+TelemetryDuration EventLatencyHistogram::getMax() const {
+  return max_;
+}
+
+TelemetryDuration EventLatencyHistogram::getPercentile(
+    double percentile) const {
+  if (count_ == 0) {
+    return TelemetryDuration{0};
+  }
+
+  auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * count_));
+  auto accumulatedCount = size_t{0};
+  for (size_t index = 0; index < kBucketCount; index++) {
+    accumulatedCount += bucketCounts_[index];
+    if (accumulatedCount >= rank) {
+      return std::min(getBucketUpperBound(index), max_);
+    }
+  }
+  return max_;
+}
+
+std::array<size_t, EventLatencyHistogram::kBucketCount> const &
+EventLatencyHistogram::getBucketCounts() const {
+  return bucketCounts_;
+}
+
+TelemetryDuration EventLatencyHistogram::getBucketUpperBound(size_t index) {
+  return std::chrono::microseconds(int64_t{1} << index);
+}
+
+#pragma mark - EventTelemetry
+
+void EventTelemetry::recordBeat(
+    TelemetryTimePoint requestTime,
+    TelemetryTimePoint beatTime) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  beatLatency_.record(durationBetween(requestTime, beatTime));
+}
+
+void EventTelemetry::recordFlush(TelemetryDuration duration) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  flushDuration_.record(duration);
+}
+
+void EventTelemetry::recordEvent(
+    EventType const &type,
+    TelemetryTimePoint enqueueTime,
+    TelemetryTimePoint beatTime,
+    TelemetryTimePoint pipeStartTime,
+    TelemetryTimePoint pipeEndTime) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto result = eventTypeHistograms_.emplace(
+      type.getId(), EventTypeHistograms{});
+  if (result.second) {
+    eventTypes_.push_back(type);
+  }
+
+  auto &histograms = result.first->second;
+  histograms.queueLatency.record(durationBetween(enqueueTime, beatTime));
+  histograms.pipeDuration.record(durationBetween(pipeStartTime, pipeEndTime));
+  histograms.deliveryLatency.record(
+      durationBetween(enqueueTime, pipeEndTime));
+}
+
+EventLatencyHistogram EventTelemetry::getBeatLatencyHistogram() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return beatLatency_;
+}
+
+EventLatencyHistogram EventTelemetry::getFlushDurationHistogram() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return flushDuration_;
+}
+
+std::vector<EventType> EventTelemetry::getEventTypes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return eventTypes_;
+}
+
+EventTelemetry::EventTypeHistograms EventTelemetry::getEventTypeHistograms(
+    EventType const &type) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iterator = eventTypeHistograms_.find(type.getId());
+  if (iterator == eventTypeHistograms_.end()) {
+    return {};
+  }
+  return iterator->second;
+}
+
+} // namespace react
+} // namespace facebook
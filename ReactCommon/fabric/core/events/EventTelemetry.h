@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <react/core/EventType.h>
+#include <react/utils/Telemetry.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Histogram of durations with logarithmic (power of two microseconds)
+ * buckets. Not thread-safe.
+ */
+class EventLatencyHistogram final {
+ public:
+  static constexpr size_t kBucketCount = 32;
+
+  void record(TelemetryDuration duration);
+
+  size_t getCount() const;
+  TelemetryDuration getMean() const;
+  TelemetryDuration getMax() const;
+
+  /*
+   * Returns an upper bound of the given percentile (from 0 to 100) with the
+   * precision of a bucket.
+   */
+  TelemetryDuration getPercentile(double percentile) const;
+
+  /*
+   * Bucket `0` counts durations shorter than 1 microsecond, bucket `i` counts
+   * durations from `2^(i-1)` to `2^i` microseconds; the last bucket also
+   * counts all longer durations.
+   */
+  std::array<size_t, kBucketCount> const &getBucketCounts() const;
+  static TelemetryDuration getBucketUpperBound(size_t index);
+
+ private:
+  std::array<size_t, kBucketCount> bucketCounts_{};
+  size_t count_{0};
+  TelemetryDuration total_{0};
+  TelemetryDuration max_{0};
+};
+
+/*
+ * Aggregates the latency of event delivery from enqueueing an event on a
+ * native thread to the return of the event pipe (the JavaScript handler).
+ * Recorded by `EventQueue` on the thread that flushes the queue; can be read
+ * on any thread.
+ */
+class EventTelemetry final {
+ public:
+  struct EventTypeHistograms {
+    /*
+     * From enqueueing the event to the beat which delivered it.
+     */
+    EventLatencyHistogram queueLatency;
+
+    /*
+     * Time spent in the event pipe.
+     */
+    EventLatencyHistogram pipeDuration;
+
+    /*
+     * From enqueueing the event to the return of the event pipe.
+     */
+    EventLatencyHistogram deliveryLatency;
+  };
+
+  /*
+   * Signaling
+   */
+  void recordBeat(TelemetryTimePoint requestTime, TelemetryTimePoint beatTime);
+  void recordFlush(TelemetryDuration duration);
+  void recordEvent(
+      EventType const &type,
+      TelemetryTimePoint enqueueTime,
+      TelemetryTimePoint beatTime,
+      TelemetryTimePoint pipeStartTime,
+      TelemetryTimePoint pipeEndTime);
+
+  /*
+   * Reading
+   */
+
+  /*
+   * From requesting a beat to the beat.
+   */
+  EventLatencyHistogram getBeatLatencyHistogram() const;
+
+  /*
+   * Time spent flushing all events delivered by a beat.
+   */
+  EventLatencyHistogram getFlushDurationHistogram() const;
+
+  /*
+   * Returns the types of all delivered events, in order of first delivery.
+   */
+  std::vector<EventType> getEventTypes() const;
+
+  EventTypeHistograms getEventTypeHistograms(EventType const &type) const;
+
+ private:
+  mutable std::mutex mutex_;
+  EventLatencyHistogram beatLatency_;
+  EventLatencyHistogram flushDuration_;
+  std::vector<EventType> eventTypes_;
+  std::unordered_map<EventType::Id, EventTypeHistograms> eventTypeHistograms_;
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "EventType.h"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <better/mutex.h>
+
+namespace facebook {
+namespace react {
+
+// TODO(T29874519): Get rid of "top" prefix once and for all.
+/*
+ * Capitalizes the first letter of the event type and adds "top" prefix if
+ * necessary (e.g. "layout" becames "topLayout").
+ */
+static std::string normalizeEventType(const std::string &type) {
+  auto prefixedType = type;
+  if (type.find("top", 0) != 0) {
+    prefixedType.insert(0, "top");
+    prefixedType[3] = toupper(prefixedType[3]);
+  }
+  return prefixedType;
+}
+
+namespace {
+
+class EventTypeRegistry {
+ public:
+  EventType::Id getId(
+      std::string const &name,
+      EventType::Coalescing coalescing) {
+    {
+      std::shared_lock<better::shared_mutex> lock(mutex_);
+      auto iterator = ids_.find(name);
+      if (iterator != ids_.end() &&
+          (coalescing == EventType::Coalescing::Disabled ||
+           coalescable_[iterator->second])) {
+        return iterator->second;
+      }
+    }
+
+    std::unique_lock<better::shared_mutex> lock(mutex_);
+
+    auto iterator = ids_.find(name);
+    if (iterator != ids_.end()) {
+      if (coalescing == EventType::Coalescing::Enabled) {
+        coalescable_[iterator->second] = true;
+      }
+      return iterator->second;
+    }
+
+    auto normalizedName = normalizeEventType(name);
+    auto normalizedIterator = ids_.find(normalizedName);
+    auto id = EventType::Id{};
+    if (normalizedIterator != ids_.end()) {
+      id = normalizedIterator->second;
+    } else {
+      id = static_cast<EventType::Id>(names_.size());
+      names_.push_back(normalizedName);
+      coalescable_.push_back(false);
+      ids_.emplace(std::move(normalizedName), id);
+    }
+
+    if (coalescing == EventType::Coalescing::Enabled) {
+      coalescable_[id] = true;
+    }
+    ids_.emplace(name, id);
+    return id;
+  }
+
+  std::string const &getName(EventType::Id id) const {
+    std::shared_lock<better::shared_mutex> lock(mutex_);
+    // Elements of `std::deque` never move when new ones are appended.
+    return names_[id];
+  }
+
+  bool isCoalescable(EventType::Id id) const {
+    std::shared_lock<better::shared_mutex> lock(mutex_);
+    return coalescable_[id];
+  }
+
+ private:
+  mutable better::shared_mutex mutex_;
+  std::unordered_map<std::string, EventType::Id> ids_;
+  std::deque<std::string> names_;
+  std::vector<bool> coalescable_;
+};
+
+} // namespace
+
+static EventTypeRegistry &getEventTypeRegistry() {
+  // Intentionally leaked; event types can be used during static destruction.
+  static auto &registry = *new EventTypeRegistry();
+  return registry;
+}
+
+EventType::EventType(std::string const &name)
+    : EventType(name, Coalescing::Disabled) {}
+
+EventType::EventType(char const *name) : EventType(std::string{name}) {}
+
+EventType::EventType(std::string const &name, Coalescing coalescing)
+    : id_(getEventTypeRegistry().getId(name, coalescing)) {}
+
+std::string const &EventType::getName() const {
+  return getEventTypeRegistry().getName(id_);
+}
+
+bool EventType::isCoalescable() const {
+  return getEventTypeRegistry().isCoalescable(id_);
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Interned type of an event (e.g. `topScroll`).
+ * Every distinct name is normalized (see `getName`) and registered once per
+ * process; after that, an event type is copied and compared as an integer.
+ * Emitters should keep `static` instances for the types they dispatch to
+ * avoid even the lookup of the name.
+ */
+class EventType final {
+ public:
+  using Id = int32_t;
+
+  enum class Coalescing {
+    /*
+     * Every event of the type is delivered.
+     */
+    Disabled,
+
+    /*
+     * Only the latest event of the type matters (e.g. `scroll`): a pending
+     * event gets replaced by a newer event of the type for the same target,
+     * as long as its payload allows it (see `EventPayload::isSupersededBy`).
+     */
+    Enabled,
+  };
+
+  /*
+   * Both the normalized (`topScroll`) and the short (`scroll`) form of a name
+   * resolve to the same event type.
+   * Can be called on any thread.
+   */
+  EventType(std::string const &name);
+  EventType(char const *name);
+
+  /*
+   * Same as above, but also registers the coalescing behavior of the type;
+   * once enabled, it applies to all events of the type, however they were
+   * constructed.
+   */
+  EventType(std::string const &name, Coalescing coalescing);
+
+  /*
+   * Returns a small non-negative number which identifies the event type;
+   * ids are assigned sequentially and never reused.
+   */
+  Id getId() const {
+    return id_;
+  }
+
+  /*
+   * Returns the normalized name which is passed to JavaScript: the name
+   * with capitalized first letter and the "top" prefix (e.g. "layout" becomes
+   * "topLayout").
+   * The reference stays valid for the lifetime of the process.
+   * Can be called on any thread.
+   */
+  std::string const &getName() const;
+
+  /*
+   * Returns whether coalescing was enabled for the type.
+   * Can be called on any thread.
+   */
+  bool isCoalescable() const;
+
+  bool operator==(EventType const &rhs) const {
+    return id_ == rhs.id_;
+  }
+
+  bool operator!=(EventType const &rhs) const {
+    return id_ != rhs.id_;
+  }
+
+ private:
+  Id id_;
+};
+
+} // namespace react
+} // namespace facebook
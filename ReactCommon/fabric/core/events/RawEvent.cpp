@@ -11,12 +11,42 @@ namespace facebook {
 namespace react {
 
 RawEvent::RawEvent(
-    std::string type,
+    EventType type,
     ValueFactory payloadFactory,
     SharedEventTarget eventTarget)
-    : type(std::move(type)),
+    : type(type),
       payloadFactory(std::move(payloadFactory)),
       eventTarget(std::move(eventTarget)) {}
 
+RawEvent::RawEvent(
+    EventType type,
+    EventPayload::Shared payload,
+    SharedEventTarget eventTarget)
+    : type(type),
+      payload(std::move(payload)),
+      eventTarget(std::move(eventTarget)) {}
+
+jsi::Value RawEvent::createPayload(
+    jsi::Runtime &runtime,
+    EventPayloadPropertyNames &propertyNames) const {
+  if (payload) {
+    return payload->asJSIValue(runtime, propertyNames);
+  }
+
+  return payloadFactory(runtime);
+}
+
+bool RawEvent::isSupersededBy(RawEvent const &newerEvent) const {
+  if (type != newerEvent.type || !type.isCoalescable()) {
+    return false;
+  }
+
+  if (payload && newerEvent.payload) {
+    return payload->isSupersededBy(*newerEvent.payload);
+  }
+
+  return true;
+}
+
 } // namespace react
 } // namespace facebook
@@ -8,10 +8,13 @@
 #pragma once
 
 #include <memory>
-#include <string>
 
+#include <jsi/jsi.h>
+#include <react/core/EventPayload.h>
 #include <react/core/EventTarget.h>
+#include <react/core/EventType.h>
 #include <react/core/ValueFactory.h>
+#include <react/utils/Telemetry.h>
 
 namespace facebook {
 namespace react {
@@ -22,13 +25,45 @@ namespace react {
 class RawEvent {
  public:
   RawEvent(
-      std::string type,
+      EventType type,
       ValueFactory payloadFactory,
       SharedEventTarget eventTarget);
 
-  const std::string type;
-  const ValueFactory payloadFactory;
-  const SharedEventTarget eventTarget;
+  RawEvent(
+      EventType type,
+      EventPayload::Shared payload,
+      SharedEventTarget eventTarget);
+
+  /*
+   * Creates the JavaScript value of the payload of the event.
+   * Called on the JavaScript thread.
+   */
+  jsi::Value createPayload(
+      jsi::Runtime &runtime,
+      EventPayloadPropertyNames &propertyNames) const;
+
+  /*
+   * Returns whether this event, while pending, can be dropped in favor of
+   * `newerEvent`: both must be of the same coalescable type and their
+   * payloads must allow it (see `EventPayload::isSupersededBy`).
+   */
+  bool isSupersededBy(RawEvent const &newerEvent) const;
+
+  EventType type;
+
+  /*
+   * The payload of the event; either `payload` (typed) or `payloadFactory`
+   * is set.
+   */
+  ValueFactory payloadFactory;
+  EventPayload::Shared payload;
+
+  SharedEventTarget eventTarget;
+
+  /*
+   * The time when the event was enqueued to an `EventQueue`.
+   */
+  TelemetryTimePoint enqueueTime{kTelemetryUndefinedTimePoint};
 };
 
 } // namespace react
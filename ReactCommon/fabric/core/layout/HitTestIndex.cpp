@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "HitTestIndex.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include <better/small_vector.h>
+#include <react/core/LayoutableShadowNode.h>
+#include <react/debug/SystraceSection.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Lists of children up to this size (and the leaves of bounding volume
+ * hierarchies) are tested linearly.
+ */
+static constexpr int kLeafSize = 8;
+
+struct HitTestIndex::Record {
+  struct Volume {
+    Rect bounds;
+    int maxOrderIndex;
+    // Range of `permutation` covered by the volume.
+    int begin;
+    int end;
+    // Child volumes; `-1` for leaves.
+    int left;
+    int right;
+  };
+
+  /*
+   * The indexed node; `shadowNode` is `nullptr` for the root node and for
+   * the nodes of pruned indices, which are not retained (and never reused).
+   */
+  ShadowNode::Shared shadowNode;
+  ShadowNode const *node;
+
+  /*
+   * The frame with the transform applied, in the coordinate space of the
+   * parent, and the origin of the coordinate space of the children.
+   */
+  Rect hitRect;
+  Point childrenOrigin;
+  int orderIndex;
+
+  /*
+   * One per child of the node; `nullptr` for children which are not
+   * layoutable (and therefore are never hit).
+   */
+  std::vector<SharedRecord> children;
+
+  /*
+   * Indices of the layoutable children, in the order of `volumes` if there
+   * are any.
+   */
+  std::vector<int> permutation;
+  std::vector<Volume> volumes;
+
+  bool isAbove(int childIndex, int otherChildIndex) const {
+    auto orderIndex = children[childIndex]->orderIndex;
+    auto otherOrderIndex = children[otherChildIndex]->orderIndex;
+    return orderIndex > otherOrderIndex ||
+        (orderIndex == otherOrderIndex && childIndex < otherChildIndex);
+  }
+
+  /*
+   * Returns the index of the topmost child which contains `point` (in the
+   * coordinate space of the children), or `-1`.
+   */
+  int findChildAtPoint(Point point) const {
+    auto hitIndex = -1;
+    auto test = [&](int childIndex) {
+      if ((hitIndex == -1 || isAbove(childIndex, hitIndex)) &&
+          children[childIndex]->hitRect.containsPoint(point)) {
+        hitIndex = childIndex;
+      }
+    };
+
+    if (volumes.empty()) {
+      for (auto childIndex : permutation) {
+        test(childIndex);
+      }
+      return hitIndex;
+    }
+
+    auto stack = better::small_vector<int, 32>{0};
+    while (!stack.empty()) {
+      auto const &volume = volumes[stack.back()];
+      stack.pop_back();
+
+      if (hitIndex != -1 &&
+          volume.maxOrderIndex < children[hitIndex]->orderIndex) {
+        continue;
+      }
+
+      if (!volume.bounds.containsPoint(point)) {
+        continue;
+      }
+
+      if (volume.left == -1) {
+        for (auto i = volume.begin; i < volume.end; i++) {
+          test(permutation[i]);
+        }
+        continue;
+      }
+
+      stack.push_back(volume.right);
+      stack.push_back(volume.left);
+    }
+    return hitIndex;
+  }
+
+  int buildVolumes(int begin, int end) {
+    auto bounds = children[permutation[begin]]->hitRect;
+    auto maxOrderIndex = children[permutation[begin]]->orderIndex;
+    for (auto i = begin + 1; i < end; i++) {
+      auto const &child = *children[permutation[i]];
+      bounds.unionInPlace(child.hitRect);
+      maxOrderIndex = std::max(maxOrderIndex, child.orderIndex);
+    }
+
+    auto volumeIndex = static_cast<int>(volumes.size());
+    volumes.push_back({bounds, maxOrderIndex, begin, end, -1, -1});
+
+    if (end - begin <= kLeafSize) {
+      return volumeIndex;
+    }
+
+    // Splits the children in halves by the centers of their frames along
+    // the longer side of the bounds.
+    auto splitByX = bounds.size.width >= bounds.size.height;
+    auto middle = begin + (end - begin) / 2;
+    std::nth_element(
+        permutation.begin() + begin,
+        permutation.begin() + middle,
+        permutation.begin() + end,
+        [&](int lhs, int rhs) {
+          auto lhsCenter = children[lhs]->hitRect.getCenter();
+          auto rhsCenter = children[rhs]->hitRect.getCenter();
+          return splitByX ? lhsCenter.x < rhsCenter.x
+                          : lhsCenter.y < rhsCenter.y;
+        });
+
+    auto left = buildVolumes(begin, middle);
+    auto right = buildVolumes(middle, end);
+    volumes[volumeIndex].left = left;
+    volumes[volumeIndex].right = right;
+    return volumeIndex;
+  }
+};
+
+HitTestIndex::HitTestIndex(
+    ShadowNode const &rootShadowNode,
+    HitTestIndex const *previousIndex)
+    : rootShadowNode_(rootShadowNode) {
+  SystraceSection s("HitTestIndex::HitTestIndex");
+  rootRecord_ = buildRecord(
+      nullptr,
+      rootShadowNode,
+      previousIndex ? previousIndex->rootRecord_ : SharedRecord{});
+}
+
+HitTestIndex::HitTestIndex(
+    ShadowNode const &rootShadowNode,
+    SharedRecord rootRecord)
+    : rootShadowNode_(rootShadowNode), rootRecord_(std::move(rootRecord)) {}
+
+HitTestIndex::~HitTestIndex() = default;
+
+HitTestIndex::Shared HitTestIndex::prune(
+    ShadowNode const &rootShadowNode,
+    HitTestIndex const &previousIndex) {
+  SystraceSection s("HitTestIndex::prune");
+  auto rootRecord = pruneRecord(rootShadowNode, previousIndex.rootRecord_);
+  if (!rootRecord) {
+    return nullptr;
+  }
+  // `make_shared` can't reach the private constructor.
+  return Shared{new HitTestIndex(rootShadowNode, std::move(rootRecord))};
+}
+
+std::vector<HitTestIndex::SharedRecord const *> HitTestIndex::matchChildren(
+    ShadowNode const &node,
+    Record const &previousRecord) {
+  auto const &children = node.getChildren();
+  auto const &previousSiblings = previousRecord.children;
+  auto matches = std::vector<SharedRecord const *>(children.size(), nullptr);
+
+  // The map is only needed if the children were reordered, inserted or
+  // removed.
+  auto previousChildren =
+      std::unordered_map<ShadowNodeFamily const *, SharedRecord const *>{};
+  auto previousChildrenAreMapped = false;
+
+  for (size_t childIndex = 0; childIndex < children.size(); childIndex++) {
+    auto const &child = *children[childIndex];
+    if (childIndex < previousSiblings.size() &&
+        previousSiblings[childIndex] &&
+        ShadowNode::sameFamily(*previousSiblings[childIndex]->node, child)) {
+      matches[childIndex] = &previousSiblings[childIndex];
+      continue;
+    }
+
+    if (!previousChildrenAreMapped) {
+      for (auto const &previousSibling : previousSiblings) {
+        if (previousSibling) {
+          previousChildren[&previousSibling->node->getFamily()] =
+              &previousSibling;
+        }
+      }
+      previousChildrenAreMapped = true;
+    }
+    auto it = previousChildren.find(&child.getFamily());
+    if (it != previousChildren.end()) {
+      matches[childIndex] = it->second;
+    }
+  }
+
+  return matches;
+}
+
+HitTestIndex::SharedRecord HitTestIndex::pruneRecord(
+    ShadowNode const &node,
+    SharedRecord const &previousRecord) {
+  if (!previousRecord) {
+    return nullptr;
+  }
+
+  // Shared subtrees are kept as they are; they only retain nodes of the
+  // new tree.
+  if (previousRecord->shadowNode && previousRecord->node == &node) {
+    return previousRecord;
+  }
+
+  // Otherwise, only the structure is kept, pointing to the nodes of the new
+  // tree so that the old ones can go away.
+  auto record = std::make_shared<Record>();
+  record->node = &node;
+
+  auto const &children = node.getChildren();
+  auto matches = matchChildren(node, *previousRecord);
+  record->children.reserve(children.size());
+
+  auto hasSharedDescendants = false;
+  for (size_t childIndex = 0; childIndex < children.size(); childIndex++) {
+    auto childRecord = matches[childIndex]
+        ? pruneRecord(*children[childIndex], *matches[childIndex])
+        : nullptr;
+    hasSharedDescendants = hasSharedDescendants || childRecord;
+    record->children.push_back(std::move(childRecord));
+  }
+
+  return hasSharedDescendants ? record : nullptr;
+}
+
+HitTestIndex::SharedRecord HitTestIndex::buildRecord(
+    ShadowNode::Shared const &shadowNode,
+    ShadowNode const &node,
+    SharedRecord const &previousRecord) {
+  // Retained nodes cannot be reallocated at the same address, so the same
+  // pointer means the same (immutable) subtree.
+  if (previousRecord && previousRecord->shadowNode &&
+      previousRecord->node == &node) {
+    return previousRecord;
+  }
+
+  auto layoutableShadowNode =
+      dynamic_cast<LayoutableShadowNode const *>(&node);
+  if (!layoutableShadowNode) {
+    return nullptr;
+  }
+
+  auto record = std::make_shared<Record>();
+  record->shadowNode = shadowNode;
+  record->node = &node;
+
+  auto frame = layoutableShadowNode->getLayoutMetrics().frame;
+  auto transform = layoutableShadowNode->getTransform();
+  record->hitRect = frame * transform;
+  record->childrenOrigin = frame.origin * transform;
+  record->orderIndex = node.getOrderIndex();
+
+  auto const &children = node.getChildren();
+  auto matches = previousRecord
+      ? matchChildren(node, *previousRecord)
+      : std::vector<SharedRecord const *>(children.size(), nullptr);
+  record->children.reserve(children.size());
+
+  for (auto const &child : children) {
+    auto childIndex = static_cast<int>(record->children.size());
+    auto previousChild = matches[childIndex];
+    auto childRecord =
+        buildRecord(child, *child, previousChild ? *previousChild : nullptr);
+    if (childRecord) {
+      record->permutation.push_back(childIndex);
+    }
+    record->children.push_back(std::move(childRecord));
+  }
+
+  if (record->permutation.size() > kLeafSize) {
+    record->buildVolumes(0, static_cast<int>(record->permutation.size()));
+  }
+
+  return record;
+}
+
+HitTestIndex::Record const *HitTestIndex::findRecord(
+    ShadowNode const &shadowNode) const {
+  if (!rootRecord_) {
+    return nullptr;
+  }
+
+  if (&shadowNode == &rootShadowNode_) {
+    return rootRecord_.get();
+  }
+
+  auto ancestors = shadowNode.getFamily().getAncestors(rootShadowNode_);
+  if (ancestors.empty()) {
+    return nullptr;
+  }
+
+  auto record = rootRecord_.get();
+  for (auto const &ancestor : ancestors) {
+    auto childIndex = ancestor.second;
+    if (!record ||
+        childIndex >= static_cast<int>(record->children.size())) {
+      return nullptr;
+    }
+    record = record->children[childIndex].get();
+  }
+
+  return record && record->node == &shadowNode ? record : nullptr;
+}
+
+ShadowNode::Shared HitTestIndex::findNodeAtPoint(
+    ShadowNode::Shared const &shadowNode,
+    Point point) const {
+  auto record = findRecord(*shadowNode);
+  if (!record) {
+    return LayoutableShadowNode::findNodeAtPoint(shadowNode, point);
+  }
+
+  if (!record->hitRect.containsPoint(point)) {
+    return nullptr;
+  }
+
+  auto hitRecord = record;
+  while (true) {
+    point = point - hitRecord->childrenOrigin;
+    auto childIndex = hitRecord->findChildAtPoint(point);
+    if (childIndex == -1) {
+      break;
+    }
+    hitRecord = hitRecord->children[childIndex].get();
+  }
+
+  return hitRecord == record ? shadowNode : hitRecord->shadowNode;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <react/core/ShadowNode.h>
+#include <react/graphics/Geometry.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Answers `LayoutableShadowNode::findNodeAtPoint` queries for an (immutable,
+ * laid out) shadow tree without testing every child of every node.
+ *
+ * For each layoutable node, the index keeps the transformed frames of its
+ * children in a bounding volume hierarchy, so a hit-test costs
+ * `O(depth * log(fanout))` instead of being linear in the number of nodes.
+ *
+ * The per-node data only depends on the node itself (shadow nodes are
+ * immutable), so an index built on top of the index of a previous revision
+ * shares everything that belongs to unchanged subtrees and only processes
+ * nodes which were cloned since then. To keep that ability across revisions
+ * without retaining old trees, `prune` reduces an index to the parts that
+ * are still shared with a newer tree.
+ */
+class HitTestIndex final {
+ public:
+  using Shared = std::shared_ptr<HitTestIndex const>;
+
+  /*
+   * Indexes the tree rooted at `rootShadowNode`, reusing the parts of
+   * `previousIndex` (if any) that describe the same nodes.
+   * The index retains all nodes of the tree except the root node, which
+   * must outlive the index.
+   */
+  HitTestIndex(
+      ShadowNode const &rootShadowNode,
+      HitTestIndex const *previousIndex = nullptr);
+
+  ~HitTestIndex();
+
+  /*
+   * Returns what `previousIndex` has in common with the tree rooted at
+   * `rootShadowNode`, or `nullptr` if nothing. The result only retains nodes
+   * of that tree (which must outlive it) and is only meant to be passed as
+   * `previousIndex` when indexing that tree or a later revision of it.
+   */
+  static Shared prune(
+      ShadowNode const &rootShadowNode,
+      HitTestIndex const &previousIndex);
+
+  /*
+   * Same as `LayoutableShadowNode::findNodeAtPoint`.
+   * Nodes which are not part of the indexed tree are hit-tested without the
+   * index.
+   */
+  ShadowNode::Shared findNodeAtPoint(
+      ShadowNode::Shared const &shadowNode,
+      Point point) const;
+
+ private:
+  struct Record;
+  using SharedRecord = std::shared_ptr<Record const>;
+
+  HitTestIndex(ShadowNode const &rootShadowNode, SharedRecord rootRecord);
+
+  static SharedRecord buildRecord(
+      ShadowNode::Shared const &shadowNode,
+      ShadowNode const &node,
+      SharedRecord const &previousRecord);
+
+  static SharedRecord pruneRecord(
+      ShadowNode const &node,
+      SharedRecord const &previousRecord);
+
+  /*
+   * Returns, for each child of `node`, the child record of `previousRecord`
+   * describing the same family, or `nullptr`.
+   */
+  static std::vector<SharedRecord const *> matchChildren(
+      ShadowNode const &node,
+      Record const &previousRecord);
+
+  Record const *findRecord(ShadowNode const &shadowNode) const;
+
+  ShadowNode const &rootShadowNode_;
+  SharedRecord rootRecord_;
+};
+
+} // namespace react
+} // namespace facebook
@@ -19,18 +19,13 @@ namespace react {
 
 /*
  * `shadowNode` might not be the newest revision of `ShadowNodeFamily`.
- * This function looks at `parentNode`'s children and finds one that belongs
- * to the same family as `shadowNode`.
+ * This function returns the child of the last ancestor (the parent node) at
+ * the index recorded in `ancestors`, which is the node of the same family.
  */
 static ShadowNode const *findNewestChildInParent(
-    ShadowNode const &parentNode,
-    ShadowNode const &shadowNode) {
-  for (auto const &child : parentNode.getChildren()) {
-    if (ShadowNode::sameFamily(*child, shadowNode)) {
-      return child.get();
-    }
-  }
-  return nullptr;
+    ShadowNode::AncestorList const &ancestors) {
+  auto const &parentAndIndex = *ancestors.rbegin();
+  return parentAndIndex.first.get().getChildren()[parentAndIndex.second].get();
 }
 
 static LayoutMetrics calculateOffsetForLayoutMetrics(
@@ -125,8 +120,7 @@ LayoutMetrics LayoutableShadowNode::getRelativeLayoutMetrics(
     return EmptyLayoutMetrics;
   }
 
-  auto newestChild =
-      findNewestChildInParent(ancestors.rbegin()->first.get(), shadowNode);
+  auto newestChild = findNewestChildInParent(ancestors);
 
   if (!newestChild) {
     return EmptyLayoutMetrics;
@@ -230,13 +224,22 @@ ShadowNode::Shared LayoutableShadowNode::findNodeAtPoint(
   }
 
   auto newPoint = point - frame.origin * layoutableShadowNode->getTransform();
+
+  // Children with a higher order index (`zIndex`) are on top of their
+  // siblings; among children with the same order index, the first one wins.
+  ShadowNode::Shared hitView;
+  auto hitOrderIndex = 0;
   for (const auto &childShadowNode : node->getChildren()) {
-    auto hitView = findNodeAtPoint(childShadowNode, newPoint);
-    if (hitView) {
-      return hitView;
+    if (hitView && childShadowNode->getOrderIndex() <= hitOrderIndex) {
+      continue;
+    }
+    auto childHitView = findNodeAtPoint(childShadowNode, newPoint);
+    if (childHitView) {
+      hitView = childHitView;
+      hitOrderIndex = childShadowNode->getOrderIndex();
     }
   }
-  return isPointInside ? node : nullptr;
+  return hitView ? hitView : node;
 }
 
 void LayoutableShadowNode::layoutChildren(LayoutContext layoutContext) {
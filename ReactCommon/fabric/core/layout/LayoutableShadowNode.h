@@ -115,6 +115,9 @@ class LayoutableShadowNode : public ShadowNode {
   /*
    * Returns the ShadowNode that is rendered at the Point received as a
    * parameter.
+   * Overlapping siblings are resolved by their order index (`zIndex`) first,
+   * then by their order in the list of children (the first one wins).
+   * See `HitTestIndex` for a faster version for committed trees.
    */
   static ShadowNode::Shared findNodeAtPoint(
       ShadowNode::Shared node,
@@ -10,6 +10,9 @@
 
 #include <better/small_vector.h>
 
+#include <unordered_map>
+#include <vector>
+
 #include <react/core/ComponentDescriptor.h>
 #include <react/core/ShadowNodeFragment.h>
 #include <react/debug/DebugStringConvertible.h>
@@ -248,6 +251,10 @@ int ShadowNode::getStateRevision() const {
   return stateRevision_;
 }
 
+ShadowNodeIndex const *ShadowNode::getIndex() const {
+  return nullptr;
+}
+
 ShadowNode::Unshared ShadowNode::cloneTree(
     ShadowNodeFamily const &shadowNodeFamily,
     std::function<ShadowNode::Unshared(ShadowNode const &oldShadowNode)>
@@ -282,6 +289,102 @@ ShadowNode::Unshared ShadowNode::cloneTree(
   return std::const_pointer_cast<ShadowNode>(childNode);
 }
 
+ShadowNode::Unshared ShadowNode::cloneTree(
+    CloneTargetList const &targets) const {
+  // A trie of the paths from this node to the target families; the root
+  // entry is this node. Each family occurs at most once in a tree, so
+  // entries can be found by family.
+  struct Entry {
+    ShadowNodeFamily const *family;
+    size_t parentIndex;
+    size_t childCount;
+    better::small_vector<CloneCallback const *, 1> callbacks;
+  };
+
+  auto entries = std::vector<Entry>{};
+  auto indexes = std::unordered_map<ShadowNodeFamily const *, size_t>{};
+  entries.push_back({family_.get(), 0, 0, {}});
+  indexes[family_.get()] = 0;
+
+  auto path = better::small_vector<ShadowNodeFamily const *, 64>{};
+  for (auto const &target : targets) {
+    path.clear();
+    auto family = target.first;
+    while (family && family != family_.get()) {
+      path.push_back(family);
+      family = family->parent_.lock().get();
+    }
+    if (!family) {
+      continue;
+    }
+
+    auto parentIndex = size_t{0};
+    for (auto it = path.rbegin(); it != path.rend(); it++) {
+      auto inserted = indexes.insert({*it, entries.size()});
+      if (inserted.second) {
+        entries.push_back({*it, parentIndex, 0, {}});
+        entries[parentIndex].childCount++;
+      }
+      parentIndex = inserted.first->second;
+    }
+    entries[parentIndex].callbacks.push_back(&target.second);
+  }
+
+  // Clones the subtree of `shadowNode` (at `index` in `entries`) bottom-up,
+  // so every entry is cloned once.
+  struct Cloner {
+    std::vector<Entry> const &entries;
+    std::unordered_map<ShadowNodeFamily const *, size_t> const &indexes;
+
+    ShadowNode::Unshared clone(ShadowNode const &shadowNode, size_t index)
+        const {
+      auto const &entry = entries[index];
+      auto newShadowNode = ShadowNode::Unshared{};
+
+      if (entry.childCount > 0) {
+        auto const &oldChildren = *shadowNode.children_;
+        auto newChildren = SharedShadowNodeUnsharedList{};
+        auto remaining = entry.childCount;
+        for (size_t i = 0; i < oldChildren.size() && remaining > 0; i++) {
+          auto it = indexes.find(oldChildren[i]->family_.get());
+          if (it == indexes.end() || it->second == 0 ||
+              entries[it->second].parentIndex != index) {
+            continue;
+          }
+          remaining--;
+          auto newChild = clone(*oldChildren[i], it->second);
+          if (!newChild) {
+            continue;
+          }
+          if (!newChildren) {
+            newChildren = std::make_shared<SharedShadowNodeList>(oldChildren);
+          }
+          (*newChildren)[i] = newChild;
+        }
+
+        if (newChildren) {
+          newShadowNode = shadowNode.clone({
+              ShadowNodeFragment::propsPlaceholder(),
+              newChildren,
+          });
+        }
+      }
+
+      for (auto callback : entry.callbacks) {
+        auto const &oldShadowNode = newShadowNode ? *newShadowNode : shadowNode;
+        newShadowNode = (*callback)(oldShadowNode);
+      }
+
+      return newShadowNode;
+    }
+  };
+
+  if (entries.size() == 1 && entries[0].callbacks.empty()) {
+    return ShadowNode::Unshared{nullptr};
+  }
+  return Cloner{entries, indexes}.clone(*this, 0);
+}
+
 #pragma mark - DebugStringConvertible
 
 #if RN_DEBUG_STRING_CONVERTIBLE
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -29,6 +30,7 @@ static constexpr const int kShadowNodeChildrenSmallVectorSize = 8;
 class ComponentDescriptor;
 struct ShadowNodeFragment;
 class ShadowNode;
+class ShadowNodeIndex;
 
 // Deprecated: Use ShadowNode::Shared instead
 using SharedShadowNode = std::shared_ptr<const ShadowNode>;
@@ -55,6 +57,11 @@ class ShadowNode : public Sealable, public DebugStringConvertible {
           int /* childIndex */>,
       64>;
 
+  using CloneCallback =
+      std::function<ShadowNode::Unshared(ShadowNode const &oldShadowNode)>;
+  using CloneTargetList =
+      std::vector<std::pair<ShadowNodeFamily const *, CloneCallback>>;
+
   static SharedShadowNodeSharedList emptySharedShadowNodeSharedList();
 
   /*
@@ -109,6 +116,19 @@ class ShadowNode : public Sealable, public DebugStringConvertible {
       std::function<ShadowNode::Unshared(ShadowNode const &oldShadowNode)>
           callback) const;
 
+  /*
+   * Same as above, but replaces nodes of several families in one pass.
+   * The paths to all of them are merged, so ancestors they have in common
+   * are cloned once. Callbacks for the same family are applied in order,
+   * each getting the node returned by the previous one; a node which is an
+   * ancestor of another target is passed to its callbacks with its
+   * children already replaced. Families which are not in the tree are
+   * skipped.
+   *
+   * Returns `nullptr` if none of the families are found.
+   */
+  ShadowNode::Unshared cloneTree(CloneTargetList const &targets) const;
+
 #pragma mark - Getters
 
   ComponentName getComponentName() const;
@@ -189,6 +209,14 @@ class ShadowNode : public Sealable, public DebugStringConvertible {
 #endif
 
  protected:
+  /*
+   * Returns an index of the (immutable) subtree of the node, or `nullptr` if
+   * the node does not maintain one. If available, it is used to find
+   * descendant nodes instead of searching the subtree.
+   * The default implementation returns `nullptr`.
+   */
+  virtual ShadowNodeIndex const *getIndex() const;
+
   SharedProps props_;
   SharedShadowNodeSharedList children_;
   State::Shared state_;
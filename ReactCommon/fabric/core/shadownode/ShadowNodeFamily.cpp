@@ -7,6 +7,7 @@
 
 #include "ShadowNodeFamily.h"
 #include "ShadowNode.h"
+#include "ShadowNodeIndex.h"
 
 #include <react/core/ComponentDescriptor.h>
 #include <react/core/State.h>
@@ -56,6 +57,11 @@ const ComponentDescriptor &ShadowNodeFamily::getComponentDescriptor() const {
 
 AncestorList ShadowNodeFamily::getAncestors(
     ShadowNode const &ancestorShadowNode) const {
+  auto index = ancestorShadowNode.getIndex();
+  if (index) {
+    return index->getAncestors(*this);
+  }
+
   auto families = better::small_vector<ShadowNodeFamily const *, 64>{};
   auto ancestorFamily = ancestorShadowNode.family_.get();
 
@@ -68,6 +68,8 @@ class ShadowNodeFamily {
    * Returns an empty array if there is no ancestor-descendant relationship.
    * Can be called from any thread.
    * The theoretical complexity of the algorithm is `O(ln(n))`. Use it wisely.
+   * If `ancestorShadowNode` maintains a `ShadowNodeIndex`, the list is built
+   * from the index in `O(depth)` without searching children lists.
    */
   AncestorList getAncestors(ShadowNode const &ancestorShadowNode) const;
 
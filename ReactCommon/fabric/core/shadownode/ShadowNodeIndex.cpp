@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ShadowNodeIndex.h"
+
+#include <algorithm>
+
+namespace facebook {
+namespace react {
+
+ShadowNodeIndex::ShadowNodeIndex(ShadowNode const &rootShadowNode) {
+  entries_.push_back({&rootShadowNode, -1, -1});
+  entryIndexByFamily_[&rootShadowNode.getFamily()] = 0;
+
+  // Entries are visited in the order they are added, so the list doubles as
+  // a (breadth-first) work queue.
+  for (size_t entryIndex = 0; entryIndex < entries_.size(); entryIndex++) {
+    auto shadowNode = entries_[entryIndex].shadowNode;
+    auto childIndex = 0;
+    for (auto const &childNode : shadowNode->getChildren()) {
+      entryIndexByFamily_[&childNode->getFamily()] =
+          static_cast<int>(entries_.size());
+      entries_.push_back(
+          {childNode.get(), static_cast<int>(entryIndex), childIndex});
+      childIndex++;
+    }
+  }
+}
+
+ShadowNode::Shared const *ShadowNodeIndex::find(
+    ShadowNodeFamily const &family) const {
+  auto it = entryIndexByFamily_.find(&family);
+  if (it == entryIndexByFamily_.end()) {
+    return nullptr;
+  }
+
+  auto const &entry = entries_[it->second];
+  if (entry.parentEntryIndex == -1) {
+    return nullptr;
+  }
+
+  auto const &parentNode = *entries_[entry.parentEntryIndex].shadowNode;
+  return &parentNode.getChildren()[entry.childIndex];
+}
+
+ShadowNode::AncestorList ShadowNodeIndex::getAncestors(
+    ShadowNodeFamily const &family) const {
+  auto ancestors = ShadowNode::AncestorList{};
+
+  auto it = entryIndexByFamily_.find(&family);
+  if (it == entryIndexByFamily_.end()) {
+    return ancestors;
+  }
+
+  for (auto entryIndex = it->second;
+       entries_[entryIndex].parentEntryIndex != -1;
+       entryIndex = entries_[entryIndex].parentEntryIndex) {
+    auto const &entry = entries_[entryIndex];
+    ancestors.push_back(
+        {*entries_[entry.parentEntryIndex].shadowNode, entry.childIndex});
+  }
+
+  std::reverse(ancestors.begin(), ancestors.end());
+  return ancestors;
+}
+
+size_t ShadowNodeIndex::size() const {
+  return entries_.size();
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include <react/core/ShadowNode.h>
+#include <react/core/ShadowNodeFamily.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Maps every family in an (immutable) shadow tree to the node of the family
+ * in the tree, and the node's position relative to its parent.
+ * Lookups take constant time and ancestor lists are built in `O(depth)`,
+ * instead of searching the tree from the root.
+ * The index keeps raw pointers into the tree, so the tree must outlive it and
+ * must not be mutated after the index is built.
+ */
+class ShadowNodeIndex final {
+ public:
+  /*
+   * Indexes the whole tree rooted at `rootShadowNode`.
+   */
+  explicit ShadowNodeIndex(ShadowNode const &rootShadowNode);
+
+  /*
+   * Returns a pointer to the element of the parent's children list that
+   * holds the node of the given family, or `nullptr` if the family is not in
+   * the tree (or is the family of the root node).
+   */
+  ShadowNode::Shared const *find(ShadowNodeFamily const &family) const;
+
+  /*
+   * Same as `ShadowNodeFamily::getAncestors`, relative to the root node.
+   */
+  ShadowNode::AncestorList getAncestors(ShadowNodeFamily const &family) const;
+
+  /*
+   * Returns the number of indexed nodes (including the root node).
+   */
+  size_t size() const;
+
+ private:
+  struct Entry {
+    ShadowNode const *shadowNode;
+    int parentEntryIndex;
+    int childIndex;
+  };
+
+  std::vector<Entry> entries_;
+  std::unordered_map<ShadowNodeFamily const *, int> entryIndexByFamily_;
+};
+
+} // namespace react
+} // namespace facebook
@@ -8,13 +8,19 @@
 #pragma once
 
 #include <functional>
+#include <vector>
 
 #include <react/core/StateUpdate.h>
 
 namespace facebook {
 namespace react {
 
-using StatePipe = std::function<void(StateUpdate const &stateUpdate)>;
+/*
+ * Receives all state updates pending at a beat at once, in the order they
+ * were enqueued, so that they can be applied together.
+ */
+using StatePipe =
+    std::function<void(std::vector<StateUpdate> const &stateUpdates)>;
 
 } // namespace react
 } // namespace facebook
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/core/EventQueue.h>
+
+using namespace facebook::react;
+
+class TestEventQueue : public EventQueue {
+ public:
+  TestEventQueue()
+      : EventQueue(
+            [](facebook::jsi::Runtime &, RawEvent const &) {},
+            [](std::vector<StateUpdate> const &) {},
+            std::make_unique<EventBeat>(
+                std::make_shared<EventBeat::OwnerBox>())) {}
+
+  using EventQueue::takeEvents;
+};
+
+/*
+ * A payload which can only be superseded by a payload with the same key.
+ */
+class KeyedPayload final : public EventPayload {
+ public:
+  KeyedPayload(int key) : key_(key) {}
+
+  facebook::jsi::Value asJSIValue(
+      facebook::jsi::Runtime &,
+      EventPayloadPropertyNames &) const override {
+    return facebook::jsi::Value(key_);
+  }
+
+  bool isSupersededBy(EventPayload const &newerPayload) const override {
+    return static_cast<KeyedPayload const &>(newerPayload).key_ == key_;
+  }
+
+ private:
+  int key_;
+};
+
+static auto const scrollType =
+    EventType{"topScroll", EventType::Coalescing::Enabled};
+static auto const touchMoveType =
+    EventType{"topTouchMove", EventType::Coalescing::Enabled};
+
+static RawEvent createEvent(EventType type) {
+  return RawEvent(type, ValueFactory{}, nullptr);
+}
+
+static RawEvent createEvent(EventType type, int key) {
+  return RawEvent(type, std::make_shared<KeyedPayload>(key), nullptr);
+}
+
+static std::vector<EventType> takeEventTypes(TestEventQueue &eventQueue) {
+  auto types = std::vector<EventType>{};
+  for (auto const &event : eventQueue.takeEvents()) {
+    types.push_back(event.type);
+  }
+  return types;
+}
+
+TEST(EventQueueTest, coalescePendingEventsOfSameType) {
+  TestEventQueue eventQueue;
+
+  eventQueue.enqueueEvent(createEvent(scrollType));
+  eventQueue.enqueueEvent(createEvent(scrollType));
+  eventQueue.enqueueEvent(createEvent(scrollType));
+
+  EXPECT_EQ(takeEventTypes(eventQueue).size(), 1);
+  EXPECT_EQ(eventQueue.getCoalescedEventCount(), 2);
+  EXPECT_TRUE(eventQueue.takeEvents().empty());
+}
+
+TEST(EventQueueTest, doNotCoalesceRegularEvents) {
+  TestEventQueue eventQueue;
+
+  eventQueue.enqueueEvent(createEvent(scrollType));
+  eventQueue.enqueueEvent(createEvent("topPress"));
+  eventQueue.enqueueEvent(createEvent("topPress"));
+  eventQueue.enqueueEvent(createEvent(scrollType));
+
+  EXPECT_EQ(takeEventTypes(eventQueue).size(), 4);
+  EXPECT_EQ(eventQueue.getCoalescedEventCount(), 0);
+}
+
+TEST(EventQueueTest, doNotReorderEventsOfSameTarget) {
+  TestEventQueue eventQueue;
+
+  // The first `topTouchMove` must not be coalesced with the following ones
+  // because that would deliver it after `topTouchEnd`.
+  eventQueue.enqueueEvent(createEvent(touchMoveType));
+  eventQueue.enqueueEvent(createEvent("topTouchEnd"));
+  eventQueue.enqueueEvent(createEvent(touchMoveType));
+  eventQueue.enqueueEvent(createEvent(touchMoveType));
+
+  auto types = takeEventTypes(eventQueue);
+  EXPECT_EQ(
+      types,
+      (std::vector<EventType>{"topTouchMove", "topTouchEnd", "topTouchMove"}));
+  EXPECT_EQ(eventQueue.getCoalescedEventCount(), 1);
+}
+
+TEST(EventQueueTest, coalesceOnlyEventsWhosePayloadsAllowIt) {
+  TestEventQueue eventQueue;
+
+  eventQueue.enqueueEvent(createEvent(touchMoveType, 1));
+  eventQueue.enqueueEvent(createEvent(touchMoveType, 1));
+  eventQueue.enqueueEvent(createEvent(touchMoveType, 2));
+  eventQueue.enqueueEvent(createEvent(touchMoveType, 2));
+
+  EXPECT_EQ(takeEventTypes(eventQueue).size(), 2);
+  EXPECT_EQ(eventQueue.getCoalescedEventCount(), 2);
+}
+
+TEST(EventQueueTest, coalescingIsRegisteredOnEventType) {
+  auto type = EventType{"topPinch"};
+  EXPECT_FALSE(type.isCoalescable());
+
+  EventType{"pinch", EventType::Coalescing::Enabled};
+  EXPECT_TRUE(type.isCoalescable());
+  EXPECT_FALSE(EventType{"topPress"}.isCoalescable());
+}
+
+TEST(EventQueueTest, takeEventsEnqueuedConcurrently) {
+  TestEventQueue eventQueue;
+  auto const eventCount = size_t{1000};
+
+  auto enqueueEvents = [&](std::string const &type) {
+    for (size_t i = 0; i < eventCount; i++) {
+      eventQueue.enqueueEvent(createEvent(type));
+    }
+  };
+
+  auto thread1 = std::thread(enqueueEvents, "topPress");
+  auto thread2 = std::thread(enqueueEvents, "topPressIn");
+  auto takenEventCount = size_t{0};
+  while (takenEventCount < eventCount * 2) {
+    takenEventCount += eventQueue.takeEvents().size();
+  }
+  thread1.join();
+  thread2.join();
+
+  EXPECT_EQ(takenEventCount, eventCount * 2);
+  EXPECT_TRUE(eventQueue.takeEvents().empty());
+}
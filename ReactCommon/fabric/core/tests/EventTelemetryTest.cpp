@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+#include <react/core/EventTelemetry.h>
+
+using namespace facebook::react;
+using namespace std::chrono_literals;
+
+TEST(EventTelemetryTest, histogramBuckets) {
+  auto histogram = EventLatencyHistogram{};
+
+  histogram.record(500ns);
+  histogram.record(1us);
+  histogram.record(3us);
+  histogram.record(3us);
+  histogram.record(100us);
+
+  auto const &bucketCounts = histogram.getBucketCounts();
+  EXPECT_EQ(bucketCounts[0], 1);
+  EXPECT_EQ(bucketCounts[1], 1);
+  EXPECT_EQ(bucketCounts[2], 2);
+  EXPECT_EQ(bucketCounts[7], 1);
+  EXPECT_EQ(histogram.getCount(), 5);
+  EXPECT_EQ(histogram.getMax(), TelemetryDuration{100us});
+}
+
+TEST(EventTelemetryTest, histogramPercentiles) {
+  auto histogram = EventLatencyHistogram{};
+  EXPECT_EQ(histogram.getPercentile(50), TelemetryDuration{0});
+
+  for (int i = 0; i < 99; i++) {
+    histogram.record(3us);
+  }
+  histogram.record(10ms);
+
+  EXPECT_EQ(histogram.getPercentile(50), TelemetryDuration{4us});
+  EXPECT_EQ(histogram.getPercentile(99), TelemetryDuration{4us});
+  EXPECT_EQ(histogram.getPercentile(100), TelemetryDuration{10ms});
+}
+
+TEST(EventTelemetryTest, recordEventsPerType) {
+  EventTelemetry telemetry;
+  auto const scroll = EventType{"scroll"};
+  auto const layout = EventType{"layout"};
+  auto start = TelemetryTimePoint{};
+
+  telemetry.recordEvent(scroll, start, start + 2ms, start + 3ms, start + 4ms);
+  telemetry.recordEvent(scroll, start, start + 2ms, start + 4ms, start + 5ms);
+  telemetry.recordEvent(layout, start, start + 2ms, start + 5ms, start + 6ms);
+
+  EXPECT_EQ(
+      telemetry.getEventTypes(), (std::vector<EventType>{scroll, layout}));
+
+  auto scrollHistograms = telemetry.getEventTypeHistograms(scroll);
+  EXPECT_EQ(scrollHistograms.queueLatency.getCount(), 2);
+  EXPECT_EQ(scrollHistograms.queueLatency.getMax(), TelemetryDuration{2ms});
+  EXPECT_EQ(scrollHistograms.pipeDuration.getMax(), TelemetryDuration{1ms});
+  EXPECT_EQ(scrollHistograms.deliveryLatency.getMax(), TelemetryDuration{5ms});
+
+  auto pressHistograms = telemetry.getEventTypeHistograms(EventType{"press"});
+  EXPECT_EQ(pressHistograms.deliveryLatency.getCount(), 0);
+}
+
+TEST(EventTelemetryTest, clampEventsEnqueuedDuringBeat) {
+  EventTelemetry telemetry;
+  auto const scroll = EventType{"scroll"};
+  auto start = TelemetryTimePoint{};
+
+  telemetry.recordEvent(scroll, start + 2ms, start, start + 3ms, start + 4ms);
+
+  auto histograms = telemetry.getEventTypeHistograms(scroll);
+  EXPECT_EQ(histograms.queueLatency.getMax(), TelemetryDuration{0});
+  EXPECT_EQ(histograms.deliveryLatency.getMax(), TelemetryDuration{2ms});
+}
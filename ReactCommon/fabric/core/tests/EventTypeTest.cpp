@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/core/EventType.h>
+
+using namespace facebook::react;
+
+TEST(EventTypeTest, normalizeNames) {
+  EXPECT_EQ(EventType{"layout"}.getName(), "topLayout");
+  EXPECT_EQ(EventType{"topLayout"}.getName(), "topLayout");
+  EXPECT_EQ(EventType{"momentumScrollEnd"}.getName(), "topMomentumScrollEnd");
+}
+
+TEST(EventTypeTest, internNames) {
+  auto scroll = EventType{"scroll"};
+  auto topScroll = EventType{"topScroll"};
+  auto touchMove = EventType{std::string{"touchMove"}};
+
+  EXPECT_EQ(scroll, topScroll);
+  EXPECT_EQ(scroll, EventType{"scroll"});
+  EXPECT_NE(scroll, touchMove);
+  EXPECT_EQ(&scroll.getName(), &topScroll.getName());
+}
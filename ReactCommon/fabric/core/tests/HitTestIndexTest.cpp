@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/core/HitTestIndex.h>
+
+#include "TestComponent.h"
+
+using namespace facebook::react;
+
+class HitTestIndexTest : public ::testing::Test {
+ protected:
+  HitTestIndexTest()
+      : eventDispatcher_(std::shared_ptr<EventDispatcher const>()),
+        componentDescriptor_(TestComponentDescriptor({eventDispatcher_})) {
+    /*
+     * The structure:
+     * <A>            (1000x1000)
+     *  <AA/>         (a 10x10 grid of 90x90 cells, 100 apart)
+     *  ...
+     *  <AA><AAA/>    (the last cell has a 10x10 child)
+     * </A>
+     */
+    nodeA_ = createNode({{0, 0}, {1000, 1000}});
+    for (int i = 0; i < 100; i++) {
+      auto cell = createNode(
+          {{static_cast<Float>(i % 10 * 100), static_cast<Float>(i / 10 * 100)},
+           {90, 90}});
+      nodeA_->appendChild(cell);
+      cells_.push_back(cell);
+    }
+    nodeAAA_ = createNode({{10, 10}, {10, 10}});
+    cells_.back()->appendChild(nodeAAA_);
+  }
+
+  std::shared_ptr<TestShadowNode> createNode(facebook::react::Rect frame) {
+    auto family = std::make_shared<ShadowNodeFamily>(
+        ShadowNodeFamilyFragment{
+            /* .tag = */ nextTag_++,
+            /* .surfaceId = */ 1,
+            /* .eventEmitter = */ nullptr,
+        },
+        eventDispatcher_,
+        componentDescriptor_);
+    auto node = std::make_shared<TestShadowNode>(
+        ShadowNodeFragment{
+            /* .props = */ std::make_shared<const TestProps>(),
+            /* .children = */ ShadowNode::emptySharedShadowNodeSharedList(),
+        },
+        family,
+        TestShadowNode::BaseTraits());
+    auto layoutMetrics = EmptyLayoutMetrics;
+    layoutMetrics.frame = frame;
+    node->setLayoutMetrics(layoutMetrics);
+    return node;
+  }
+
+  void expectSameAsRecursive(HitTestIndex const &index) {
+    for (Float x = -5; x < 1010; x += 15) {
+      for (Float y = -5; y < 1010; y += 15) {
+        EXPECT_EQ(
+            index.findNodeAtPoint(nodeA_, {x, y}),
+            LayoutableShadowNode::findNodeAtPoint(nodeA_, {x, y}));
+      }
+    }
+  }
+
+  std::shared_ptr<EventDispatcher const> eventDispatcher_;
+  std::shared_ptr<TestShadowNode> nodeA_;
+  std::shared_ptr<TestShadowNode> nodeAAA_;
+  std::vector<std::shared_ptr<TestShadowNode>> cells_;
+  TestComponentDescriptor componentDescriptor_;
+  Tag nextTag_{1};
+};
+
+TEST_F(HitTestIndexTest, findsNodes) {
+  auto index = HitTestIndex{*nodeA_};
+
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {5, 5}), cells_[0]);
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {95, 5}), nodeA_);
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {350, 720}), cells_[73]);
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {915, 915}), nodeAAA_);
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {1001, 1001}), nullptr);
+  expectSameAsRecursive(index);
+}
+
+TEST_F(HitTestIndexTest, honorsTransforms) {
+  nodeA_->_transform = Transform::Translate(-100, -100, 0);
+  cells_[55]->_transform = Transform::Scale(2, 2, 0);
+
+  auto index = HitTestIndex{*nodeA_};
+
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {-95, -95}), cells_[0]);
+  expectSameAsRecursive(index);
+}
+
+TEST_F(HitTestIndexTest, honorsOrderIndex) {
+  // Overlaps its neighbours on every side.
+  cells_[44]->_transform = Transform::Scale(2, 2, 0);
+
+  auto index = HitTestIndex{*nodeA_};
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {530, 445}), cells_[44]);
+  expectSameAsRecursive(index);
+
+  cells_[45]->setOrderIndex(1);
+
+  auto reorderedIndex = HitTestIndex{*nodeA_};
+  EXPECT_EQ(reorderedIndex.findNodeAtPoint(nodeA_, {530, 445}), cells_[45]);
+  expectSameAsRecursive(reorderedIndex);
+}
+
+TEST_F(HitTestIndexTest, reusesPreviousIndex) {
+  auto previousIndex = HitTestIndex{*nodeA_};
+
+  auto newCell = std::static_pointer_cast<TestShadowNode>(cells_[0]->clone({}));
+  auto layoutMetrics = newCell->getLayoutMetrics();
+  layoutMetrics.frame.size = {190, 190};
+  newCell->setLayoutMetrics(layoutMetrics);
+  auto newNodeA = std::static_pointer_cast<TestShadowNode>(nodeA_->clone({}));
+  newNodeA->replaceChild(*cells_[0], newCell);
+  nodeA_ = newNodeA;
+
+  auto index = HitTestIndex{*nodeA_, &previousIndex};
+
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {150, 150}), newCell);
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {95, 5}), newCell);
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {250, 250}), cells_[22]);
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {915, 915}), nodeAAA_);
+  expectSameAsRecursive(index);
+}
+
+TEST_F(HitTestIndexTest, prunedIndexOnlyRetainsSharedNodes) {
+  auto previousIndex = std::make_shared<HitTestIndex const>(*nodeA_);
+  auto previousCell = std::weak_ptr<TestShadowNode>(cells_[0]);
+
+  auto newCell = std::static_pointer_cast<TestShadowNode>(cells_[0]->clone({}));
+  auto layoutMetrics = newCell->getLayoutMetrics();
+  layoutMetrics.frame.size = {190, 190};
+  newCell->setLayoutMetrics(layoutMetrics);
+  auto newNodeA = std::static_pointer_cast<TestShadowNode>(nodeA_->clone({}));
+  newNodeA->replaceChild(*cells_[0], newCell);
+
+  auto prunedIndex = HitTestIndex::prune(*newNodeA, *previousIndex);
+  ASSERT_NE(prunedIndex, nullptr);
+
+  previousIndex = nullptr;
+  nodeA_ = newNodeA;
+  cells_[0] = newCell;
+  EXPECT_TRUE(previousCell.expired());
+
+  auto index = HitTestIndex{*nodeA_, prunedIndex.get()};
+
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {150, 150}), newCell);
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {250, 250}), cells_[22]);
+  EXPECT_EQ(index.findNodeAtPoint(nodeA_, {915, 915}), nodeAAA_);
+  expectSameAsRecursive(index);
+}
@@ -6,10 +6,12 @@
  */
 
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <react/core/ConcreteShadowNode.h>
 #include <react/core/ShadowNode.h>
+#include <react/core/ShadowNodeIndex.h>
 
 #include "TestComponent.h"
 
@@ -290,3 +292,107 @@ TEST_F(ShadowNodeTest, handleState) {
   secondNode->sealRecursive();
   EXPECT_ANY_THROW(secondNode->setStateData(TestState{42}));
 }
+
+TEST_F(ShadowNodeTest, handleCloneTreeWithSeveralTargets) {
+  auto cloneCount = 0;
+  auto callback = [&](ShadowNode const &oldShadowNode) {
+    cloneCount++;
+    return oldShadowNode.clone({});
+  };
+
+  auto newNodeA = nodeA_->cloneTree({
+      {&nodeABA_->getFamily(), callback},
+      {&nodeABB_->getFamily(), callback},
+      {&nodeAC_->getFamily(), callback},
+  });
+  ASSERT_NE(newNodeA, nullptr);
+  EXPECT_EQ(cloneCount, 3);
+
+  auto const &newChildrenA = newNodeA->getChildren();
+  EXPECT_EQ(newChildrenA.at(0), nodeAA_);
+  EXPECT_NE(newChildrenA.at(1), nodeAB_);
+  EXPECT_NE(newChildrenA.at(2), nodeAC_);
+  EXPECT_TRUE(ShadowNode::sameFamily(*newChildrenA.at(2), *nodeAC_));
+
+  auto const &newChildrenAB = newChildrenA.at(1)->getChildren();
+  EXPECT_NE(newChildrenAB.at(0), nodeABA_);
+  EXPECT_NE(newChildrenAB.at(1), nodeABB_);
+  EXPECT_TRUE(ShadowNode::sameFamily(*newChildrenAB.at(0), *nodeABA_));
+  EXPECT_TRUE(ShadowNode::sameFamily(*newChildrenAB.at(1), *nodeABB_));
+
+  // The original tree is untouched.
+  EXPECT_EQ(nodeA_->getChildren().at(1), nodeAB_);
+  EXPECT_EQ(nodeAB_->getChildren().at(0), nodeABA_);
+}
+
+TEST_F(ShadowNodeTest, handleCloneTreeTargetOrder) {
+  auto nodes = std::vector<ShadowNode const *>{};
+  auto results = std::vector<ShadowNode::Shared>{};
+  auto callback = [&](ShadowNode const &oldShadowNode) {
+    nodes.push_back(&oldShadowNode);
+    auto newShadowNode = oldShadowNode.clone({});
+    results.push_back(newShadowNode);
+    return newShadowNode;
+  };
+
+  // `AB` is an ancestor of `ABA`, and `ABA` is a target twice.
+  auto newNodeA = nodeA_->cloneTree({
+      {&nodeAB_->getFamily(), callback},
+      {&nodeABA_->getFamily(), callback},
+      {&nodeABA_->getFamily(), callback},
+  });
+  ASSERT_NE(newNodeA, nullptr);
+  ASSERT_EQ(nodes.size(), 3);
+
+  // Callbacks of the same family are chained.
+  EXPECT_EQ(nodes.at(0), nodeABA_.get());
+  EXPECT_EQ(nodes.at(1), results.at(0).get());
+
+  // The ancestor sees its replaced child, and its result is used as is.
+  EXPECT_EQ(nodes.at(2)->getChildren().at(0), results.at(1));
+  EXPECT_EQ(newNodeA->getChildren().at(1), results.at(2));
+}
+
+TEST_F(ShadowNodeTest, handleCloneTreeSkipsMissingTargets) {
+  auto callback = [](ShadowNode const &oldShadowNode) {
+    return oldShadowNode.clone({});
+  };
+
+  EXPECT_EQ(nodeA_->cloneTree({{&nodeZ_->getFamily(), callback}}), nullptr);
+  EXPECT_EQ(nodeA_->cloneTree(ShadowNode::CloneTargetList{}), nullptr);
+
+  auto newNodeA = nodeA_->cloneTree({
+      {&nodeZ_->getFamily(), callback},
+      {&nodeAA_->getFamily(), callback},
+  });
+  ASSERT_NE(newNodeA, nullptr);
+  EXPECT_NE(newNodeA->getChildren().at(0), nodeAA_);
+  EXPECT_EQ(newNodeA->getChildren().at(1), nodeAB_);
+}
+
+TEST_F(ShadowNodeTest, handleShadowNodeIndex) {
+  auto index = ShadowNodeIndex{*nodeA_};
+
+  EXPECT_EQ(index.size(), 6);
+  EXPECT_EQ(index.find(nodeA_->getFamily()), nullptr);
+  EXPECT_EQ(index.find(nodeZ_->getFamily()), nullptr);
+  EXPECT_EQ(*index.find(nodeAA_->getFamily()), nodeAA_);
+  EXPECT_EQ(*index.find(nodeABB_->getFamily()), nodeABB_);
+
+  for (auto const &node : {nodeA_, nodeAA_, nodeAB_, nodeABB_, nodeZ_}) {
+    auto expected = node->getFamily().getAncestors(*nodeA_);
+    auto ancestors = index.getAncestors(node->getFamily());
+    ASSERT_EQ(ancestors.size(), expected.size());
+    for (int i = 0; i < ancestors.size(); i++) {
+      EXPECT_EQ(&ancestors[i].first.get(), &expected[i].first.get());
+      EXPECT_EQ(ancestors[i].second, expected[i].second);
+    }
+  }
+
+  auto ancestors = index.getAncestors(nodeABB_->getFamily());
+  ASSERT_EQ(ancestors.size(), 2);
+  EXPECT_EQ(&ancestors[0].first.get(), nodeA_.get());
+  EXPECT_EQ(ancestors[0].second, 1);
+  EXPECT_EQ(&ancestors[1].first.get(), nodeAB_.get());
+  EXPECT_EQ(ancestors[1].second, 1);
+}
@@ -58,6 +58,10 @@ class TestShadowNode : public ConcreteViewShadowNode<
   Transform getTransform() const override {
     return _transform;
   }
+
+  void setOrderIndex(int orderIndex) {
+    orderIndex_ = orderIndex;
+  }
 };
 
 class TestComponentDescriptor
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/components/scrollview/ScrollViewEventEmitter.h>
+#include <react/components/view/TouchEventEmitter.h>
+#include <react/components/view/ViewEventEmitter.h>
+#include <react/core/EventQueue.h>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+/*
+ * Counts heap allocations of the whole binary; the benchmarks below report
+ * the number of allocations per event.
+ */
+static std::atomic<size_t> allocationCount{0};
+
+void *operator new(size_t size) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (auto pointer = std::malloc(size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept {
+  std::free(pointer);
+}
+
+namespace facebook {
+namespace react {
+
+/*
+ * Enqueues events and takes them back (as the JavaScript thread does before
+ * delivering them) without a runtime.
+ */
+class PassThroughEventQueue : public EventQueue {
+ public:
+  PassThroughEventQueue()
+      : EventQueue(
+            [](jsi::Runtime &, RawEvent const &) {},
+            [](std::vector<StateUpdate> const &) {},
+            std::make_unique<EventBeat>(
+                std::make_shared<EventBeat::OwnerBox>())) {}
+
+  void passThrough(RawEvent const &rawEvent) const {
+    enqueueEvent(rawEvent);
+    benchmark::DoNotOptimize(takeEvents());
+  }
+};
+
+static TouchEvent createTouchEvent() {
+  auto touch = Touch{};
+  touch.identifier = 1;
+  touch.target = 42;
+  auto event = TouchEvent{};
+  event.touches.insert(touch);
+  event.changedTouches.insert(touch);
+  event.targetTouches.insert(touch);
+  return event;
+}
+
+/*
+ * Measures dispatching an event created by `createEvent` the way emitters
+ * do: creating the `RawEvent`, moving it through the queue and taking it
+ * out of the queue.
+ */
+template <typename CreateEvent>
+static void passThroughEvents(
+    benchmark::State &state,
+    CreateEvent const &createEvent) {
+  auto eventQueue = std::make_unique<PassThroughEventQueue>();
+  auto allocationCountBefore = allocationCount.load();
+  for (auto _ : state) {
+    eventQueue->passThrough(createEvent());
+  }
+  state.counters["allocationsPerEvent"] = benchmark::Counter(
+      static_cast<double>(allocationCount.load() - allocationCountBefore),
+      benchmark::Counter::kAvgIterations);
+}
+
+static void touchEventWithValueFactory(benchmark::State &state) {
+  static auto const type = EventType{"touchMove"};
+  auto event = createTouchEvent();
+  passThroughEvents(state, [&]() {
+    return RawEvent(
+        type,
+        [event](jsi::Runtime &runtime) {
+          return jsi::Value(static_cast<int>(event.touches.size()));
+        },
+        nullptr,
+        true);
+  });
+}
+BENCHMARK(touchEventWithValueFactory);
+
+static void touchEventWithTypedPayload(benchmark::State &state) {
+  static auto const type = EventType{"touchMove"};
+  auto event = createTouchEvent();
+  passThroughEvents(state, [&]() {
+    return RawEvent(
+        type, std::make_shared<TouchEventPayload>(event), nullptr, true);
+  });
+}
+BENCHMARK(touchEventWithTypedPayload);
+
+static void layoutEventWithValueFactory(benchmark::State &state) {
+  static auto const type = EventType{"layout"};
+  auto frame = Rect{{10, 20}, {300, 400}};
+  passThroughEvents(state, [&]() {
+    return RawEvent(
+        type,
+        [frame](jsi::Runtime &runtime) {
+          return jsi::Value(static_cast<double>(frame.size.width));
+        },
+        nullptr);
+  });
+}
+BENCHMARK(layoutEventWithValueFactory);
+
+static void layoutEventWithTypedPayload(benchmark::State &state) {
+  static auto const type = EventType{"layout"};
+  auto frame = Rect{{10, 20}, {300, 400}};
+  passThroughEvents(state, [&]() {
+    return RawEvent(type, std::make_shared<LayoutEventPayload>(frame), nullptr);
+  });
+}
+BENCHMARK(layoutEventWithTypedPayload);
+
+static void scrollEventWithValueFactory(benchmark::State &state) {
+  static auto const type = EventType{"scroll"};
+  auto metrics = ScrollViewMetrics{};
+  passThroughEvents(state, [&]() {
+    return RawEvent(
+        type,
+        [metrics](jsi::Runtime &runtime) {
+          return jsi::Value(static_cast<double>(metrics.contentOffset.y));
+        },
+        nullptr,
+        true);
+  });
+}
+BENCHMARK(scrollEventWithValueFactory);
+
+static void scrollEventWithTypedPayload(benchmark::State &state) {
+  static auto const type = EventType{"scroll"};
+  auto metrics = ScrollViewMetrics{};
+  passThroughEvents(state, [&]() {
+    return RawEvent(
+        type, std::make_shared<ScrollViewEventPayload>(metrics), nullptr, true);
+  });
+}
+BENCHMARK(scrollEventWithTypedPayload);
+
+} // namespace react
+} // namespace facebook
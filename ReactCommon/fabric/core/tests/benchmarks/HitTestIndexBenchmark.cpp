@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/components/view/ViewComponentDescriptor.h>
+#include <react/core/EventDispatcher.h>
+#include <react/core/HitTestIndex.h>
+#include <react/core/LayoutableShadowNode.h>
+#include <react/utils/ContextContainer.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+static auto contextContainer = std::make_shared<ContextContainer const>();
+static auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+static auto viewComponentDescriptor = ViewComponentDescriptor{
+    ComponentDescriptorParameters{eventDispatcher, contextContainer}};
+
+constexpr Float kCellSize = 50;
+
+static std::shared_ptr<ViewShadowNode> createNode(
+    Tag tag,
+    Rect frame,
+    SharedShadowNodeSharedList const &children) {
+  auto family = viewComponentDescriptor.createFamily(
+      ShadowNodeFamilyFragment{tag, 1, nullptr}, nullptr);
+  auto shadowNode = std::make_shared<ViewShadowNode>(
+      ShadowNodeFragment{ViewShadowNode::defaultSharedProps(), children},
+      family,
+      ViewShadowNode::BaseTraits());
+  auto layoutMetrics = EmptyLayoutMetrics;
+  layoutMetrics.frame = frame;
+  shadowNode->setLayoutMetrics(layoutMetrics);
+  return shadowNode;
+}
+
+/*
+ * A `side` x `side` grid of cells with a label each, like a dense photo grid
+ * or a long list.
+ */
+static ShadowNode::Shared createGrid(int side) {
+  auto cells = std::make_shared<SharedShadowNodeList>();
+  auto tag = Tag{2};
+  for (int i = 0; i < side * side; i++) {
+    auto label = createNode(
+        tag++,
+        {{5, 5}, {kCellSize - 10, 10}},
+        ShadowNode::emptySharedShadowNodeSharedList());
+    cells->push_back(createNode(
+        tag++,
+        {{i % side * kCellSize, i / side * kCellSize}, {kCellSize, kCellSize}},
+        std::make_shared<SharedShadowNodeList>(SharedShadowNodeList{label})));
+  }
+  return createNode(1, {{0, 0}, {side * kCellSize, side * kCellSize}}, cells);
+}
+
+static std::vector<Point> createPoints(int side) {
+  auto generator = std::mt19937{42};
+  auto distribution = std::uniform_real_distribution<Float>(
+      0, side * kCellSize);
+  auto points = std::vector<Point>{};
+  for (int i = 0; i < 1024; i++) {
+    points.push_back({distribution(generator), distribution(generator)});
+  }
+  return points;
+}
+
+static void findNodeAtPointRecursively(benchmark::State &state) {
+  auto side = static_cast<int>(state.range(0));
+  auto root = createGrid(side);
+  auto points = createPoints(side);
+  auto i = size_t{0};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(LayoutableShadowNode::findNodeAtPoint(
+        root, points[i++ % points.size()]));
+  }
+}
+BENCHMARK(findNodeAtPointRecursively)->Arg(10)->Arg(30)->Arg(100);
+
+static void findNodeAtPointWithIndex(benchmark::State &state) {
+  auto side = static_cast<int>(state.range(0));
+  auto root = createGrid(side);
+  auto points = createPoints(side);
+  auto index = HitTestIndex{*root};
+  auto i = size_t{0};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        index.findNodeAtPoint(root, points[i++ % points.size()]));
+  }
+}
+BENCHMARK(findNodeAtPointWithIndex)->Arg(10)->Arg(30)->Arg(100);
+
+static void buildIndex(benchmark::State &state) {
+  auto root = createGrid(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(HitTestIndex{*root});
+  }
+}
+BENCHMARK(buildIndex)->Arg(10)->Arg(30)->Arg(100);
+
+/*
+ * Builds the index of a revision where one cell changed on top of the index
+ * of the previous revision.
+ */
+static void buildIndexIncrementally(benchmark::State &state) {
+  auto previousRoot = createGrid(static_cast<int>(state.range(0)));
+  auto previousIndex = HitTestIndex{*previousRoot};
+  auto root = previousRoot->cloneTree(
+      previousRoot->getChildren().front()->getFamily(),
+      [](ShadowNode const &oldShadowNode) {
+        return oldShadowNode.clone({});
+      });
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(HitTestIndex{*root, &previousIndex});
+  }
+}
+BENCHMARK(buildIndexIncrementally)->Arg(10)->Arg(30)->Arg(100);
+
+} // namespace react
+} // namespace facebook
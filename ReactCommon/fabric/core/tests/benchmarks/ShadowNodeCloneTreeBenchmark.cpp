@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/components/view/ViewComponentDescriptor.h>
+#include <react/core/EventDispatcher.h>
+#include <react/core/ShadowNode.h>
+#include <react/utils/ContextContainer.h>
+#include <memory>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+static auto contextContainer = std::make_shared<ContextContainer const>();
+static auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+static auto viewComponentDescriptor = ViewComponentDescriptor{
+    ComponentDescriptorParameters{eventDispatcher, contextContainer}};
+
+/*
+ * The structure:
+ * <View>           (root)
+ *   <View>         (list)
+ *     <View/>      (`itemCount` items)
+ *     ...
+ *   </View>
+ * </View>
+ */
+struct Tree {
+  ShadowNode::Shared root;
+  std::vector<ShadowNodeFamily const *> itemFamilies;
+};
+
+static ShadowNode::Shared createNode(
+    Tag tag,
+    SharedShadowNodeSharedList const &children) {
+  auto family = viewComponentDescriptor.createFamily(
+      ShadowNodeFamilyFragment{tag, 1, nullptr}, nullptr);
+  return viewComponentDescriptor.createShadowNode(
+      ShadowNodeFragment{ViewShadowNode::defaultSharedProps(), children},
+      family);
+}
+
+static Tree createTree(int itemCount) {
+  auto tree = Tree{};
+  auto items = std::make_shared<SharedShadowNodeList>();
+  for (int i = 0; i < itemCount; i++) {
+    items->push_back(
+        createNode(100 + i, ShadowNode::emptySharedShadowNodeSharedList()));
+    tree.itemFamilies.push_back(&items->back()->getFamily());
+  }
+  auto list = createNode(2, items);
+  tree.root = createNode(
+      1, std::make_shared<SharedShadowNodeList>(SharedShadowNodeList{list}));
+  return tree;
+}
+
+static ShadowNode::Unshared cloneNode(ShadowNode const &oldShadowNode) {
+  return oldShadowNode.clone({});
+}
+
+/*
+ * Updates every `itemCount / updateCount`-th item with one `cloneTree` call
+ * per item, like separate state updates committed one by one.
+ */
+static void cloneTreePerTarget(benchmark::State &state) {
+  auto tree = createTree(static_cast<int>(state.range(0)));
+  auto stride = tree.itemFamilies.size() / state.range(1);
+  for (auto _ : state) {
+    auto root = tree.root;
+    for (size_t i = 0; i < tree.itemFamilies.size(); i += stride) {
+      root = root->cloneTree(*tree.itemFamilies[i], cloneNode);
+    }
+    benchmark::DoNotOptimize(root);
+  }
+}
+BENCHMARK(cloneTreePerTarget)
+    ->Args({100, 1})
+    ->Args({100, 10})
+    ->Args({100, 100})
+    ->Args({1000, 100});
+
+/*
+ * Same updates as above, with one `cloneTree` call for all targets.
+ */
+static void cloneTreeMultiTarget(benchmark::State &state) {
+  auto tree = createTree(static_cast<int>(state.range(0)));
+  auto stride = tree.itemFamilies.size() / state.range(1);
+  auto targets = ShadowNode::CloneTargetList{};
+  for (size_t i = 0; i < tree.itemFamilies.size(); i += stride) {
+    targets.emplace_back(tree.itemFamilies[i], cloneNode);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(tree.root->cloneTree(targets));
+  }
+}
+BENCHMARK(cloneTreeMultiTarget)
+    ->Args({100, 1})
+    ->Args({100, 10})
+    ->Args({100, 100})
+    ->Args({1000, 100});
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/components/root/RootComponentDescriptor.h>
+#include <react/components/view/ViewComponentDescriptor.h>
+#include <react/core/EventDispatcher.h>
+#include <react/core/LayoutableShadowNode.h>
+#include <react/utils/ContextContainer.h>
+#include <memory>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+static auto contextContainer = std::make_shared<ContextContainer const>();
+static auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+static auto viewComponentDescriptor = ViewComponentDescriptor{
+    ComponentDescriptorParameters{eventDispatcher, contextContainer}};
+static auto rootComponentDescriptor = RootComponentDescriptor{
+    ComponentDescriptorParameters{eventDispatcher, contextContainer}};
+
+constexpr int kMeasureCount = 1000;
+
+/*
+ * The structure: `depth` levels of `fanout` views each, where the last view
+ * of every level is the parent of the next level. The leaves of the deepest
+ * levels are measured.
+ */
+struct Tree {
+  RootShadowNode::Shared root;
+  std::vector<ShadowNode const *> measuredNodes;
+};
+
+static Tree createTree(int depth, int fanout) {
+  auto tree = Tree{};
+  auto tag = Tag{2};
+  auto children = ShadowNode::emptySharedShadowNodeSharedList();
+  for (int level = 0; level < depth; level++) {
+    auto list = std::make_shared<SharedShadowNodeList>();
+    for (int i = 0; i < fanout; i++) {
+      auto family = viewComponentDescriptor.createFamily(
+          ShadowNodeFamilyFragment{tag++, 1, nullptr}, nullptr);
+      list->push_back(viewComponentDescriptor.createShadowNode(
+          ShadowNodeFragment{
+              /* .props = */ ViewShadowNode::defaultSharedProps(),
+              /* .children = */ i == fanout - 1
+                  ? children
+                  : ShadowNode::emptySharedShadowNodeSharedList(),
+          },
+          family));
+      if (level < 4 && i < fanout - 1) {
+        tree.measuredNodes.push_back(list->back().get());
+      }
+    }
+    children = list;
+  }
+
+  auto family = rootComponentDescriptor.createFamily(
+      ShadowNodeFamilyFragment{1, 1, nullptr}, nullptr);
+  tree.root = std::static_pointer_cast<RootShadowNode const>(
+      rootComponentDescriptor.createShadowNode(
+          ShadowNodeFragment{
+              /* .props = */ RootShadowNode::defaultSharedProps(),
+              /* .children = */ children,
+          },
+          family));
+  tree.root->sealRecursive();
+  return tree;
+}
+
+static void measure(benchmark::State &state, bool enableIndex) {
+  auto policy = LayoutableShadowNode::LayoutInspectingPolicy{};
+  for (auto _ : state) {
+    // Every iteration is a new revision, like the first burst of `measure`
+    // calls after a commit.
+    state.PauseTiming();
+    auto tree = createTree(
+        static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    if (enableIndex) {
+      tree.root->enableIndex();
+    }
+    state.ResumeTiming();
+
+    for (int i = 0; i < kMeasureCount; i++) {
+      auto const &shadowNode =
+          *tree.measuredNodes[i % tree.measuredNodes.size()];
+      benchmark::DoNotOptimize(
+          traitCast<LayoutableShadowNode const *>(&shadowNode)
+              ->getRelativeLayoutMetrics(*tree.root, policy));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kMeasureCount);
+}
+
+static void measureWithoutIndex(benchmark::State &state) {
+  measure(state, false);
+}
+BENCHMARK(measureWithoutIndex)->Args({16, 8})->Args({64, 8})->Args({64, 64});
+
+static void measureWithIndex(benchmark::State &state) {
+  measure(state, true);
+}
+BENCHMARK(measureWithIndex)->Args({16, 8})->Args({64, 8})->Args({64, 64});
+
+} // namespace react
+} // namespace facebook
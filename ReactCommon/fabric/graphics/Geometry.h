@@ -141,7 +141,7 @@ struct Rect {
     size = {x2 - x1, y2 - y1};
   }
 
-  bool containsPoint(Point point) {
+  bool containsPoint(Point point) const {
     return point.x >= origin.x && point.y >= origin.y &&
         point.x <= (origin.x + size.width) &&
         point.y <= (origin.y + size.height);
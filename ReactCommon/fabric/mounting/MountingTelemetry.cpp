@@ -113,5 +113,13 @@ int MountingTelemetry::getCommitNumber() const {
   return commitNumber_;
 }
 
+void MountingTelemetry::setStateUpdateCount(int stateUpdateCount) {
+  stateUpdateCount_ = stateUpdateCount;
+}
+
+int MountingTelemetry::getStateUpdateCount() const {
+  return stateUpdateCount_;
+}
+
 } // namespace react
 } // namespace facebook
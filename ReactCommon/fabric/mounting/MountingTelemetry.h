@@ -33,6 +33,12 @@ class MountingTelemetry final {
   void willMount();
   void didMount();
 
+  /*
+   * Number of state updates merged into the commit, if it was made to apply
+   * state updates.
+   */
+  void setStateUpdateCount(int stateUpdateCount);
+
   /*
    * Reading
    */
@@ -46,6 +52,7 @@ class MountingTelemetry final {
   TelemetryTimePoint getMountEndTime() const;
 
   int getCommitNumber() const;
+  int getStateUpdateCount() const;
 
  private:
   TelemetryTimePoint diffStartTime_{kTelemetryUndefinedTimePoint};
@@ -58,6 +65,7 @@ class MountingTelemetry final {
   TelemetryTimePoint mountEndTime_{kTelemetryUndefinedTimePoint};
 
   int commitNumber_{0};
+  int stateUpdateCount_{0};
 };
 
 } // namespace react
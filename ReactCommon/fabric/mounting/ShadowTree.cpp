@@ -141,11 +141,13 @@ void ShadowTree::commit(
 
 bool ShadowTree::tryCommit(
     ShadowTreeCommitTransaction transaction,
-    bool enableStateReconciliation) const {
+    bool enableStateReconciliation,
+    int stateUpdateCount) const {
   SystraceSection s("ShadowTree::tryCommit");
 
   auto telemetry = MountingTelemetry{};
   telemetry.willCommit();
+  telemetry.setStateUpdateCount(stateUpdateCount);
 
   RootShadowNode::Shared oldRootShadowNode;
 
@@ -182,6 +184,8 @@ bool ShadowTree::tryCommit(
 
   // Seal the shadow node so it can no longer be mutated
   newRootShadowNode->sealRecursive();
+  newRootShadowNode->enableIndex();
+  newRootShadowNode->inheritHitTestIndex(*oldRootShadowNode);
 
   auto revisionNumber = ShadowTreeRevision::Number{};
 
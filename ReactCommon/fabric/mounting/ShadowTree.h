@@ -51,11 +51,14 @@ class ShadowTree final {
    * Performs commit calling `transaction` function with a `oldRootShadowNode`
    * and expecting a `newRootShadowNode` as a return value.
    * The `transaction` function can abort commit returning `nullptr`.
+   * `stateUpdateCount` is the number of state updates the transaction
+   * applies, and is only recorded in the telemetry of the commit.
    * Returns `true` if the operation finished successfully.
    */
   bool tryCommit(
       ShadowTreeCommitTransaction transaction,
-      bool enableStateReconciliation = false) const;
+      bool enableStateReconciliation = false,
+      int stateUpdateCount = 0) const;
 
   /*
    * Calls `tryCommit` in a loop until it finishes successfully.
@@ -101,3 +101,15 @@ TEST(MountingTelemetryTest, abnormalUseCases) {
       },
       "commitEndTime_");
 }
+
+TEST(MountingTelemetryTest, stateUpdateCount) {
+  auto telemetry = MountingTelemetry{};
+  EXPECT_EQ(telemetry.getStateUpdateCount(), 0);
+
+  telemetry.willCommit();
+  telemetry.setStateUpdateCount(3);
+  telemetry.didCommit();
+
+  auto copy = telemetry;
+  EXPECT_EQ(copy.getStateUpdateCount(), 3);
+}
@@ -33,18 +33,14 @@ Scheduler::Scheduler(
   auto eventOwnerBox = std::make_shared<EventBeat::OwnerBox>();
 
   auto eventPipe = [uiManager](
-                       jsi::Runtime &runtime,
-                       const EventTarget *eventTarget,
-                       const std::string &type,
-                       const ValueFactory &payloadFactory) {
+                       jsi::Runtime &runtime, const RawEvent &rawEvent) {
     uiManager->visitBinding([&](UIManagerBinding const &uiManagerBinding) {
-      uiManagerBinding.dispatchEvent(
-          runtime, eventTarget, type, payloadFactory);
+      uiManagerBinding.dispatchEvent(runtime, rawEvent);
     });
   };
 
-  auto statePipe = [uiManager](StateUpdate const &stateUpdate) {
-    uiManager->updateState(stateUpdate);
+  auto statePipe = [uiManager](std::vector<StateUpdate> const &stateUpdates) {
+    uiManager->updateStates(stateUpdates);
   };
 
   eventDispatcher_ = std::make_shared<EventDispatcher>(
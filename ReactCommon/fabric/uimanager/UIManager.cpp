@@ -7,6 +7,8 @@
 
 #include "UIManager.h"
 
+#include <algorithm>
+
 #include <react/core/ShadowNodeFragment.h>
 #include <react/debug/SystraceSection.h>
 #include <react/graphics/Geometry.h>
@@ -126,16 +128,6 @@ void UIManager::clearJSResponder() const {
 
 ShadowNode::Shared const *UIManager::getNewestCloneOfShadowNode(
     ShadowNode::Shared const &shadowNode) const {
-  auto findNewestChildInParent =
-      [&](auto const &parentNode) -> ShadowNode::Shared const * {
-    for (auto const &child : parentNode.getChildren()) {
-      if (ShadowNode::sameFamily(*child, *shadowNode)) {
-        return &child;
-      }
-    }
-    return nullptr;
-  };
-
   ShadowNode const *ancestorShadowNode;
   shadowTreeRegistry_.visit(
       shadowNode->getSurfaceId(), [&](ShadowTree const &shadowTree) {
@@ -149,14 +141,45 @@ ShadowNode::Shared const *UIManager::getNewestCloneOfShadowNode(
 
   auto ancestors = shadowNode->getFamily().getAncestors(*ancestorShadowNode);
 
-  return findNewestChildInParent(ancestors.rbegin()->first.get());
+  auto const &parentAndIndex = *ancestors.rbegin();
+  return &parentAndIndex.first.get().getChildren()[parentAndIndex.second];
 }
 
 ShadowNode::Shared UIManager::findNodeAtPoint(
     ShadowNode::Shared const &node,
     Point point) const {
-  return LayoutableShadowNode::findNodeAtPoint(
-      *getNewestCloneOfShadowNode(node), point);
+  RootShadowNode::Shared rootShadowNode;
+  shadowTreeRegistry_.visit(
+      node->getSurfaceId(), [&](ShadowTree const &shadowTree) {
+        shadowTree.tryCommit(
+            [&](RootShadowNode::Shared const &oldRootShadowNode) {
+              rootShadowNode = oldRootShadowNode;
+              return nullptr;
+            },
+            true);
+      });
+
+  if (!rootShadowNode) {
+    return nullptr;
+  }
+
+  auto ancestors = node->getFamily().getAncestors(*rootShadowNode);
+  if (ancestors.empty()) {
+    return nullptr;
+  }
+
+  auto const &parentAndIndex = *ancestors.rbegin();
+  auto const &newestCloneOfShadowNode =
+      parentAndIndex.first.get().getChildren()[parentAndIndex.second];
+
+  // Committed trees are hit-tested with an index (shared by subsequent
+  // touches on the same revision), anything else recursively.
+  auto hitTestIndex = rootShadowNode->getHitTestIndex();
+  if (!hitTestIndex) {
+    return LayoutableShadowNode::findNodeAtPoint(
+        newestCloneOfShadowNode, point);
+  }
+  return hitTestIndex->findNodeAtPoint(newestCloneOfShadowNode, point);
 }
 
 void UIManager::setNativeProps(
@@ -216,30 +239,65 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
 }
 
 void UIManager::updateState(StateUpdate const &stateUpdate) const {
-  auto &callback = stateUpdate.callback;
-  auto &family = stateUpdate.family;
-  auto &componentDescriptor = family->getComponentDescriptor();
+  updateStates({stateUpdate});
+}
 
-  shadowTreeRegistry_.visit(
-      family->getSurfaceId(), [&](ShadowTree const &shadowTree) {
-        shadowTree.tryCommit([&](RootShadowNode::Shared const
-                                     &oldRootShadowNode) {
-          return std::static_pointer_cast<
-              RootShadowNode>(oldRootShadowNode->cloneTree(
-              *family, [&](ShadowNode const &oldShadowNode) {
-                auto newData =
-                    callback(oldShadowNode.getState()->getDataPointer());
-                auto newState =
-                    componentDescriptor.createState(*family, newData);
-
-                return oldShadowNode.clone({
-                    /* .props = */ ShadowNodeFragment::propsPlaceholder(),
-                    /* .children = */ ShadowNodeFragment::childrenPlaceholder(),
-                    /* .state = */ newState,
-                });
-              }));
+void UIManager::updateStates(
+    std::vector<StateUpdate> const &stateUpdates) const {
+  SystraceSection s("UIManager::updateStates");
+
+  // Updates grouped by surface, in the order the surfaces first appear.
+  auto surfaceUpdates =
+      std::vector<std::pair<SurfaceId, std::vector<StateUpdate const *>>>{};
+  for (auto const &stateUpdate : stateUpdates) {
+    auto surfaceId = stateUpdate.family->getSurfaceId();
+    auto it = std::find_if(
+        surfaceUpdates.begin(), surfaceUpdates.end(), [&](auto const &pair) {
+          return pair.first == surfaceId;
         });
-      });
+    if (it == surfaceUpdates.end()) {
+      surfaceUpdates.push_back({surfaceId, {}});
+      it = surfaceUpdates.end() - 1;
+    }
+    it->second.push_back(&stateUpdate);
+  }
+
+  for (auto const &pair : surfaceUpdates) {
+    auto const &updates = pair.second;
+    shadowTreeRegistry_.visit(pair.first, [&](ShadowTree const &shadowTree) {
+      shadowTree.tryCommit(
+          [&](RootShadowNode::Shared const &oldRootShadowNode) {
+            auto targets = ShadowNode::CloneTargetList{};
+            targets.reserve(updates.size());
+            for (auto stateUpdate : updates) {
+              targets.push_back(
+                  {stateUpdate->family.get(),
+                   [stateUpdate](ShadowNode const &oldShadowNode) {
+                     auto &family = *stateUpdate->family;
+                     auto newData = stateUpdate->callback(
+                         oldShadowNode.getState()->getDataPointer());
+                     auto newState =
+                         family.getComponentDescriptor().createState(
+                             family, newData);
+
+                     return oldShadowNode.clone({
+                         /* .props = */ ShadowNodeFragment::propsPlaceholder(),
+                         /* .children = */
+                         ShadowNodeFragment::childrenPlaceholder(),
+                         /* .state = */ newState,
+                     });
+                   }});
+            }
+
+            // Nodes which have been unmounted since their update was made are
+            // skipped; the other updates still apply.
+            return std::static_pointer_cast<RootShadowNode>(
+                oldRootShadowNode->cloneTree(targets));
+          },
+          false,
+          static_cast<int>(updates.size()));
+    });
+  }
 }
 
 void UIManager::dispatchCommand(
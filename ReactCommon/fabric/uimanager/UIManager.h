@@ -13,6 +13,7 @@
 
 #include <react/core/ShadowNode.h>
 #include <react/core/StateData.h>
+#include <react/core/StateUpdate.h>
 #include <react/mounting/ShadowTree.h>
 #include <react/mounting/ShadowTreeDelegate.h>
 #include <react/mounting/ShadowTreeRegistry.h>
@@ -111,6 +112,12 @@ class UIManager final : public ShadowTreeDelegate {
    */
   void updateState(StateUpdate const &stateUpdate) const;
 
+  /*
+   * Applies given state updates in order, with one commit per affected
+   * surface rather than one per update.
+   */
+  void updateStates(std::vector<StateUpdate> const &stateUpdates) const;
+
   void dispatchCommand(
       const ShadowNode::Shared &shadowNode,
       std::string const &commandName,
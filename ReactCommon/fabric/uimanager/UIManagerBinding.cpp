@@ -71,6 +71,7 @@ void UIManagerBinding::attach(std::shared_ptr<UIManager> const &uiManager) {
   }
 
   uiManager_ = uiManager;
+  methods_.clear();
 
   if (uiManager_) {
     uiManager_->uiManagerBinding_ = this;
@@ -125,12 +126,12 @@ void UIManagerBinding::stopSurface(jsi::Runtime &runtime, SurfaceId surfaceId)
 
 void UIManagerBinding::dispatchEvent(
     jsi::Runtime &runtime,
-    const EventTarget *eventTarget,
-    const std::string &type,
-    const ValueFactory &payloadFactory) const {
+    const RawEvent &rawEvent) const {
   SystraceSection s("UIManagerBinding::dispatchEvent");
 
-  auto payload = payloadFactory(runtime);
+  auto eventTarget = rawEvent.eventTarget.get();
+  auto type = rawEvent.type;
+  auto payload = rawEvent.createPayload(runtime, eventPayloadPropertyNames_);
 
   auto instanceHandle = eventTarget
     ? [&]() {
@@ -141,7 +142,10 @@ void UIManagerBinding::dispatchEvent(
 
       // Mixing `target` into `payload`.
       assert(payload.isObject());
-      payload.asObject(runtime).setProperty(runtime, "target", eventTarget->getTag());
+      payload.asObject(runtime).setProperty(
+          runtime,
+          eventPayloadPropertyNames_.get(runtime, "target"),
+          eventTarget->getTag());
       return instanceHandle;
     }()
     : jsi::Value::null();
@@ -149,10 +153,19 @@ void UIManagerBinding::dispatchEvent(
   auto &eventHandlerWrapper =
       static_cast<const EventHandlerWrapper &>(*eventHandler_);
 
+  auto id = static_cast<size_t>(type.getId());
+  if (id >= eventTypeNames_.size()) {
+    eventTypeNames_.resize(id + 1);
+  }
+  auto &eventTypeName = eventTypeNames_[id];
+  if (eventTypeName.isUndefined()) {
+    eventTypeName = jsi::String::createFromUtf8(runtime, type.getName());
+  }
+
   eventHandlerWrapper.callback.call(
       runtime,
       {std::move(instanceHandle),
-       jsi::String::createFromUtf8(runtime, type),
+       jsi::Value(runtime, eventTypeName),
        std::move(payload)});
 }
 
@@ -163,7 +176,23 @@ void UIManagerBinding::invalidate() const {
 jsi::Value UIManagerBinding::get(
     jsi::Runtime &runtime,
     const jsi::PropNameID &name) {
-  auto methodName = name.utf8(runtime);
+  if (methods_.empty()) {
+    createMethods(runtime);
+  }
+
+  // `PropNameID::compare` compares contents on some runtimes, so scanning
+  // the methods would cost a string comparison per method; converting the
+  // name once and hashing it costs the same for every method.
+  auto it = methods_.find(name.utf8(runtime));
+  if (it == methods_.end()) {
+    return jsi::Value::undefined();
+  }
+
+  return jsi::Value(runtime, it->second);
+}
+
+void UIManagerBinding::createMethods(jsi::Runtime &runtime) {
+  SystraceSection s("UIManagerBinding::createMethods");
 
   // Convert shared_ptr<UIManager> to a raw ptr
   // Why? Because:
@@ -194,411 +223,376 @@ jsi::Value UIManagerBinding::get(
   //    a CPU tick (or more) after the JS VM is deallocated.
   UIManager *uiManager = uiManager_.get();
 
+  auto addMethod = [&](char const *methodName,
+                       unsigned int paramCount,
+                       jsi::HostFunctionType function) {
+    methods_.emplace(
+        methodName,
+        jsi::Function::createFromHostFunction(
+            runtime,
+            jsi::PropNameID::forAscii(runtime, methodName),
+            paramCount,
+            std::move(function)));
+  };
+
   // Semantic: Creates a new node with given pieces.
-  if (methodName == "createNode") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        5,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          return valueFromShadowNode(
-              runtime,
-              uiManager->createNode(
-                  tagFromValue(runtime, arguments[0]),
-                  stringFromValue(runtime, arguments[1]),
-                  surfaceIdFromValue(runtime, arguments[2]),
-                  RawProps(runtime, arguments[3]),
-                  eventTargetFromValue(runtime, arguments[4], arguments[0])));
-        });
-  }
+  addMethod(
+      "createNode",
+      5,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        return valueFromShadowNode(
+            runtime,
+            uiManager->createNode(
+                tagFromValue(runtime, arguments[0]),
+                stringFromValue(runtime, arguments[1]),
+                surfaceIdFromValue(runtime, arguments[2]),
+                RawProps(runtime, arguments[3]),
+                eventTargetFromValue(runtime, arguments[4], arguments[0])));
+      });
 
   // Semantic: Clones the node with *same* props and *same* children.
-  if (methodName == "cloneNode") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        1,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          return valueFromShadowNode(
-              runtime,
-              uiManager->cloneNode(shadowNodeFromValue(runtime, arguments[0])));
-        });
-  }
-
-  if (methodName == "setJSResponder") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        2,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          uiManager->setJSResponder(
-              shadowNodeFromValue(runtime, arguments[0]),
-              arguments[1].getBool());
-
-          return jsi::Value::undefined();
-        });
-  }
-
-  if (methodName == "findNodeAtPoint") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        2,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          auto node = shadowNodeFromValue(runtime, arguments[0]);
-          auto locationX = (Float)arguments[1].getNumber();
-          auto locationY = (Float)arguments[2].getNumber();
-          auto onSuccessFunction =
-              arguments[3].getObject(runtime).getFunction(runtime);
-          auto targetNode =
-              uiManager->findNodeAtPoint(node, Point{locationX, locationY});
-          auto &eventTarget = targetNode->getEventEmitter()->eventTarget_;
-
-          EventEmitter::DispatchMutex().lock();
-          eventTarget->retain(runtime);
-          auto instanceHandle = eventTarget->getInstanceHandle(runtime);
-          eventTarget->release(runtime);
-          EventEmitter::DispatchMutex().unlock();
-
-          onSuccessFunction.call(runtime, std::move(instanceHandle));
-          return jsi::Value::undefined();
-        });
-  }
-
-  if (methodName == "clearJSResponder") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        0,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          uiManager->clearJSResponder();
-
-          return jsi::Value::undefined();
-        });
-  }
+  addMethod(
+      "cloneNode",
+      1,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        return valueFromShadowNode(
+            runtime,
+            uiManager->cloneNode(shadowNodeFromValue(runtime, arguments[0])));
+      });
 
   // Semantic: Clones the node with *same* props and *empty* children.
-  if (methodName == "cloneNodeWithNewChildren") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        1,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          return valueFromShadowNode(
-              runtime,
-              uiManager->cloneNode(
-                  shadowNodeFromValue(runtime, arguments[0]),
-                  ShadowNode::emptySharedShadowNodeSharedList()));
-        });
-  }
+  addMethod(
+      "cloneNodeWithNewChildren",
+      1,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        return valueFromShadowNode(
+            runtime,
+            uiManager->cloneNode(
+                shadowNodeFromValue(runtime, arguments[0]),
+                ShadowNode::emptySharedShadowNodeSharedList()));
+      });
 
   // Semantic: Clones the node with *given* props and *same* children.
-  if (methodName == "cloneNodeWithNewProps") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        2,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          const auto &rawProps = RawProps(runtime, arguments[1]);
-          return valueFromShadowNode(
-              runtime,
-              uiManager->cloneNode(
-                  shadowNodeFromValue(runtime, arguments[0]),
-                  nullptr,
-                  &rawProps));
-        });
-  }
+  addMethod(
+      "cloneNodeWithNewProps",
+      2,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        const auto &rawProps = RawProps(runtime, arguments[1]);
+        return valueFromShadowNode(
+            runtime,
+            uiManager->cloneNode(
+                shadowNodeFromValue(runtime, arguments[0]),
+                nullptr,
+                &rawProps));
+      });
 
   // Semantic: Clones the node with *given* props and *empty* children.
-  if (methodName == "cloneNodeWithNewChildrenAndProps") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        2,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          const auto &rawProps = RawProps(runtime, arguments[1]);
-          return valueFromShadowNode(
-              runtime,
-              uiManager->cloneNode(
-                  shadowNodeFromValue(runtime, arguments[0]),
-                  ShadowNode::emptySharedShadowNodeSharedList(),
-                  &rawProps));
-        });
-  }
-
-  if (methodName == "appendChild") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        2,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          uiManager->appendChild(
-              shadowNodeFromValue(runtime, arguments[0]),
-              shadowNodeFromValue(runtime, arguments[1]));
-          return jsi::Value::undefined();
-        });
-  }
-
-  if (methodName == "createChildSet") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        1,
-        [](jsi::Runtime &runtime,
-           const jsi::Value &thisValue,
-           const jsi::Value *arguments,
-           size_t count) -> jsi::Value {
-          auto shadowNodeList =
-              std::make_shared<SharedShadowNodeList>(SharedShadowNodeList({}));
-          return valueFromShadowNodeList(runtime, shadowNodeList);
-        });
-  }
-
-  if (methodName == "appendChildToSet") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        2,
-        [](jsi::Runtime &runtime,
-           const jsi::Value &thisValue,
-           const jsi::Value *arguments,
-           size_t count) -> jsi::Value {
-          auto shadowNodeList = shadowNodeListFromValue(runtime, arguments[0]);
-          auto shadowNode = shadowNodeFromValue(runtime, arguments[1]);
-          shadowNodeList->push_back(shadowNode);
-          return jsi::Value::undefined();
-        });
-  }
-
-  if (methodName == "completeRoot") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        2,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          uiManager->completeSurface(
-              surfaceIdFromValue(runtime, arguments[0]),
-              shadowNodeListFromValue(runtime, arguments[1]));
-          return jsi::Value::undefined();
-        });
-  }
-
-  if (methodName == "registerEventHandler") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        1,
-        [this](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          auto eventHandler =
-              arguments[0].getObject(runtime).getFunction(runtime);
-          eventHandler_ =
-              std::make_unique<EventHandlerWrapper>(std::move(eventHandler));
-          return jsi::Value::undefined();
-        });
-  }
-
-  if (methodName == "getRelativeLayoutMetrics") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        2,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
-              *shadowNodeFromValue(runtime, arguments[0]),
-              shadowNodeFromValue(runtime, arguments[1]).get(),
-              {/* .includeTransform = */ true});
-          auto frame = layoutMetrics.frame;
-          auto result = jsi::Object(runtime);
-          result.setProperty(runtime, "left", frame.origin.x);
-          result.setProperty(runtime, "top", frame.origin.y);
-          result.setProperty(runtime, "width", frame.size.width);
-          result.setProperty(runtime, "height", frame.size.height);
-          return result;
-        });
-  }
-
-  if (methodName == "dispatchCommand") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        3,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          uiManager->dispatchCommand(
-              shadowNodeFromValue(runtime, arguments[0]),
-              stringFromValue(runtime, arguments[1]),
-              commandArgsFromValue(runtime, arguments[2]));
-
+  addMethod(
+      "cloneNodeWithNewChildrenAndProps",
+      2,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        const auto &rawProps = RawProps(runtime, arguments[1]);
+        return valueFromShadowNode(
+            runtime,
+            uiManager->cloneNode(
+                shadowNodeFromValue(runtime, arguments[0]),
+                ShadowNode::emptySharedShadowNodeSharedList(),
+                &rawProps));
+      });
+
+  addMethod(
+      "appendChild",
+      2,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        uiManager->appendChild(
+            shadowNodeFromValue(runtime, arguments[0]),
+            shadowNodeFromValue(runtime, arguments[1]));
+        return jsi::Value::undefined();
+      });
+
+  addMethod(
+      "createChildSet",
+      1,
+      [](jsi::Runtime &runtime,
+         const jsi::Value &thisValue,
+         const jsi::Value *arguments,
+         size_t count) -> jsi::Value {
+        auto shadowNodeList =
+            std::make_shared<SharedShadowNodeList>(SharedShadowNodeList({}));
+        return valueFromShadowNodeList(runtime, shadowNodeList);
+      });
+
+  addMethod(
+      "appendChildToSet",
+      2,
+      [](jsi::Runtime &runtime,
+         const jsi::Value &thisValue,
+         const jsi::Value *arguments,
+         size_t count) -> jsi::Value {
+        auto shadowNodeList = shadowNodeListFromValue(runtime, arguments[0]);
+        auto shadowNode = shadowNodeFromValue(runtime, arguments[1]);
+        shadowNodeList->push_back(shadowNode);
+        return jsi::Value::undefined();
+      });
+
+  addMethod(
+      "completeRoot",
+      2,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        uiManager->completeSurface(
+            surfaceIdFromValue(runtime, arguments[0]),
+            shadowNodeListFromValue(runtime, arguments[1]));
+        return jsi::Value::undefined();
+      });
+
+  addMethod(
+      "setJSResponder",
+      2,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        uiManager->setJSResponder(
+            shadowNodeFromValue(runtime, arguments[0]),
+            arguments[1].getBool());
+
+        return jsi::Value::undefined();
+      });
+
+  addMethod(
+      "findNodeAtPoint",
+      2,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        auto node = shadowNodeFromValue(runtime, arguments[0]);
+        auto locationX = (Float)arguments[1].getNumber();
+        auto locationY = (Float)arguments[2].getNumber();
+        auto onSuccessFunction =
+            arguments[3].getObject(runtime).getFunction(runtime);
+        auto targetNode =
+            uiManager->findNodeAtPoint(node, Point{locationX, locationY});
+
+        // The lock only guards reading the pointer, which
+        // `EventEmitter::setEnabled` resets when the view is unmounted.
+        // Retaining the copied target does not need it, like in
+        // `EventQueue::flushEvents`.
+        auto eventTarget = SharedEventTarget{};
+        if (targetNode) {
+          std::lock_guard<std::mutex> lock(EventEmitter::DispatchMutex());
+          eventTarget = targetNode->getEventEmitter()->eventTarget_;
+        }
+
+        if (!eventTarget) {
+          onSuccessFunction.call(runtime, jsi::Value::null());
           return jsi::Value::undefined();
-        });
-  }
+        }
+
+        eventTarget->retain(runtime);
+        auto instanceHandle = eventTarget->getInstanceHandle(runtime);
+        eventTarget->release(runtime);
+
+        onSuccessFunction.call(runtime, std::move(instanceHandle));
+        return jsi::Value::undefined();
+      });
+
+  addMethod(
+      "clearJSResponder",
+      0,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        uiManager->clearJSResponder();
+
+        return jsi::Value::undefined();
+      });
+
+  addMethod(
+      "registerEventHandler",
+      1,
+      [this](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        auto eventHandler =
+            arguments[0].getObject(runtime).getFunction(runtime);
+        eventHandler_ =
+            std::make_unique<EventHandlerWrapper>(std::move(eventHandler));
+        return jsi::Value::undefined();
+      });
+
+  addMethod(
+      "getRelativeLayoutMetrics",
+      2,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
+            *shadowNodeFromValue(runtime, arguments[0]),
+            shadowNodeFromValue(runtime, arguments[1]).get(),
+            {/* .includeTransform = */ true});
+        auto frame = layoutMetrics.frame;
+        auto result = jsi::Object(runtime);
+        result.setProperty(runtime, "left", frame.origin.x);
+        result.setProperty(runtime, "top", frame.origin.y);
+        result.setProperty(runtime, "width", frame.size.width);
+        result.setProperty(runtime, "height", frame.size.height);
+        return result;
+      });
+
+  addMethod(
+      "dispatchCommand",
+      3,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        uiManager->dispatchCommand(
+            shadowNodeFromValue(runtime, arguments[0]),
+            stringFromValue(runtime, arguments[1]),
+            commandArgsFromValue(runtime, arguments[2]));
+
+        return jsi::Value::undefined();
+      });
 
   // Legacy API
-  if (methodName == "measureLayout") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        4,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
-              *shadowNodeFromValue(runtime, arguments[0]),
-              shadowNodeFromValue(runtime, arguments[1]).get(),
-              {/* .includeTransform = */ false});
-
-          if (layoutMetrics == EmptyLayoutMetrics) {
-            auto onFailFunction =
-                arguments[2].getObject(runtime).getFunction(runtime);
-            onFailFunction.call(runtime);
-            return jsi::Value::undefined();
-          }
-
-          auto onSuccessFunction =
-              arguments[3].getObject(runtime).getFunction(runtime);
-          auto frame = layoutMetrics.frame;
-
-          onSuccessFunction.call(
-              runtime,
-              {jsi::Value{runtime, (double)frame.origin.x},
-               jsi::Value{runtime, (double)frame.origin.y},
-               jsi::Value{runtime, (double)frame.size.width},
-               jsi::Value{runtime, (double)frame.size.height}});
-          return jsi::Value::undefined();
-        });
-  }
-
-  if (methodName == "measure") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        2,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
-              *shadowNodeFromValue(runtime, arguments[0]),
-              nullptr,
-              {/* .includeTransform = */ true});
-          auto frame = layoutMetrics.frame;
-          auto onSuccessFunction =
-              arguments[1].getObject(runtime).getFunction(runtime);
-
-          onSuccessFunction.call(
-              runtime,
-              {0,
-               0,
-               jsi::Value{runtime, (double)frame.size.width},
-               jsi::Value{runtime, (double)frame.size.height},
-               jsi::Value{runtime, (double)frame.origin.x},
-               jsi::Value{runtime, (double)frame.origin.y}});
+  addMethod(
+      "measureLayout",
+      4,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
+            *shadowNodeFromValue(runtime, arguments[0]),
+            shadowNodeFromValue(runtime, arguments[1]).get(),
+            {/* .includeTransform = */ false});
+
+        if (layoutMetrics == EmptyLayoutMetrics) {
+          auto onFailFunction =
+              arguments[2].getObject(runtime).getFunction(runtime);
+          onFailFunction.call(runtime);
           return jsi::Value::undefined();
-        });
-  }
-
-  if (methodName == "measureInWindow") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        2,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
-              *shadowNodeFromValue(runtime, arguments[0]),
-              nullptr,
-              {/* .includeTransform = */ true});
-
-          auto onSuccessFunction =
-              arguments[1].getObject(runtime).getFunction(runtime);
-          auto frame = layoutMetrics.frame;
-
-          onSuccessFunction.call(
-              runtime,
-              {jsi::Value{runtime, (double)frame.origin.x},
-               jsi::Value{runtime, (double)frame.origin.y},
-               jsi::Value{runtime, (double)frame.size.width},
-               jsi::Value{runtime, (double)frame.size.height}});
-          return jsi::Value::undefined();
-        });
-  }
-
-  if (methodName == "setNativeProps") {
-    return jsi::Function::createFromHostFunction(
-        runtime,
-        name,
-        2,
-        [uiManager](
-            jsi::Runtime &runtime,
-            const jsi::Value &thisValue,
-            const jsi::Value *arguments,
-            size_t count) -> jsi::Value {
-          uiManager->setNativeProps(
-              *shadowNodeFromValue(runtime, arguments[0]),
-              RawProps(runtime, arguments[1]));
-
-          return jsi::Value::undefined();
-        });
-  }
-
-  return jsi::Value::undefined();
+        }
+
+        auto onSuccessFunction =
+            arguments[3].getObject(runtime).getFunction(runtime);
+        auto frame = layoutMetrics.frame;
+
+        onSuccessFunction.call(
+            runtime,
+            {jsi::Value{runtime, (double)frame.origin.x},
+             jsi::Value{runtime, (double)frame.origin.y},
+             jsi::Value{runtime, (double)frame.size.width},
+             jsi::Value{runtime, (double)frame.size.height}});
+        return jsi::Value::undefined();
+      });
+
+  addMethod(
+      "measure",
+      2,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
+            *shadowNodeFromValue(runtime, arguments[0]),
+            nullptr,
+            {/* .includeTransform = */ true});
+        auto frame = layoutMetrics.frame;
+        auto onSuccessFunction =
+            arguments[1].getObject(runtime).getFunction(runtime);
+
+        onSuccessFunction.call(
+            runtime,
+            {0,
+             0,
+             jsi::Value{runtime, (double)frame.size.width},
+             jsi::Value{runtime, (double)frame.size.height},
+             jsi::Value{runtime, (double)frame.origin.x},
+             jsi::Value{runtime, (double)frame.origin.y}});
+        return jsi::Value::undefined();
+      });
+
+  addMethod(
+      "measureInWindow",
+      2,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        auto layoutMetrics = uiManager->getRelativeLayoutMetrics(
+            *shadowNodeFromValue(runtime, arguments[0]),
+            nullptr,
+            {/* .includeTransform = */ true});
+
+        auto onSuccessFunction =
+            arguments[1].getObject(runtime).getFunction(runtime);
+        auto frame = layoutMetrics.frame;
+
+        onSuccessFunction.call(
+            runtime,
+            {jsi::Value{runtime, (double)frame.origin.x},
+             jsi::Value{runtime, (double)frame.origin.y},
+             jsi::Value{runtime, (double)frame.size.width},
+             jsi::Value{runtime, (double)frame.size.height}});
+        return jsi::Value::undefined();
+      });
+
+  addMethod(
+      "setNativeProps",
+      2,
+      [uiManager](
+          jsi::Runtime &runtime,
+          const jsi::Value &thisValue,
+          const jsi::Value *arguments,
+          size_t count) -> jsi::Value {
+        uiManager->setNativeProps(
+            *shadowNodeFromValue(runtime, arguments[0]),
+            RawProps(runtime, arguments[1]));
+
+        return jsi::Value::undefined();
+      });
 }
 
 } // namespace react
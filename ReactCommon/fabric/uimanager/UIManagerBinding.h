@@ -7,8 +7,14 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <folly/dynamic.h>
 #include <jsi/jsi.h>
+#include <react/core/EventPayload.h>
+#include <react/core/RawEvent.h>
 #include <react/uimanager/UIManager.h>
 #include <react/uimanager/primitives.h>
 
@@ -59,11 +65,7 @@ class UIManagerBinding : public jsi::HostObject {
    * Delivers raw event data to JavaScript.
    * Thread synchronization must be enforced externally.
    */
-  void dispatchEvent(
-      jsi::Runtime &runtime,
-      const EventTarget *eventTarget,
-      const std::string &type,
-      const ValueFactory &payloadFactory) const;
+  void dispatchEvent(jsi::Runtime &runtime, const RawEvent &rawEvent) const;
 
   /*
    * Invalidates the binding and underlying UIManager.
@@ -80,8 +82,31 @@ class UIManagerBinding : public jsi::HostObject {
   jsi::Value get(jsi::Runtime &runtime, const jsi::PropNameID &name) override;
 
  private:
+  /*
+   * Creates host functions for all methods exposed to JavaScript.
+   */
+  void createMethods(jsi::Runtime &runtime);
+
   std::shared_ptr<UIManager> uiManager_;
   std::unique_ptr<const EventHandler> eventHandler_;
+
+  /*
+   * Host functions returned by `get` by name, created on first access and
+   * reused until another `UIManager` is attached (they capture the
+   * `UIManager`).
+   */
+  std::unordered_map<std::string, jsi::Function> methods_;
+
+  /*
+   * JavaScript strings with the names of event types, indexed by
+   * `EventType::Id` and created on first dispatch of an event of the type.
+   */
+  mutable std::vector<jsi::Value> eventTypeNames_;
+
+  /*
+   * Property names of typed event payloads.
+   */
+  mutable EventPayloadPropertyNames eventPayloadPropertyNames_;
 };
 
 } // namespace react
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsi/JSCRuntime.h>
+#include <jsi/jsi.h>
+#include <react/core/BatchedEventQueue.h>
+#include <react/core/EventTarget.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr auto kFrameDuration = std::chrono::microseconds(8333);
+
+/*
+ * Beats when the owner of the runtime (the emulated JavaScript thread) asks
+ * it to.
+ */
+class ManualEventBeat : public EventBeat {
+ public:
+  using EventBeat::EventBeat;
+
+  void tick(jsi::Runtime &runtime) const {
+    beat(runtime);
+  }
+};
+
+static double toMicroseconds(TelemetryDuration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+/*
+ * Reports the telemetry of the queue (in microseconds) as counters: the
+ * latency of beats, the duration of flushes and, per event type, the
+ * latency from enqueueing to the return of the event pipe.
+ */
+static void reportTelemetry(
+    benchmark::State &state,
+    EventTelemetry const &telemetry) {
+  auto beatLatency = telemetry.getBeatLatencyHistogram();
+  state.counters["beatLatencyP50Us"] =
+      toMicroseconds(beatLatency.getPercentile(50));
+  state.counters["beatLatencyP99Us"] =
+      toMicroseconds(beatLatency.getPercentile(99));
+  state.counters["flushDurationP99Us"] =
+      toMicroseconds(telemetry.getFlushDurationHistogram().getPercentile(99));
+
+  for (auto const &type : telemetry.getEventTypes()) {
+    auto histograms = telemetry.getEventTypeHistograms(type);
+    state.counters[type.getName() + "DeliveryP50Us"] =
+        toMicroseconds(histograms.deliveryLatency.getPercentile(50));
+    state.counters[type.getName() + "DeliveryP99Us"] =
+        toMicroseconds(histograms.deliveryLatency.getPercentile(99));
+    state.counters[type.getName() + "PipeP99Us"] =
+        toMicroseconds(histograms.pipeDuration.getPercentile(99));
+  }
+}
+
+/*
+ * Emulates the UI thread producing a continuous stream of events at 120 Hz,
+ * `state.range(0)` events per frame (e.g. touch moves and scrolls of several
+ * views), while the JavaScript thread flushes the queue as often as it can.
+ * Measures the time the UI thread spends in `enqueueEvent`; the slowest
+ * enqueue is reported as `maxEnqueueNs`, along with the delivery latency from
+ * `EventTelemetry`.
+ */
+static void enqueueEventsAt120Hz(benchmark::State &state) {
+  auto runtime = jsc::makeJSCRuntime();
+
+  auto eventTargets = std::vector<SharedEventTarget>{};
+  auto instanceHandles = std::vector<jsi::Object>{};
+  for (int tag = 1; tag <= 8; tag++) {
+    instanceHandles.push_back(jsi::Object(*runtime));
+    eventTargets.push_back(std::make_shared<EventTarget>(
+        *runtime, jsi::Value(*runtime, instanceHandles.back()), tag));
+    eventTargets.back()->setEnabled(true);
+  }
+
+  auto eventBeat = std::make_unique<ManualEventBeat>(
+      std::make_shared<EventBeat::OwnerBox>());
+  auto const &manualEventBeat = *eventBeat;
+  auto propertyNames = EventPayloadPropertyNames{};
+  BatchedEventQueue eventQueue(
+      [&](jsi::Runtime &runtime, RawEvent const &rawEvent) {
+        rawEvent.createPayload(runtime, propertyNames);
+      },
+      [](std::vector<StateUpdate> const &stateUpdates) {},
+      std::move(eventBeat));
+
+  std::atomic<bool> isRunning{true};
+  auto jsThread = std::thread([&]() {
+    while (isRunning) {
+      manualEventBeat.tick(*runtime);
+      std::this_thread::yield();
+    }
+  });
+
+  static auto const scrollType = EventType{"scroll"};
+  static auto const layoutType = EventType{"layout"};
+  auto payloadFactory = ValueFactory{
+      [](jsi::Runtime &runtime) { return jsi::Object(runtime); }};
+
+  auto eventsPerFrame = static_cast<int>(state.range(0));
+  auto maxLatency = Clock::duration::zero();
+  for (auto _ : state) {
+    auto frameStart = Clock::now();
+    auto frameLatency = Clock::duration::zero();
+    for (int i = 0; i < eventsPerFrame; i++) {
+      auto event = RawEvent(
+          i % 2 == 1 ? scrollType : layoutType,
+          payloadFactory,
+          eventTargets[i % eventTargets.size()],
+          i % 2 == 1);
+      auto start = Clock::now();
+      eventQueue.enqueueEvent(event);
+      auto latency = Clock::now() - start;
+      frameLatency += latency;
+      maxLatency = std::max(maxLatency, latency);
+    }
+    state.SetIterationTime(
+        std::chrono::duration<double>(frameLatency).count());
+    std::this_thread::sleep_until(frameStart + kFrameDuration);
+  }
+
+  isRunning = false;
+  jsThread.join();
+
+  state.SetItemsProcessed(state.iterations() * eventsPerFrame);
+  state.counters["maxEnqueueNs"] = static_cast<double>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(maxLatency)
+          .count());
+  reportTelemetry(state, eventQueue.getTelemetry());
+}
+BENCHMARK(enqueueEventsAt120Hz)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(128)
+    ->Iterations(240)
+    ->UseManualTime();
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsi/JSCRuntime.h>
+#include <jsi/jsi.h>
+#include <react/uimanager/UIManagerBinding.h>
+#include <memory>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Accesses `nativeFabricUIManager` the way the React renderer does: for
+ * every commit, a child set is created and every updated host component
+ * looks up the clone and append methods; the commit ends with
+ * `completeRoot`. `UIManager` is not attached, so only methods which do not
+ * need it are called.
+ */
+static auto const reconcilerSource = std::string{
+    "(function(commits, updates) {"
+    "  var uiManager = nativeFabricUIManager;"
+    "  var found = 0;"
+    "  for (var c = 0; c < commits; c++) {"
+    "    var childSet = uiManager.createChildSet(1);"
+    "    for (var i = 0; i < updates; i++) {"
+    "      if (uiManager.cloneNodeWithNewProps) found++;"
+    "      if (uiManager.appendChildToSet) found++;"
+    "    }"
+    "    if (uiManager.completeRoot) found++;"
+    "  }"
+    "  return found;"
+    "})"};
+
+class BindingEnvironment {
+ public:
+  BindingEnvironment() : runtime_(jsc::makeJSCRuntime()) {
+    binding_ = UIManagerBinding::createAndInstallIfNeeded(*runtime_);
+  }
+
+  jsi::Runtime &runtime() {
+    return *runtime_;
+  }
+
+  UIManagerBinding &binding() {
+    return *binding_;
+  }
+
+ private:
+  std::unique_ptr<jsi::Runtime> runtime_;
+  std::shared_ptr<UIManagerBinding> binding_;
+};
+
+static void reconcilerCommit(benchmark::State &state) {
+  auto environment = BindingEnvironment{};
+  auto &runtime = environment.runtime();
+  auto reconciler =
+      runtime
+          .evaluateJavaScript(
+              std::make_shared<jsi::StringBuffer>(reconcilerSource), "")
+          .asObject(runtime)
+          .asFunction(runtime);
+  auto updates = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(reconciler.call(runtime, 1, updates));
+  }
+  state.SetItemsProcessed(state.iterations() * (updates * 2 + 2));
+}
+BENCHMARK(reconcilerCommit)->Arg(10)->Arg(100)->Arg(1000);
+
+/*
+ * Calls `get` directly with a frequently used method name (first in the
+ * table), a rarely used one (last in the table), and an unknown name.
+ */
+static void bindingGet(benchmark::State &state, char const *methodName) {
+  auto environment = BindingEnvironment{};
+  auto &runtime = environment.runtime();
+  auto name = jsi::PropNameID::forAscii(runtime, methodName);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(environment.binding().get(runtime, name));
+  }
+}
+
+static void bindingGetCreateNode(benchmark::State &state) {
+  bindingGet(state, "createNode");
+}
+BENCHMARK(bindingGetCreateNode);
+
+static void bindingGetSetNativeProps(benchmark::State &state) {
+  bindingGet(state, "setNativeProps");
+}
+BENCHMARK(bindingGetSetNativeProps);
+
+static void bindingGetUnknownName(benchmark::State &state) {
+  bindingGet(state, "toJSON");
+}
+BENCHMARK(bindingGetUnknownName);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
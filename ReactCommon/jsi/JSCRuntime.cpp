@@ -13,6 +13,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdlib>
+#include <cstring>
 #include <mutex>
 #include <queue>
 #include <sstream>
@@ -32,7 +33,7 @@ struct Lock {
   void unlock(const jsc::JSCRuntime &) const {}
 };
 
-class JSCRuntime : public jsi::Runtime {
+class JSCRuntime : public jsi::Runtime, public jsi::ArrayBufferFactory {
  public:
   // Creates new context in new context group
   JSCRuntime();
@@ -56,6 +57,9 @@ class JSCRuntime : public jsi::Runtime {
 
   bool isInspectable() override;
 
+  jsi::ArrayBuffer createArrayBuffer(
+      std::shared_ptr<jsi::MutableBuffer> buffer) override;
+
   void setDescription(const std::string &desc);
 
   // Please don't use the following two functions, only exposed for
@@ -241,9 +245,38 @@ class JSCRuntime : public jsi::Runtime {
   void checkException(JSValueRef exc, const char *msg);
   void checkException(JSValueRef res, JSValueRef exc, const char *msg);
 
+  // A bounded, direct-mapped table of the JSStringRefs of short ASCII
+  // strings. Most of them are property names like "left", "width" or
+  // "target", which are created over and over by native code.
+  class StringCache {
+   public:
+    static constexpr size_t kMaxLength = 32;
+    static constexpr size_t kSize = 256;
+
+    StringCache() = default;
+    StringCache(const StringCache &) = delete;
+    StringCache &operator=(const StringCache &) = delete;
+    ~StringCache();
+
+    // Returns a JSStringRef owned by the cache, which stays valid until the
+    // next call, or nullptr if str is too long or not ASCII.
+    JSStringRef get(const char *str, size_t length);
+
+   private:
+    struct Entry {
+      uint32_t hash;
+      uint32_t length;
+      char chars[kMaxLength];
+      JSStringRef ref{nullptr};
+    };
+
+    std::array<Entry, kSize> entries_;
+  };
+
   JSGlobalContextRef ctx_;
   std::atomic<bool> ctxInvalid_;
   std::string desc_;
+  StringCache stringCache_;
 #ifndef NDEBUG
   mutable std::atomic<intptr_t> objectCounter_;
   mutable std::atomic<intptr_t> symbolCounter_;
@@ -621,9 +654,60 @@ jsi::Runtime::PointerValue *JSCRuntime::clonePropNameID(
   return makeStringValue(string->str_);
 }
 
+constexpr size_t JSCRuntime::StringCache::kMaxLength;
+constexpr size_t JSCRuntime::StringCache::kSize;
+
+JSCRuntime::StringCache::~StringCache() {
+  for (auto &entry : entries_) {
+    if (entry.ref) {
+      JSStringRelease(entry.ref);
+    }
+  }
+}
+
+JSStringRef JSCRuntime::StringCache::get(const char *str, size_t length) {
+  if (length > kMaxLength) {
+    return nullptr;
+  }
+  // FNV-1a, which also checks that str is ASCII on the way.
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    auto c = static_cast<unsigned char>(str[i]);
+    if (c >= 0x80) {
+      return nullptr;
+    }
+    hash = (hash ^ c) * 16777619u;
+  }
+
+  Entry &entry = entries_[hash & (kSize - 1)];
+  if (entry.ref && entry.hash == hash && entry.length == length &&
+      memcmp(entry.chars, str, length) == 0) {
+    return entry.ref;
+  }
+
+  // ASCII maps one to one onto UTF-16, and unlike
+  // JSStringCreateWithUTF8CString this needs no NUL-terminated copy.
+  std::array<JSChar, kMaxLength> chars;
+  for (size_t i = 0; i < length; i++) {
+    chars[i] = static_cast<JSChar>(str[i]);
+  }
+  JSStringRef ref = JSStringCreateWithCharacters(chars.data(), length);
+  if (entry.ref) {
+    JSStringRelease(entry.ref);
+  }
+  entry.hash = hash;
+  entry.length = static_cast<uint32_t>(length);
+  memcpy(entry.chars, str, length);
+  entry.ref = ref;
+  return ref;
+}
+
 jsi::PropNameID JSCRuntime::createPropNameIDFromAscii(
     const char *str,
     size_t length) {
+  if (JSStringRef cached = stringCache_.get(str, length)) {
+    return createPropNameID(cached);
+  }
   // For system JSC this must is identical to a string
   std::string tmp(str, length);
   JSStringRef strRef = JSStringCreateWithUTF8CString(tmp.c_str());
@@ -635,6 +719,10 @@ jsi::PropNameID JSCRuntime::createPropNameIDFromAscii(
 jsi::PropNameID JSCRuntime::createPropNameIDFromUtf8(
     const uint8_t *utf8,
     size_t length) {
+  if (JSStringRef cached =
+          stringCache_.get(reinterpret_cast<const char *>(utf8), length)) {
+    return createPropNameID(cached);
+  }
   std::string tmp(reinterpret_cast<const char *>(utf8), length);
   JSStringRef strRef = JSStringCreateWithUTF8CString(tmp.c_str());
   auto res = createPropNameID(strRef);
@@ -668,6 +756,10 @@ jsi::String JSCRuntime::createStringFromAscii(const char *str, size_t length) {
 jsi::String JSCRuntime::createStringFromUtf8(
     const uint8_t *str,
     size_t length) {
+  if (JSStringRef cached =
+          stringCache_.get(reinterpret_cast<const char *>(str), length)) {
+    return createString(cached);
+  }
   std::string tmp(reinterpret_cast<const char *>(str), length);
   JSStringRef stringRef = JSStringCreateWithUTF8CString(tmp.c_str());
   auto result = createString(stringRef);
@@ -937,6 +1029,38 @@ bool JSCRuntime::isArrayBuffer(const jsi::Object &obj) const {
 #endif
 }
 
+jsi::ArrayBuffer JSCRuntime::createArrayBuffer(
+    std::shared_ptr<jsi::MutableBuffer> buffer) {
+#if defined(_JSC_NO_ARRAY_BUFFERS)
+  throw std::runtime_error("Unsupported");
+#else
+  uint8_t *bytes = buffer->data();
+  size_t size = buffer->size();
+  // JSC calls the deallocator once the ArrayBuffer is collected, which
+  // releases our reference to the buffer.
+  auto owner = new std::shared_ptr<jsi::MutableBuffer>(std::move(buffer));
+  JSValueRef exc = nullptr;
+  JSObjectRef arrayBuffer = JSObjectMakeArrayBufferWithBytesNoCopy(
+      ctx_,
+      bytes,
+      size,
+      [](void *, void *context) {
+        delete static_cast<std::shared_ptr<jsi::MutableBuffer> *>(context);
+      },
+      owner,
+      &exc);
+  if (!arrayBuffer || exc) {
+    // JSC hands the bytes to its ArrayBuffer before it can fail, and calls
+    // the deallocator when that is destroyed, so the holder itself is freed
+    // there and deleting it here would free it twice. Drop our reference now
+    // so a failed call never keeps the native buffer alive.
+    owner->reset();
+  }
+  checkException(arrayBuffer, exc);
+  return createObject(arrayBuffer).getArrayBuffer(*this);
+#endif
+}
+
 uint8_t *JSCRuntime::data(const jsi::ArrayBuffer &obj) {
 #if defined(_JSC_NO_ARRAY_BUFFERS)
   throw std::runtime_error("Unsupported");
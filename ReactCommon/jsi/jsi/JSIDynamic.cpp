@@ -17,14 +17,49 @@ using namespace facebook::jsi;
 namespace facebook {
 namespace jsi {
 
+DynamicConversionContext::DynamicConversionContext(
+    Runtime& runtime,
+    size_t maxPropNameIDs)
+    : runtime_(runtime), maxPropNameIDs_(maxPropNameIDs) {}
+
+const PropNameID& DynamicConversionContext::propNameID(
+    const std::string& utf8) {
+  auto it = propNameIDs_.find(utf8);
+  if (it != propNameIDs_.end()) {
+    ++hits_;
+    return it->second;
+  }
+
+  ++misses_;
+  if (propNameIDs_.size() >= maxPropNameIDs_) {
+    propNameIDs_.clear();
+  }
+  return propNameIDs_
+      .emplace(utf8, PropNameID::forUtf8(runtime_, utf8))
+      .first->second;
+}
+
+void DynamicConversionContext::clear() {
+  propNameIDs_.clear();
+}
+
 Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dyn) {
+  DynamicConversionContext context(runtime);
+  return valueFromDynamic(context, dyn);
+}
+
+Value valueFromDynamic(
+    DynamicConversionContext& context,
+    const folly::dynamic& dyn) {
+  Runtime& runtime = context.runtime();
   switch (dyn.type()) {
     case folly::dynamic::NULLT:
       return Value::null();
     case folly::dynamic::ARRAY: {
-      Array ret = Array(runtime, dyn.size());
-      for (size_t i = 0; i < dyn.size(); ++i) {
-        ret.setValueAtIndex(runtime, i, valueFromDynamic(runtime, dyn[i]));
+      size_t size = dyn.size();
+      Array ret = Array(runtime, size);
+      for (size_t i = 0; i < size; ++i) {
+        ret.setValueAtIndex(runtime, i, valueFromDynamic(context, dyn[i]));
       }
       return std::move(ret);
     }
@@ -40,12 +75,13 @@ Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dyn) {
     case folly::dynamic::OBJECT: {
       Object ret(runtime);
       for (const auto& element : dyn.items()) {
-        Value value = valueFromDynamic(runtime, element.second);
-        if (element.first.isNumber() || element.first.isString()) {
+        Value value = valueFromDynamic(context, element.second);
+        if (element.first.isString()) {
+          ret.setProperty(
+              runtime, context.propNameID(element.first.getString()), value);
+        } else if (element.first.isNumber()) {
           ret.setProperty(
-              runtime,
-              PropNameID::forUtf8(runtime, element.first.asString()),
-              value);
+              runtime, context.propNameID(element.first.asString()), value);
         }
       }
       return std::move(ret);
@@ -69,10 +105,12 @@ folly::dynamic dynamicFromValue(Runtime& runtime, const Value& value) {
     Object obj = value.getObject(runtime);
     if (obj.isArray(runtime)) {
       Array array = obj.getArray(runtime);
+      size_t size = array.size(runtime);
       folly::dynamic ret = folly::dynamic::array();
-      for (size_t i = 0; i < array.size(runtime); ++i) {
-        ret.push_back(
-            dynamicFromValue(runtime, array.getValueAtIndex(runtime, i)));
+      // Size the array once up front instead of growing it per element.
+      ret.resize(size);
+      for (size_t i = 0; i < size; ++i) {
+        ret[i] = dynamicFromValue(runtime, array.getValueAtIndex(runtime, i));
       }
       return ret;
     } else if (obj.isFunction(runtime)) {
@@ -80,7 +118,8 @@ folly::dynamic dynamicFromValue(Runtime& runtime, const Value& value) {
     } else {
       folly::dynamic ret = folly::dynamic::object();
       Array names = obj.getPropertyNames(runtime);
-      for (size_t i = 0; i < names.size(runtime); ++i) {
+      size_t size = names.size(runtime);
+      for (size_t i = 0; i < size; ++i) {
         String name = names.getValueAtIndex(runtime, i).getString(runtime);
         Value prop = obj.getProperty(runtime, name);
         if (prop.isUndefined()) {
@@ -100,5 +139,70 @@ folly::dynamic dynamicFromValue(Runtime& runtime, const Value& value) {
   }
 }
 
+namespace {
+
+// Deeper values (most likely cyclic objects) are rejected instead of
+// risking a native stack overflow.
+constexpr size_t kMaxWriteDepth = 512;
+
+void writeValueAtDepth(
+    Runtime& runtime,
+    const Value& value,
+    ValueWriter& writer,
+    size_t depth) {
+  if (value.isUndefined() || value.isNull()) {
+    writer.writeNull();
+  } else if (value.isBool()) {
+    writer.writeBool(value.getBool());
+  } else if (value.isNumber()) {
+    writer.writeNumber(value.getNumber());
+  } else if (value.isString()) {
+    writer.writeString(value.getString(runtime).utf8(runtime));
+  } else {
+    if (depth >= kMaxWriteDepth) {
+      throw JSINativeException(
+          "writeValue: value is nested too deeply (is it cyclic?)");
+    }
+    Object obj = value.getObject(runtime);
+    if (obj.isArray(runtime)) {
+      Array array = obj.getArray(runtime);
+      size_t size = array.size(runtime);
+      writer.beginArray(size);
+      for (size_t i = 0; i < size; ++i) {
+        writeValueAtDepth(
+            runtime, array.getValueAtIndex(runtime, i), writer, depth + 1);
+      }
+      writer.endArray();
+    } else if (obj.isFunction(runtime)) {
+      throw JSError(runtime, "JS Functions are not convertible to dynamic");
+    } else {
+      writer.beginObject();
+      Array names = obj.getPropertyNames(runtime);
+      size_t size = names.size(runtime);
+      for (size_t i = 0; i < size; ++i) {
+        String name = names.getValueAtIndex(runtime, i).getString(runtime);
+        Value prop = obj.getProperty(runtime, name);
+        if (prop.isUndefined()) {
+          continue;
+        }
+        writer.writeKey(name.utf8(runtime));
+        // Same substitution as dynamicFromValue().
+        if (prop.isObject() && prop.getObject(runtime).isFunction(runtime)) {
+          writer.writeNull();
+        } else {
+          writeValueAtDepth(runtime, prop, writer, depth + 1);
+        }
+      }
+      writer.endObject();
+    }
+  }
+}
+
+} // namespace
+
+void writeValue(Runtime& runtime, const Value& value, ValueWriter& writer) {
+  writeValueAtDepth(runtime, value, writer, 0);
+}
+
 } // namespace jsi
 } // namespace facebook
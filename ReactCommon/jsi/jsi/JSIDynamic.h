@@ -7,19 +7,105 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+
 #include <folly/dynamic.h>
 #include <jsi/jsi.h>
 
 namespace facebook {
 namespace jsi {
 
+/// Holds state which can be shared by many conversions between
+/// folly::dynamic and jsi::Value performed against the same runtime.
+/// Property names are interned for the lifetime of the context, so
+/// converting many objects with the same shape (e.g. a stream of events)
+/// creates each PropNameID only once.  A context must not outlive its
+/// runtime and, like the runtime, must not be used from multiple threads
+/// at once.
+class DynamicConversionContext {
+ public:
+  /// When the number of interned names reaches \c maxPropNameIDs the
+  /// table is flushed, which bounds the memory held by a long session.
+  explicit DynamicConversionContext(
+      Runtime& runtime,
+      size_t maxPropNameIDs = 512);
+
+  DynamicConversionContext(const DynamicConversionContext&) = delete;
+  DynamicConversionContext& operator=(const DynamicConversionContext&) =
+      delete;
+
+  Runtime& runtime() const {
+    return runtime_;
+  }
+
+  /// \return an interned PropNameID for the given utf8 name.  The
+  /// reference stays valid until the next call to propNameID() or clear().
+  const PropNameID& propNameID(const std::string& utf8);
+
+  /// Drops all interned names.
+  void clear();
+
+  size_t size() const {
+    return propNameIDs_.size();
+  }
+  size_t hits() const {
+    return hits_;
+  }
+  size_t misses() const {
+    return misses_;
+  }
+
+ private:
+  Runtime& runtime_;
+  size_t maxPropNameIDs_;
+  std::unordered_map<std::string, PropNameID> propNameIDs_;
+  size_t hits_{0};
+  size_t misses_{0};
+};
+
+/// Receives a jsi::Value as a stream of JSON-like tokens, without
+/// building an intermediate representation.  See writeValue().
+class ValueWriter {
+ public:
+  virtual ~ValueWriter() = default;
+
+  virtual void writeNull() = 0;
+  virtual void writeBool(bool value) = 0;
+  virtual void writeNumber(double value) = 0;
+  virtual void writeString(const std::string& value) = 0;
+
+  /// \c size is the number of elements which will follow.
+  virtual void beginArray(size_t size) = 0;
+  virtual void endArray() = 0;
+
+  /// Each member is reported as a writeKey() call followed by its value.
+  virtual void beginObject() = 0;
+  virtual void writeKey(const std::string& key) = 0;
+  virtual void endObject() = 0;
+};
+
 facebook::jsi::Value valueFromDynamic(
     facebook::jsi::Runtime& runtime,
     const folly::dynamic& dyn);
 
+facebook::jsi::Value valueFromDynamic(
+    DynamicConversionContext& context,
+    const folly::dynamic& dyn);
+
 folly::dynamic dynamicFromValue(
     facebook::jsi::Runtime& runtime,
     const facebook::jsi::Value& value);
 
+/// Streams \c value into \c writer using the same conversion rules as
+/// dynamicFromValue(): undefined becomes null, object members which are
+/// undefined are skipped, functions nested in objects become null, and a
+/// function anywhere else is a JSError.  Values nested more than 512 levels
+/// deep (e.g. cyclic objects) are a JSINativeException.
+void writeValue(
+    facebook::jsi::Runtime& runtime,
+    const facebook::jsi::Value& value,
+    ValueWriter& writer);
+
 } // namespace jsi
 } // namespace facebook
@@ -0,0 +1,473 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "JSIJson.h"
+
+#include <cmath>
+
+#include <folly/Conv.h>
+#include <folly/Range.h>
+
+namespace facebook {
+namespace jsi {
+
+namespace {
+
+constexpr char kHexDigits[] = "0123456789abcdef";
+
+// Deeper documents are rejected instead of risking a native stack overflow.
+constexpr size_t kMaxJsonDepth = 512;
+
+void appendUtf8(std::string& out, uint32_t codePoint) {
+  if (codePoint < 0x80) {
+    out.push_back(static_cast<char>(codePoint));
+  } else if (codePoint < 0x800) {
+    out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+    out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  } else if (codePoint < 0x10000) {
+    out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  } else {
+    out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+    out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  }
+}
+
+class JsonReader {
+ public:
+  JsonReader(DynamicConversionContext& context, const char* json, size_t length)
+      : context_(context),
+        runtime_(context.runtime()),
+        begin_(json),
+        current_(json),
+        end_(json + length) {}
+
+  Value parse() {
+    skipWhitespace();
+    Value value = parseValue(0);
+    skipWhitespace();
+    if (current_ != end_) {
+      fail("unexpected trailing characters");
+    }
+    return value;
+  }
+
+ private:
+  [[noreturn]] void fail(const char* reason) {
+    throw JSINativeException(folly::to<std::string>(
+        "Invalid JSON at offset ", current_ - begin_, ": ", reason));
+  }
+
+  void skipWhitespace() {
+    while (current_ != end_ &&
+           (*current_ == ' ' || *current_ == '\n' || *current_ == '\r' ||
+            *current_ == '\t')) {
+      ++current_;
+    }
+  }
+
+  void expect(char c) {
+    if (current_ == end_ || *current_ != c) {
+      fail("unexpected character");
+    }
+    ++current_;
+  }
+
+  void expectLiteral(const char* literal, size_t length) {
+    if (static_cast<size_t>(end_ - current_) < length ||
+        memcmp(current_, literal, length) != 0) {
+      fail("invalid literal");
+    }
+    current_ += length;
+  }
+
+  Value parseValue(size_t depth) {
+    if (current_ == end_) {
+      fail("unexpected end of input");
+    }
+    switch (*current_) {
+      case '{':
+        return parseObject(depth + 1);
+      case '[':
+        return parseArray(depth + 1);
+      case '"':
+        parseString(scratch_);
+        return String::createFromUtf8(runtime_, scratch_);
+      case 't':
+        expectLiteral("true", 4);
+        return true;
+      case 'f':
+        expectLiteral("false", 5);
+        return false;
+      case 'n':
+        expectLiteral("null", 4);
+        return Value::null();
+      default:
+        return parseNumber();
+    }
+  }
+
+  Value parseObject(size_t depth) {
+    if (depth > kMaxJsonDepth) {
+      fail("nesting too deep");
+    }
+    expect('{');
+    Object object(runtime_);
+    skipWhitespace();
+    if (current_ != end_ && *current_ == '}') {
+      ++current_;
+      return std::move(object);
+    }
+    while (true) {
+      skipWhitespace();
+      parseString(key_);
+      // The key must be interned before parsing the value, which reuses
+      // the scratch buffers.
+      PropNameID name = PropNameID(runtime_, context_.propNameID(key_));
+      skipWhitespace();
+      expect(':');
+      skipWhitespace();
+      object.setProperty(runtime_, name, parseValue(depth));
+      skipWhitespace();
+      if (current_ != end_ && *current_ == ',') {
+        ++current_;
+        continue;
+      }
+      expect('}');
+      return std::move(object);
+    }
+  }
+
+  Value parseArray(size_t depth) {
+    if (depth > kMaxJsonDepth) {
+      fail("nesting too deep");
+    }
+    expect('[');
+    // jsi::Array has a fixed size, so elements are collected first.
+    std::vector<Value> elements;
+    skipWhitespace();
+    if (current_ != end_ && *current_ == ']') {
+      ++current_;
+    } else {
+      while (true) {
+        skipWhitespace();
+        elements.push_back(parseValue(depth));
+        skipWhitespace();
+        if (current_ != end_ && *current_ == ',') {
+          ++current_;
+          continue;
+        }
+        expect(']');
+        break;
+      }
+    }
+    Array array(runtime_, elements.size());
+    for (size_t i = 0; i < elements.size(); ++i) {
+      array.setValueAtIndex(runtime_, i, std::move(elements[i]));
+    }
+    return std::move(array);
+  }
+
+  uint32_t parseHex4() {
+    if (end_ - current_ < 4) {
+      fail("truncated unicode escape");
+    }
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+      char c = *current_++;
+      value <<= 4;
+      if (c >= '0' && c <= '9') {
+        value |= c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        value |= c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        value |= c - 'A' + 10;
+      } else {
+        fail("invalid unicode escape");
+      }
+    }
+    return value;
+  }
+
+  void parseString(std::string& out) {
+    expect('"');
+    out.clear();
+    while (true) {
+      // Copy runs of plain characters in one go.
+      const char* run = current_;
+      while (current_ != end_ && *current_ != '"' && *current_ != '\\' &&
+             static_cast<unsigned char>(*current_) >= 0x20) {
+        ++current_;
+      }
+      out.append(run, current_ - run);
+      if (current_ == end_) {
+        fail("unterminated string");
+      }
+      char c = *current_++;
+      if (c == '"') {
+        return;
+      }
+      if (c != '\\') {
+        fail("unescaped control character in string");
+      }
+      if (current_ == end_) {
+        fail("unterminated string");
+      }
+      switch (*current_++) {
+        case '"':
+          out.push_back('"');
+          break;
+        case '\\':
+          out.push_back('\\');
+          break;
+        case '/':
+          out.push_back('/');
+          break;
+        case 'b':
+          out.push_back('\b');
+          break;
+        case 'f':
+          out.push_back('\f');
+          break;
+        case 'n':
+          out.push_back('\n');
+          break;
+        case 'r':
+          out.push_back('\r');
+          break;
+        case 't':
+          out.push_back('\t');
+          break;
+        case 'u': {
+          uint32_t codePoint = parseHex4();
+          if (codePoint >= 0xD800 && codePoint < 0xDC00 &&
+              end_ - current_ >= 6 && current_[0] == '\\' &&
+              current_[1] == 'u') {
+            const char* highEnd = current_;
+            current_ += 2;
+            uint32_t low = parseHex4();
+            if (low >= 0xDC00 && low < 0xE000) {
+              codePoint = 0x10000 + ((codePoint - 0xD800) << 10) +
+                  (low - 0xDC00);
+            } else {
+              // Not a pair; the second escape is decoded on its own.
+              current_ = highEnd;
+            }
+          }
+          appendUtf8(out, codePoint);
+          break;
+        }
+        default:
+          fail("invalid escape");
+      }
+    }
+  }
+
+  // \return whether at least one digit was consumed.
+  bool skipDigits() {
+    const char* start = current_;
+    while (current_ != end_ && *current_ >= '0' && *current_ <= '9') {
+      ++current_;
+    }
+    return current_ != start;
+  }
+
+  Value parseNumber() {
+    const char* start = current_;
+    if (*current_ != '-' && (*current_ < '0' || *current_ > '9')) {
+      fail("unexpected character");
+    }
+    if (*current_ == '-') {
+      ++current_;
+    }
+    // The integer part is either a single zero or starts with a non-zero
+    // digit; leading zeros (e.g. "01") are not valid JSON.
+    if (current_ != end_ && *current_ == '0') {
+      ++current_;
+    } else if (!skipDigits()) {
+      fail("invalid number");
+    }
+    if (current_ != end_ && *current_ == '.') {
+      ++current_;
+      if (!skipDigits()) {
+        fail("invalid number");
+      }
+    }
+    if (current_ != end_ && (*current_ == 'e' || *current_ == 'E')) {
+      ++current_;
+      if (current_ != end_ && (*current_ == '+' || *current_ == '-')) {
+        ++current_;
+      }
+      if (!skipDigits()) {
+        fail("invalid number");
+      }
+    }
+    auto result = folly::tryTo<double>(folly::StringPiece(start, current_));
+    if (!result.hasValue()) {
+      fail("invalid number");
+    }
+    return result.value();
+  }
+
+  DynamicConversionContext& context_;
+  Runtime& runtime_;
+  const char* begin_;
+  const char* current_;
+  const char* end_;
+  std::string scratch_;
+  std::string key_;
+};
+
+} // namespace
+
+JsonWriter::JsonWriter(std::string& buffer) : buffer_(buffer) {}
+
+void JsonWriter::writeSeparator() {
+  if (afterKey_) {
+    afterKey_ = false;
+    return;
+  }
+  if (hasMembers_.empty()) {
+    return;
+  }
+  if (hasMembers_.back()) {
+    buffer_.push_back(',');
+  } else {
+    hasMembers_.back() = true;
+  }
+}
+
+void JsonWriter::writeQuoted(const std::string& value) {
+  buffer_.push_back('"');
+  const char* run = value.data();
+  const char* end = value.data() + value.size();
+  for (const char* c = run; c != end; ++c) {
+    auto byte = static_cast<unsigned char>(*c);
+    if (byte >= 0x20 && byte != '"' && byte != '\\') {
+      continue;
+    }
+    buffer_.append(run, c - run);
+    run = c + 1;
+    switch (byte) {
+      case '"':
+        buffer_.append("\\\"", 2);
+        break;
+      case '\\':
+        buffer_.append("\\\\", 2);
+        break;
+      case '\n':
+        buffer_.append("\\n", 2);
+        break;
+      case '\r':
+        buffer_.append("\\r", 2);
+        break;
+      case '\t':
+        buffer_.append("\\t", 2);
+        break;
+      default: {
+        char escape[] = {'\\',
+                         'u',
+                         '0',
+                         '0',
+                         kHexDigits[byte >> 4],
+                         kHexDigits[byte & 0xF]};
+        buffer_.append(escape, sizeof(escape));
+        break;
+      }
+    }
+  }
+  buffer_.append(run, end - run);
+  buffer_.push_back('"');
+}
+
+void JsonWriter::writeNull() {
+  writeSeparator();
+  buffer_.append("null", 4);
+}
+
+void JsonWriter::writeBool(bool value) {
+  writeSeparator();
+  if (value) {
+    buffer_.append("true", 4);
+  } else {
+    buffer_.append("false", 5);
+  }
+}
+
+void JsonWriter::writeNumber(double value) {
+  writeSeparator();
+  if (!std::isfinite(value)) {
+    buffer_.append("null", 4);
+  } else if (value == 0) {
+    // Covers -0, which JSON.stringify also writes as 0.
+    buffer_.push_back('0');
+  } else {
+    folly::toAppend(value, &buffer_);
+  }
+}
+
+void JsonWriter::writeString(const std::string& value) {
+  writeSeparator();
+  writeQuoted(value);
+}
+
+void JsonWriter::beginArray(size_t) {
+  writeSeparator();
+  buffer_.push_back('[');
+  hasMembers_.push_back(false);
+}
+
+void JsonWriter::endArray() {
+  hasMembers_.pop_back();
+  buffer_.push_back(']');
+}
+
+void JsonWriter::beginObject() {
+  writeSeparator();
+  buffer_.push_back('{');
+  hasMembers_.push_back(false);
+}
+
+void JsonWriter::writeKey(const std::string& key) {
+  writeSeparator();
+  writeQuoted(key);
+  buffer_.push_back(':');
+  afterKey_ = true;
+}
+
+void JsonWriter::endObject() {
+  hasMembers_.pop_back();
+  buffer_.push_back('}');
+}
+
+void writeJson(Runtime& runtime, const Value& value, std::string& buffer) {
+  JsonWriter writer(buffer);
+  writeValue(runtime, value, writer);
+}
+
+std::string toJson(Runtime& runtime, const Value& value) {
+  std::string buffer;
+  writeJson(runtime, value, buffer);
+  return buffer;
+}
+
+Value valueFromJson(
+    DynamicConversionContext& context,
+    const char* json,
+    size_t length) {
+  return JsonReader(context, json, length).parse();
+}
+
+Value valueFromJson(DynamicConversionContext& context, const std::string& json) {
+  return valueFromJson(context, json.data(), json.size());
+}
+
+} // namespace jsi
+} // namespace facebook
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+
+namespace facebook {
+namespace jsi {
+
+/// A ValueWriter which appends compact JSON to a caller-owned buffer.
+/// The buffer is never cleared by the writer, so a caller which serializes
+/// many values can clear() and reuse one string and keep its capacity.
+///
+/// Numbers which are not finite are written as null, as JSON.stringify does.
+class JsonWriter : public ValueWriter {
+ public:
+  explicit JsonWriter(std::string& buffer);
+
+  void writeNull() override;
+  void writeBool(bool value) override;
+  void writeNumber(double value) override;
+  void writeString(const std::string& value) override;
+  void beginArray(size_t size) override;
+  void endArray() override;
+  void beginObject() override;
+  void writeKey(const std::string& key) override;
+  void endObject() override;
+
+ private:
+  void writeSeparator();
+  void writeQuoted(const std::string& value);
+
+  std::string& buffer_;
+  // One entry per open container; true once the container has a member.
+  std::vector<bool> hasMembers_;
+  bool afterKey_{false};
+};
+
+/// Appends the JSON representation of \c value to \c buffer in a single
+/// pass, without an intermediate folly::dynamic.  Follows the conversion
+/// rules of writeValue().
+void writeJson(Runtime& runtime, const Value& value, std::string& buffer);
+
+/// \return the JSON representation of \c value.
+std::string toJson(Runtime& runtime, const Value& value);
+
+/// Parses \c json directly into a jsi::Value, interning object keys in
+/// \c context.  Throws JSINativeException if the input is not valid JSON
+/// or is nested more than 512 levels deep.
+Value valueFromJson(
+    DynamicConversionContext& context,
+    const char* json,
+    size_t length);
+
+Value valueFromJson(DynamicConversionContext& context, const std::string& json);
+
+} // namespace jsi
+} // namespace facebook
@@ -8,6 +8,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <stdexcept>
 
 #include <jsi/instrumentation.h>
@@ -70,6 +71,10 @@ void throwJSError(Runtime& rt, const char* msg) {
 
 Buffer::~Buffer() = default;
 
+MutableBuffer::~MutableBuffer() = default;
+
+ArrayBufferFactory::~ArrayBufferFactory() = default;
+
 PreparedJavaScript::~PreparedJavaScript() = default;
 
 Value HostObject::get(Runtime&, const PropNameID&) {
@@ -136,6 +141,7 @@ Value Runtime::createValueFromJsonUtf8(const uint8_t* json, size_t length) {
   return parseJson.call(*this, String::createFromUtf8(*this, json, length));
 }
 
+
 Pointer& Pointer::operator=(Pointer&& other) {
   if (ptr_) {
     ptr_->invalidate();
@@ -211,6 +217,35 @@ Function Object::asFunction(Runtime& runtime) && {
   return std::move(*this).getFunction(runtime);
 }
 
+namespace {
+
+ArrayBuffer createArrayBuffer(
+    Runtime& runtime,
+    std::shared_ptr<MutableBuffer> buffer) {
+  if (auto factory = dynamic_cast<ArrayBufferFactory*>(&runtime)) {
+    return factory->createArrayBuffer(std::move(buffer));
+  }
+
+  Function arrayBufferCtor =
+      runtime.global().getPropertyAsFunction(runtime, "ArrayBuffer");
+  ArrayBuffer arrayBuffer =
+      arrayBufferCtor
+          .callAsConstructor(runtime, static_cast<double>(buffer->size()))
+          .getObject(runtime)
+          .getArrayBuffer(runtime);
+  if (buffer->size() > 0) {
+    memcpy(arrayBuffer.data(runtime), buffer->data(), buffer->size());
+  }
+  return arrayBuffer;
+}
+
+} // namespace
+
+ArrayBuffer::ArrayBuffer(
+    Runtime& runtime,
+    std::shared_ptr<MutableBuffer> buffer)
+    : ArrayBuffer(createArrayBuffer(runtime, std::move(buffer))) {}
+
 Value::Value(Value&& other) : Value(other.kind_) {
   if (kind_ == BooleanKind) {
     data_.boolean = other.data_.boolean;
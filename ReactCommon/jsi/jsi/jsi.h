@@ -52,6 +52,18 @@ class StringBuffer : public Buffer {
   std::string s_;
 };
 
+/// Base class for native memory which can back an ArrayBuffer without being
+/// copied.  The results of size() and data() must not change after
+/// construction, but the bytes pointed to by data() may be modified by both
+/// native code and JS.  The buffer is released, through its destructor, once
+/// neither the runtime nor native code refers to it any more.
+class JSI_EXPORT MutableBuffer {
+ public:
+  virtual ~MutableBuffer();
+  virtual size_t size() const = 0;
+  virtual uint8_t* data() = 0;
+};
+
 /// PreparedJavaScript is a base class representing JavaScript which is in a
 /// form optimized for execution, in a runtime-specific way. Construct one via
 /// jsi::Runtime::prepareJavaScript().
@@ -80,6 +92,20 @@ class Scope;
 class JSIException;
 class JSError;
 
+/// Optional interface for a Runtime which can back an ArrayBuffer with a
+/// MutableBuffer without copying it.  Runtime itself does not declare this,
+/// so that its vtable stays compatible with prebuilt runtimes; the
+/// ArrayBuffer constructor taking a MutableBuffer looks for it with
+/// dynamic_cast and copies the bytes when it is absent.
+class JSI_EXPORT ArrayBufferFactory {
+ public:
+  virtual ~ArrayBufferFactory();
+
+  /// \return an ArrayBuffer which shares the memory of \c buffer.
+  virtual ArrayBuffer createArrayBuffer(
+      std::shared_ptr<MutableBuffer> buffer) = 0;
+};
+
 /// A function which has this type can be registered as a function
 /// callable from JavaScript using Function::createFromHostFunction().
 /// When the function is called, args will point to the arguments, and
@@ -773,6 +799,12 @@ class ArrayBuffer : public Object {
   ArrayBuffer(ArrayBuffer&&) = default;
   ArrayBuffer& operator=(ArrayBuffer&&) = default;
 
+  /// Creates an ArrayBuffer backed by \c buffer, without copying it if the
+  /// runtime implements ArrayBufferFactory.  The runtime keeps \c buffer
+  /// alive until the ArrayBuffer is garbage collected.  Other runtimes copy
+  /// the bytes into a new ArrayBuffer created by JS, then release \c buffer.
+  ArrayBuffer(Runtime& runtime, std::shared_ptr<MutableBuffer> buffer);
+
   /// \return the size of the ArrayBuffer, according to its byteLength property.
   /// (C++ naming convention)
   size_t size(Runtime& runtime) const {
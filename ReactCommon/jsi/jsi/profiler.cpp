@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsi/profiler.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+namespace facebook {
+namespace jsi {
+
+namespace {
+
+class OwningProfilingRuntime : public ProfilingRuntimeDecorator<> {
+ public:
+  OwningProfilingRuntime(
+      std::unique_ptr<Runtime> plain,
+      std::shared_ptr<CallProfiler> profiler)
+      : ProfilingRuntimeDecorator<>(*plain, std::move(profiler)),
+        plain_(std::move(plain)) {}
+
+ private:
+  std::unique_ptr<Runtime> plain_;
+};
+
+} // namespace
+
+const char* profiledOperationName(ProfiledOperation operation) {
+  switch (operation) {
+    case ProfiledOperation::Call:
+      return "call";
+    case ProfiledOperation::CallAsConstructor:
+      return "callAsConstructor";
+    case ProfiledOperation::GetProperty:
+      return "getProperty";
+    case ProfiledOperation::SetProperty:
+      return "setProperty";
+    case ProfiledOperation::CreateObject:
+      return "createObject";
+    case ProfiledOperation::HostFunction:
+      return "hostFunction";
+  }
+  return "unknown";
+}
+
+uint64_t CallProfileReport::Entry::estimatedTotalNanos() const {
+  if (samples == 0) {
+    return 0;
+  }
+  return static_cast<uint64_t>(
+      static_cast<double>(totalNanos) * estimatedCount / samples);
+}
+
+std::string CallProfileReport::toString(size_t maxEntries) const {
+  std::string result;
+  char line[256];
+
+  for (size_t i = 0; i < kProfiledOperationCount; i++) {
+    snprintf(
+        line,
+        sizeof(line),
+        "%s: %" PRIu64 "\n",
+        profiledOperationName(static_cast<ProfiledOperation>(i)),
+        operationCounts[i]);
+    result += line;
+  }
+
+  snprintf(
+      line,
+      sizeof(line),
+      "%-18s %-32s %10s %12s %12s %12s\n",
+      "operation",
+      "name",
+      "samples",
+      "est. count",
+      "mean (us)",
+      "max (us)");
+  result += line;
+  for (size_t i = 0; i < entries.size() && i < maxEntries; i++) {
+    const Entry& entry = entries[i];
+    snprintf(
+        line,
+        sizeof(line),
+        "%-18s %-32.32s %10" PRIu64 " %12" PRIu64 " %12.2f %12.2f\n",
+        profiledOperationName(entry.operation),
+        entry.name.c_str(),
+        entry.samples,
+        entry.estimatedCount,
+        entry.totalNanos / 1000.0 / entry.samples,
+        entry.maxNanos / 1000.0);
+    result += line;
+  }
+  return result;
+}
+
+CallProfiler::CallProfiler(uint32_t sampleInterval)
+    : sampleInterval_(sampleInterval) {}
+
+void CallProfiler::setSampleInterval(uint32_t sampleInterval) {
+  sampleInterval_.store(sampleInterval, std::memory_order_relaxed);
+}
+
+void CallProfiler::record(
+    ProfiledOperation operation,
+    const std::string& name,
+    uint32_t sampleInterval,
+    std::chrono::nanoseconds duration) {
+  auto nanos = static_cast<uint64_t>(duration.count());
+  std::lock_guard<std::mutex> lock(mutex_);
+  Stats& stats = stats_[std::make_pair(operation, name)];
+  stats.samples++;
+  stats.estimatedCount += sampleInterval;
+  stats.totalNanos += nanos;
+  stats.maxNanos = std::max(stats.maxNanos, nanos);
+}
+
+void CallProfiler::addOperationCounts(
+    const uint64_t (&counts)[kProfiledOperationCount]) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < kProfiledOperationCount; i++) {
+    operationCounts_[i] += counts[i];
+  }
+}
+
+CallProfileReport CallProfiler::getReport() const {
+  CallProfileReport report;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::copy(
+        std::begin(operationCounts_),
+        std::end(operationCounts_),
+        std::begin(report.operationCounts));
+    report.entries.reserve(stats_.size());
+    for (const auto& it : stats_) {
+      const Stats& stats = it.second;
+      report.entries.push_back(CallProfileReport::Entry{it.first.first,
+                                                        it.first.second,
+                                                        stats.samples,
+                                                        stats.estimatedCount,
+                                                        stats.totalNanos,
+                                                        stats.maxNanos});
+    }
+  }
+  std::sort(
+      report.entries.begin(),
+      report.entries.end(),
+      [](const CallProfileReport::Entry& a, const CallProfileReport::Entry& b) {
+        return a.estimatedTotalNanos() > b.estimatedTotalNanos();
+      });
+  return report;
+}
+
+void CallProfiler::reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.clear();
+  std::fill(std::begin(operationCounts_), std::end(operationCounts_), 0);
+}
+
+std::unique_ptr<Runtime> makeProfilingRuntime(
+    std::unique_ptr<Runtime> plain,
+    std::shared_ptr<CallProfiler> profiler) {
+  return std::unique_ptr<Runtime>(
+      new OwningProfilingRuntime(std::move(plain), std::move(profiler)));
+}
+
+} // namespace jsi
+} // namespace facebook
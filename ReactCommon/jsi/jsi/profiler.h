@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <jsi/decorator.h>
+#include <jsi/jsi.h>
+
+namespace facebook {
+namespace jsi {
+
+/// The runtime operations a \c ProfilingRuntimeDecorator samples.
+enum class ProfiledOperation : uint8_t {
+  Call,
+  CallAsConstructor,
+  GetProperty,
+  SetProperty,
+  CreateObject,
+  HostFunction,
+};
+
+constexpr size_t kProfiledOperationCount = 6;
+
+JSI_EXPORT const char* profiledOperationName(ProfiledOperation operation);
+
+/// Aggregated results of a \c CallProfiler.
+struct JSI_EXPORT CallProfileReport {
+  struct Entry {
+    ProfiledOperation operation;
+    /// The host function or property name, empty for operations which are
+    /// not aggregated by name.
+    std::string name;
+    uint64_t samples;
+    /// samples scaled by the sample interval in effect when they were taken.
+    uint64_t estimatedCount;
+    uint64_t totalNanos;
+    uint64_t maxNanos;
+
+    /// Estimated total time spent in this entry across all operations,
+    /// sampled or not.
+    uint64_t estimatedTotalNanos() const;
+  };
+
+  /// Exact number of operations of each kind seen, indexed by
+  /// ProfiledOperation.
+  uint64_t operationCounts[kProfiledOperationCount];
+
+  /// Sorted by estimatedTotalNanos(), most expensive first.
+  std::vector<Entry> entries;
+
+  /// A human readable table of the entries, limited to maxEntries rows.
+  std::string toString(size_t maxEntries = 50) const;
+};
+
+/// Collects timings sampled by one or more \c ProfilingRuntimeDecorator
+/// instances.  All methods are thread-safe.
+///
+/// Only one operation in sampleInterval (on average) is timed, which keeps
+/// the cost of profiling a busy JS thread to a few percent.  Sampling is
+/// randomized so periodic workloads do not alias with the interval.  An
+/// interval of 0 disables sampling; operations are still counted.
+class JSI_EXPORT CallProfiler {
+ public:
+  explicit CallProfiler(uint32_t sampleInterval = 1000);
+
+  CallProfiler(const CallProfiler&) = delete;
+  CallProfiler& operator=(const CallProfiler&) = delete;
+
+  uint32_t getSampleInterval() const {
+    return sampleInterval_.load(std::memory_order_relaxed);
+  }
+
+  /// Takes effect on each decorator after its next sample.
+  void setSampleInterval(uint32_t sampleInterval);
+
+  void record(
+      ProfiledOperation operation,
+      const std::string& name,
+      uint32_t sampleInterval,
+      std::chrono::nanoseconds duration);
+
+  void addOperationCounts(const uint64_t (&counts)[kProfiledOperationCount]);
+
+  CallProfileReport getReport() const;
+  void reset();
+
+ private:
+  struct Stats {
+    uint64_t samples{0};
+    uint64_t estimatedCount{0};
+    uint64_t totalNanos{0};
+    uint64_t maxNanos{0};
+  };
+
+  std::atomic<uint32_t> sampleInterval_;
+
+  mutable std::mutex mutex_;
+  std::map<std::pair<ProfiledOperation, std::string>, Stats> stats_;
+  uint64_t operationCounts_[kProfiledOperationCount]{};
+};
+
+/// A decorator which feeds a \c CallProfiler with samples of calls, property
+/// accesses, object creation and host function entries.  Host function time
+/// is inclusive of any JS it calls back into.  Property accesses are
+/// aggregated by property name, host functions by the name they were created
+/// with.
+///
+/// Like the runtime itself, a decorator must only be used from one thread at
+/// a time.  Exact operation counts are flushed to the profiler whenever the
+/// sampling countdown expires, on flush(), and on destruction.
+template <typename Plain = Runtime, typename Base = Runtime>
+class ProfilingRuntimeDecorator : public RuntimeDecorator<Plain, Base> {
+ public:
+  using RD = RuntimeDecorator<Plain, Base>;
+
+  ProfilingRuntimeDecorator(
+      Plain& plain,
+      std::shared_ptr<CallProfiler> profiler)
+      : RD(plain), profiler_(std::move(profiler)) {
+    resetCountdown();
+  }
+
+  ~ProfilingRuntimeDecorator() override {
+    flush();
+  }
+
+  CallProfiler& profiler() {
+    return *profiler_;
+  }
+
+  void flush() {
+    profiler_->addOperationCounts(counts_);
+    for (auto& count : counts_) {
+      count = 0;
+    }
+  }
+
+ protected:
+  Object createObject() override {
+    if (!shouldSample(ProfiledOperation::CreateObject)) {
+      return RD::createObject();
+    }
+    Sample sample(*this, ProfiledOperation::CreateObject);
+    return RD::createObject();
+  }
+  Object createObject(std::shared_ptr<HostObject> ho) override {
+    if (!shouldSample(ProfiledOperation::CreateObject)) {
+      return RD::createObject(std::move(ho));
+    }
+    Sample sample(*this, ProfiledOperation::CreateObject, "HostObject");
+    return RD::createObject(std::move(ho));
+  }
+
+  HostFunctionType& getHostFunction(const Function& f) override {
+    HostFunctionType& hf = RD::getHostFunction(f);
+    if (auto profiled = hf.target<ProfiledHostFunction>()) {
+      return profiled->plainHF_;
+    }
+    return hf;
+  }
+
+  Value getProperty(const Object& o, const PropNameID& name) override {
+    if (!shouldSample(ProfiledOperation::GetProperty)) {
+      return RD::getProperty(o, name);
+    }
+    Sample sample(*this, ProfiledOperation::GetProperty, RD::utf8(name));
+    return RD::getProperty(o, name);
+  }
+  Value getProperty(const Object& o, const String& name) override {
+    if (!shouldSample(ProfiledOperation::GetProperty)) {
+      return RD::getProperty(o, name);
+    }
+    Sample sample(*this, ProfiledOperation::GetProperty, RD::utf8(name));
+    return RD::getProperty(o, name);
+  }
+  void setPropertyValue(Object& o, const PropNameID& name, const Value& value)
+      override {
+    if (!shouldSample(ProfiledOperation::SetProperty)) {
+      RD::setPropertyValue(o, name, value);
+      return;
+    }
+    Sample sample(*this, ProfiledOperation::SetProperty, RD::utf8(name));
+    RD::setPropertyValue(o, name, value);
+  }
+  void setPropertyValue(Object& o, const String& name, const Value& value)
+      override {
+    if (!shouldSample(ProfiledOperation::SetProperty)) {
+      RD::setPropertyValue(o, name, value);
+      return;
+    }
+    Sample sample(*this, ProfiledOperation::SetProperty, RD::utf8(name));
+    RD::setPropertyValue(o, name, value);
+  }
+
+  Function createFunctionFromHostFunction(
+      const PropNameID& name,
+      unsigned int paramCount,
+      HostFunctionType func) override {
+    return RD::createFunctionFromHostFunction(
+        name,
+        paramCount,
+        ProfiledHostFunction(*this, RD::utf8(name), std::move(func)));
+  }
+  Value call(
+      const Function& f,
+      const Value& jsThis,
+      const Value* args,
+      size_t count) override {
+    if (!shouldSample(ProfiledOperation::Call)) {
+      return RD::call(f, jsThis, args, count);
+    }
+    Sample sample(*this, ProfiledOperation::Call);
+    return RD::call(f, jsThis, args, count);
+  }
+  Value callAsConstructor(const Function& f, const Value* args, size_t count)
+      override {
+    if (!shouldSample(ProfiledOperation::CallAsConstructor)) {
+      return RD::callAsConstructor(f, args, count);
+    }
+    Sample sample(*this, ProfiledOperation::CallAsConstructor);
+    return RD::callAsConstructor(f, args, count);
+  }
+
+ private:
+  // How often to re-read the interval while sampling is disabled.
+  static constexpr uint32_t kDisabledRecheckInterval = 1 << 16;
+
+  // Times the rest of the enclosing scope, including when it throws.
+  class Sample {
+   public:
+    Sample(
+        ProfilingRuntimeDecorator& decorator,
+        ProfiledOperation operation,
+        std::string name = {})
+        : decorator_(decorator),
+          operation_(operation),
+          name_(std::move(name)),
+          sampleInterval_(decorator.sampledInterval_),
+          start_(std::chrono::steady_clock::now()) {}
+
+    ~Sample() {
+      auto duration = std::chrono::steady_clock::now() - start_;
+      decorator_.profiler_->record(
+          operation_, name_, sampleInterval_, duration);
+    }
+
+   private:
+    ProfilingRuntimeDecorator& decorator_;
+    ProfiledOperation operation_;
+    std::string name_;
+    uint32_t sampleInterval_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  // Wraps a host function so its entries are sampled under its name.
+  // getHostFunction() unwraps it again.
+  class ProfiledHostFunction {
+   public:
+    ProfiledHostFunction(
+        ProfilingRuntimeDecorator& decorator,
+        std::string name,
+        HostFunctionType plainHF)
+        : decorator_(decorator),
+          name_(std::move(name)),
+          plainHF_(std::move(plainHF)) {}
+
+    Value operator()(
+        Runtime& runtime,
+        const Value& thisVal,
+        const Value* args,
+        size_t count) {
+      if (!decorator_.shouldSample(ProfiledOperation::HostFunction)) {
+        return plainHF_(runtime, thisVal, args, count);
+      }
+      Sample sample(decorator_, ProfiledOperation::HostFunction, name_);
+      return plainHF_(runtime, thisVal, args, count);
+    }
+
+   private:
+    friend class ProfilingRuntimeDecorator;
+
+    ProfilingRuntimeDecorator& decorator_;
+    std::string name_;
+    HostFunctionType plainHF_;
+  };
+
+  bool shouldSample(ProfiledOperation operation) {
+    counts_[static_cast<size_t>(operation)]++;
+    if (--countdown_ != 0) {
+      return false;
+    }
+    flush();
+    sampledInterval_ = sampleInterval_;
+    resetCountdown();
+    return sampledInterval_ != 0;
+  }
+
+  void resetCountdown() {
+    sampleInterval_ = profiler_->getSampleInterval();
+    if (sampleInterval_ == 0) {
+      countdown_ = kDisabledRecheckInterval;
+      return;
+    }
+    // xorshift32; the countdown is uniform in [1, 2 * interval - 1], which
+    // averages to the interval.
+    random_ ^= random_ << 13;
+    random_ ^= random_ >> 17;
+    random_ ^= random_ << 5;
+    uint64_t range = 2 * static_cast<uint64_t>(sampleInterval_) - 1;
+    countdown_ = static_cast<uint32_t>(random_ % range) + 1;
+  }
+
+  std::shared_ptr<CallProfiler> profiler_;
+  uint64_t counts_[kProfiledOperationCount]{};
+  uint32_t countdown_{1};
+  uint32_t sampleInterval_{0};
+  uint32_t sampledInterval_{0};
+  uint32_t random_{0x9e3779b9};
+};
+
+/// Returns a runtime which profiles plain into profiler, and owns plain.
+JSI_EXPORT std::unique_ptr<Runtime> makeProfilingRuntime(
+    std::unique_ptr<Runtime> plain,
+    std::shared_ptr<CallProfiler> profiler);
+
+} // namespace jsi
+} // namespace facebook
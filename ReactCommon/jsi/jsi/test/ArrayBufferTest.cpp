@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+
+#include <memory>
+#include <vector>
+
+using namespace facebook::jsi;
+
+namespace {
+
+class ArrayBufferTest : public JSITestBase {};
+
+class VectorBuffer : public MutableBuffer {
+ public:
+  explicit VectorBuffer(std::vector<uint8_t> bytes)
+      : bytes_(std::move(bytes)) {}
+
+  size_t size() const override {
+    return bytes_.size();
+  }
+
+  uint8_t* data() override {
+    return bytes_.data();
+  }
+
+ private:
+  std::vector<uint8_t> bytes_;
+};
+
+} // namespace
+
+TEST_P(ArrayBufferTest, createFromMutableBuffer) {
+  ArrayBuffer arrayBuffer(
+      rt, std::make_shared<VectorBuffer>(std::vector<uint8_t>{1, 2, 3, 4}));
+
+  EXPECT_TRUE(arrayBuffer.isArrayBuffer(rt));
+  ASSERT_EQ(arrayBuffer.size(rt), 4);
+  EXPECT_EQ(arrayBuffer.data(rt)[0], 1);
+  EXPECT_EQ(arrayBuffer.data(rt)[3], 4);
+}
+
+TEST_P(ArrayBufferTest, factoryRuntimesShareMemory) {
+  if (!dynamic_cast<ArrayBufferFactory*>(&rt)) {
+    return;
+  }
+  auto buffer = std::make_shared<VectorBuffer>(std::vector<uint8_t>{1, 2});
+  ArrayBuffer arrayBuffer(rt, buffer);
+  EXPECT_EQ(arrayBuffer.data(rt), buffer->data());
+}
+
+TEST_P(ArrayBufferTest, createFromEmptyBuffer) {
+  ArrayBuffer arrayBuffer(
+      rt, std::make_shared<VectorBuffer>(std::vector<uint8_t>{}));
+  EXPECT_EQ(arrayBuffer.size(rt), 0);
+}
+
+TEST_P(ArrayBufferTest, bytesAreVisibleToJS) {
+  auto buffer = std::make_shared<VectorBuffer>(std::vector<uint8_t>{7, 8, 9});
+  ArrayBuffer arrayBuffer(rt, buffer);
+
+  auto byteAt = function(
+      "function(buffer, index) { return new Uint8Array(buffer)[index]; }");
+  EXPECT_EQ(byteAt.call(rt, arrayBuffer, 1).getNumber(), 8);
+
+  // JS writes land in the memory the ArrayBuffer reports, which is the
+  // native buffer itself when the runtime does not copy.
+  function("function(buffer) { new Uint8Array(buffer)[2] = 42; }")
+      .call(rt, arrayBuffer);
+  EXPECT_EQ(arrayBuffer.data(rt)[2], 42);
+  if (arrayBuffer.data(rt) == buffer->data()) {
+    EXPECT_EQ(buffer->data()[2], 42);
+  }
+}
+
+TEST_P(ArrayBufferTest, runtimeKeepsBufferAlive) {
+  std::weak_ptr<VectorBuffer> weakBuffer;
+  auto runtime = factory();
+  {
+    auto buffer =
+        std::make_shared<VectorBuffer>(std::vector<uint8_t>{5, 6});
+    weakBuffer = buffer;
+    ArrayBuffer arrayBuffer(*runtime, std::move(buffer));
+
+    // Native code no longer refers to the buffer, but JS still can.
+    EXPECT_EQ(arrayBuffer.size(*runtime), 2);
+    EXPECT_EQ(arrayBuffer.data(*runtime)[1], 6);
+  }
+
+  runtime.reset();
+  EXPECT_TRUE(weakBuffer.expired());
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    ArrayBufferTest,
+    ::testing::ValuesIn(runtimeGenerators()));
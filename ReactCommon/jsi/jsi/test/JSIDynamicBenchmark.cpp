@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+
+#include <memory>
+#include <string>
+
+// Measures conversions between folly::dynamic and jsi::Value on payloads
+// shaped like the events and method calls which cross the bridge.  The
+// runtime is supplied by the embedder through runtimeGenerators(), the same
+// way testlib.cpp gets it.
+
+using namespace facebook::jsi;
+
+namespace {
+
+folly::dynamic touchEventPayload() {
+  folly::dynamic touch = folly::dynamic::object("pageX", 120.5)(
+      "pageY", 433.25)("locationX", 20.5)("locationY", 33.25)("target", 42)(
+      "identifier", 1)("timestamp", 1234567.0)("force", 0);
+  return folly::dynamic::object("target", 42)("identifier", 1)(
+      "touches", folly::dynamic::array(touch))(
+      "changedTouches", folly::dynamic::array(touch))("pageX", 120.5)(
+      "pageY", 433.25)("locationX", 20.5)("locationY", 33.25)(
+      "timestamp", 1234567.0);
+}
+
+folly::dynamic scrollEventPayload() {
+  auto point = [](double x, double y) -> folly::dynamic {
+    return folly::dynamic::object("x", x)("y", y);
+  };
+  auto size = [](double width, double height) -> folly::dynamic {
+    return folly::dynamic::object("width", width)("height", height);
+  };
+  return folly::dynamic::object("contentOffset", point(0, 1200))(
+      "contentInset",
+      folly::dynamic::object("top", 0)("left", 0)("bottom", 0)("right", 0))(
+      "contentSize", size(375, 12000))("layoutMeasurement", size(375, 812))(
+      "zoomScale", 1);
+}
+
+folly::dynamic listPayload() {
+  auto items = folly::dynamic::array();
+  for (int i = 0; i < 100; i++) {
+    items.push_back(folly::dynamic::object("id", i)("title", "Item title")(
+        "subtitle", "Some longer subtitle text")("selected", i % 2 == 0));
+  }
+  return folly::dynamic::object("items", std::move(items));
+}
+
+class CountingWriter : public ValueWriter {
+ public:
+  void writeNull() override {
+    count++;
+  }
+  void writeBool(bool) override {
+    count++;
+  }
+  void writeNumber(double) override {
+    count++;
+  }
+  void writeString(const std::string&) override {
+    count++;
+  }
+  void beginArray(size_t) override {}
+  void endArray() override {}
+  void beginObject() override {}
+  void writeKey(const std::string&) override {
+    count++;
+  }
+  void endObject() override {}
+
+  size_t count{0};
+};
+
+std::unique_ptr<Runtime> makeRuntime() {
+  return runtimeGenerators().front()();
+}
+
+void valueFromDynamicBenchmark(
+    benchmark::State& state,
+    folly::dynamic (*payload)()) {
+  auto runtime = makeRuntime();
+  auto dyn = payload();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(valueFromDynamic(*runtime, dyn));
+  }
+}
+
+void valueFromDynamicWithContextBenchmark(
+    benchmark::State& state,
+    folly::dynamic (*payload)()) {
+  auto runtime = makeRuntime();
+  auto dyn = payload();
+  DynamicConversionContext context(*runtime);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(valueFromDynamic(context, dyn));
+  }
+}
+
+void dynamicFromValueBenchmark(
+    benchmark::State& state,
+    folly::dynamic (*payload)()) {
+  auto runtime = makeRuntime();
+  auto value = valueFromDynamic(*runtime, payload());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(dynamicFromValue(*runtime, value));
+  }
+}
+
+void writeValueBenchmark(
+    benchmark::State& state,
+    folly::dynamic (*payload)()) {
+  auto runtime = makeRuntime();
+  auto value = valueFromDynamic(*runtime, payload());
+  for (auto _ : state) {
+    CountingWriter writer;
+    writeValue(*runtime, value, writer);
+    benchmark::DoNotOptimize(writer.count);
+  }
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(valueFromDynamicBenchmark, touch, touchEventPayload);
+BENCHMARK_CAPTURE(valueFromDynamicBenchmark, scroll, scrollEventPayload);
+BENCHMARK_CAPTURE(valueFromDynamicBenchmark, list, listPayload);
+BENCHMARK_CAPTURE(
+    valueFromDynamicWithContextBenchmark,
+    touch,
+    touchEventPayload);
+BENCHMARK_CAPTURE(
+    valueFromDynamicWithContextBenchmark,
+    scroll,
+    scrollEventPayload);
+BENCHMARK_CAPTURE(valueFromDynamicWithContextBenchmark, list, listPayload);
+BENCHMARK_CAPTURE(dynamicFromValueBenchmark, touch, touchEventPayload);
+BENCHMARK_CAPTURE(dynamicFromValueBenchmark, scroll, scrollEventPayload);
+BENCHMARK_CAPTURE(dynamicFromValueBenchmark, list, listPayload);
+BENCHMARK_CAPTURE(writeValueBenchmark, touch, touchEventPayload);
+BENCHMARK_CAPTURE(writeValueBenchmark, scroll, scrollEventPayload);
+BENCHMARK_CAPTURE(writeValueBenchmark, list, listPayload);
+
+// The jsi benchmarks are linked into a single binary; this is its only main.
+BENCHMARK_MAIN();
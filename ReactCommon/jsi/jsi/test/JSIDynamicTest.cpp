@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <folly/dynamic.h>
+#include <gtest/gtest.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+
+#include <string>
+
+using namespace facebook::jsi;
+
+namespace {
+
+class JSIDynamicTest : public JSITestBase {
+ protected:
+  Function makeFunction() {
+    return Function::createFromHostFunction(
+        rt,
+        PropNameID::forAscii(rt, "f"),
+        0,
+        [](Runtime&, const Value&, const Value*, size_t) {
+          return Value::undefined();
+        });
+  }
+};
+
+// Records the tokens reported to a ValueWriter in a JSON-like notation.
+class RecordingWriter : public ValueWriter {
+ public:
+  void writeNull() override {
+    write("null");
+  }
+  void writeBool(bool value) override {
+    write(value ? "true" : "false");
+  }
+  void writeNumber(double value) override {
+    write(folly::to<std::string>(value));
+  }
+  void writeString(const std::string& value) override {
+    write("'" + value + "'");
+  }
+  void beginArray(size_t size) override {
+    write("[" + folly::to<std::string>(size) + ":");
+    separate_ = false;
+  }
+  void endArray() override {
+    tokens += "]";
+  }
+  void beginObject() override {
+    write("{");
+    separate_ = false;
+  }
+  void writeKey(const std::string& key) override {
+    write(key + "=");
+    separate_ = false;
+  }
+  void endObject() override {
+    tokens += "}";
+  }
+
+  std::string tokens;
+
+ private:
+  void write(const std::string& token) {
+    if (separate_) {
+      tokens += ",";
+    }
+    tokens += token;
+    separate_ = true;
+  }
+
+  bool separate_{false};
+};
+
+folly::dynamic makePayload() {
+  return folly::dynamic::object("null", nullptr)("bool", true)("int", 42)(
+      "double", 0.5)("string", "caf\xc3\xa9")(
+      "array", folly::dynamic::array(1, "two", folly::dynamic::array()))(
+      "object",
+      folly::dynamic::object("nested", folly::dynamic::object("x", -1)));
+}
+
+} // namespace
+
+TEST_P(JSIDynamicTest, roundTrip) {
+  auto payload = makePayload();
+  EXPECT_EQ(dynamicFromValue(rt, valueFromDynamic(rt, payload)), payload);
+
+  DynamicConversionContext context(rt);
+  EXPECT_EQ(
+      dynamicFromValue(rt, valueFromDynamic(context, payload)), payload);
+}
+
+TEST_P(JSIDynamicTest, roundTripScalars) {
+  folly::dynamic scalars[] = {nullptr, false, 0, -3.25, "", "text"};
+  for (const auto& scalar : scalars) {
+    EXPECT_EQ(dynamicFromValue(rt, valueFromDynamic(rt, scalar)), scalar);
+  }
+}
+
+TEST_P(JSIDynamicTest, largeIntegersBecomeDoubles) {
+  auto value = valueFromDynamic(rt, folly::dynamic(int64_t{1} << 60));
+  EXPECT_EQ(value.getNumber(), static_cast<double>(int64_t{1} << 60));
+}
+
+TEST_P(JSIDynamicTest, numericKeysBecomeStrings) {
+  auto value = valueFromDynamic(rt, folly::dynamic::object(7, "seven"));
+  folly::dynamic expected = folly::dynamic::object("7", "seven");
+  EXPECT_EQ(dynamicFromValue(rt, value), expected);
+}
+
+TEST_P(JSIDynamicTest, contextInternsPropertyNames) {
+  DynamicConversionContext context(rt);
+  folly::dynamic event = folly::dynamic::object("x", 1)("y", 2);
+
+  valueFromDynamic(context, event);
+  EXPECT_EQ(context.size(), 2);
+  EXPECT_EQ(context.misses(), 2);
+  EXPECT_EQ(context.hits(), 0);
+
+  auto value = valueFromDynamic(context, event);
+  EXPECT_EQ(context.size(), 2);
+  EXPECT_EQ(context.misses(), 2);
+  EXPECT_EQ(context.hits(), 2);
+  EXPECT_EQ(dynamicFromValue(rt, value), event);
+
+  context.clear();
+  EXPECT_EQ(context.size(), 0);
+}
+
+TEST_P(JSIDynamicTest, contextIsFlushedWhenFull) {
+  DynamicConversionContext context(rt, 2);
+  folly::dynamic event = folly::dynamic::object("a", 1)("b", 2)("c", 3);
+
+  auto value = valueFromDynamic(context, event);
+  EXPECT_LE(context.size(), 2);
+  EXPECT_EQ(dynamicFromValue(rt, value), event);
+}
+
+TEST_P(JSIDynamicTest, writeValueStreamsTokens) {
+  Array array(rt, 2);
+  array.setValueAtIndex(rt, 0, Value::null());
+  array.setValueAtIndex(rt, 1, true);
+  Object nested(rt);
+  nested.setProperty(rt, "c", "d");
+  Object object(rt);
+  object.setProperty(rt, "a", array);
+  object.setProperty(rt, "b", nested);
+
+  RecordingWriter writer;
+  writeValue(rt, Value(rt, object), writer);
+  EXPECT_EQ(writer.tokens, "{a=[2:null,true],b={c='d'}}");
+}
+
+TEST_P(JSIDynamicTest, writeValueMatchesDynamicFromValue) {
+  Object object(rt);
+  object.setProperty(rt, "defined", 1);
+  object.setProperty(rt, "undefined", Value::undefined());
+  object.setProperty(rt, "function", makeFunction());
+  Array array(rt, 2);
+  array.setValueAtIndex(rt, 0, Value::undefined());
+  array.setValueAtIndex(rt, 1, std::move(object));
+
+  // Undefined members are skipped, undefined elements and functions in
+  // objects become null.
+  folly::dynamic expected = folly::dynamic::array(
+      nullptr, folly::dynamic::object("defined", 1)("function", nullptr));
+  EXPECT_EQ(dynamicFromValue(rt, Value(rt, array)), expected);
+
+  RecordingWriter writer;
+  writeValue(rt, Value(rt, array), writer);
+  EXPECT_EQ(writer.tokens, "[2:null,{defined=1,function=null}]");
+}
+
+TEST_P(JSIDynamicTest, functionsAreNotConvertible) {
+  RecordingWriter writer;
+  EXPECT_THROW(writeValue(rt, makeFunction(), writer), JSIException);
+  EXPECT_THROW(dynamicFromValue(rt, makeFunction()), JSIException);
+
+  Array array(rt, 1);
+  array.setValueAtIndex(rt, 0, makeFunction());
+  EXPECT_THROW(writeValue(rt, Value(rt, array), writer), JSIException);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    JSIDynamicTest,
+    ::testing::ValuesIn(runtimeGenerators()));
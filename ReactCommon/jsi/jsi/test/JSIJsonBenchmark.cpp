@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/JSIJson.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+
+#include <memory>
+#include <string>
+
+// Compares the single-pass JSON writer and reader with the
+// folly::dynamic round trip and with the engine's own JSON object, on
+// payloads of growing size.  The runtime is supplied by the embedder through
+// runtimeGenerators().
+
+using namespace facebook::jsi;
+
+namespace {
+
+folly::dynamic makePayload(int64_t count) {
+  auto rows = folly::dynamic::array();
+  for (int64_t i = 0; i < count; i++) {
+    folly::dynamic row = folly::dynamic::object("id", i)("name", "Row name")(
+        "description", "A somewhat longer \"quoted\" description\n");
+    row["score"] = i * 0.25;
+    row["enabled"] = i % 3 == 0;
+    row["tags"] = folly::dynamic::array("alpha", "beta");
+    row["parent"] = nullptr;
+    rows.push_back(std::move(row));
+  }
+  return folly::dynamic::object("rows", std::move(rows))("count", count);
+}
+
+std::unique_ptr<Runtime> makeRuntime() {
+  return runtimeGenerators().front()();
+}
+
+void writeJsonBenchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  auto value = valueFromDynamic(*runtime, makePayload(state.range(0)));
+  std::string buffer;
+  for (auto _ : state) {
+    buffer.clear();
+    writeJson(*runtime, value, buffer);
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+BENCHMARK(writeJsonBenchmark)->Range(8, 8 << 10);
+
+void dynamicToJsonBenchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  auto value = valueFromDynamic(*runtime, makePayload(state.range(0)));
+  size_t size = 0;
+  for (auto _ : state) {
+    auto json = folly::toJson(dynamicFromValue(*runtime, value));
+    size = json.size();
+    benchmark::DoNotOptimize(json.data());
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(dynamicToJsonBenchmark)->Range(8, 8 << 10);
+
+void jsonStringifyBenchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  auto value = valueFromDynamic(*runtime, makePayload(state.range(0)));
+  auto stringify = runtime->global()
+                       .getPropertyAsObject(*runtime, "JSON")
+                       .getPropertyAsFunction(*runtime, "stringify");
+  size_t size = 0;
+  for (auto _ : state) {
+    auto json = stringify.call(*runtime, value).getString(*runtime).utf8(
+        *runtime);
+    size = json.size();
+    benchmark::DoNotOptimize(json.data());
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(jsonStringifyBenchmark)->Range(8, 8 << 10);
+
+void valueFromJsonBenchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  auto json = folly::toJson(makePayload(state.range(0)));
+  DynamicConversionContext context(*runtime);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(valueFromJson(context, json));
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(valueFromJsonBenchmark)->Range(8, 8 << 10);
+
+void parseJsonToValueBenchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  auto json = folly::toJson(makePayload(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        valueFromDynamic(*runtime, folly::parseJson(json)));
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(parseJsonToValueBenchmark)->Range(8, 8 << 10);
+
+void createValueFromJsonUtf8Benchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  auto json = folly::toJson(makePayload(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Value::createFromJsonUtf8(
+        *runtime,
+        reinterpret_cast<const uint8_t*>(json.data()),
+        json.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(createValueFromJsonUtf8Benchmark)->Range(8, 8 << 10);
+
+} // namespace
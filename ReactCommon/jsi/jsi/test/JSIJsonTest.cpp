@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/JSIJson.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+using namespace facebook::jsi;
+
+namespace {
+
+class JSIJsonTest : public JSITestBase {
+ protected:
+  Value parse(const std::string& json) {
+    DynamicConversionContext context(rt);
+    return valueFromJson(context, json);
+  }
+
+  std::string roundTrip(const std::string& json) {
+    return toJson(rt, parse(json));
+  }
+};
+
+std::string nestedArrays(size_t depth) {
+  return std::string(depth, '[') + std::string(depth, ']');
+}
+
+} // namespace
+
+TEST_P(JSIJsonTest, roundTrip) {
+  const char* documents[] = {
+      "null",
+      "true",
+      "false",
+      "0",
+      "-1.5",
+      "\"\"",
+      "\"text\"",
+      "[]",
+      "{}",
+      "[1,\"two\",[null],{}]",
+      "{\"a\":1,\"b\":{\"c\":[true,false]},\"d\":\"e\"}",
+  };
+  for (auto json : documents) {
+    EXPECT_EQ(roundTrip(json), json);
+  }
+}
+
+TEST_P(JSIJsonTest, parseWhitespaceAndNumbers) {
+  EXPECT_EQ(roundTrip(" { \"a\" : [ 1 , 2 ] }\n"), "{\"a\":[1,2]}");
+  EXPECT_EQ(parse("1e3").getNumber(), 1000);
+  EXPECT_EQ(parse("-0.25E-2").getNumber(), -0.0025);
+  EXPECT_EQ(parse("10").getNumber(), 10);
+  EXPECT_EQ(parse("-0").getNumber(), 0);
+}
+
+TEST_P(JSIJsonTest, parseEscapes) {
+  auto value = parse("\"\\\"\\\\\\/\\b\\f\\n\\r\\t\\u0041\\u00e9\"");
+  EXPECT_EQ(value.getString(rt).utf8(rt), "\"\\/\b\f\n\r\tA\xc3\xa9");
+
+  // A surrogate pair is decoded into a single code point.
+  value = parse("\"\\ud83d\\ude00\"");
+  EXPECT_EQ(value.getString(rt).utf8(rt), "\xf0\x9f\x98\x80");
+}
+
+TEST_P(JSIJsonTest, writeEscapes) {
+  auto value = String::createFromUtf8(rt, std::string("a\"b\\c\nd\x01", 8));
+  EXPECT_EQ(toJson(rt, Value(rt, value)), "\"a\\\"b\\\\c\\nd\\u0001\"");
+}
+
+TEST_P(JSIJsonTest, writeNumbersLikeJsonStringify) {
+  EXPECT_EQ(toJson(rt, Value(-0.0)), "0");
+  EXPECT_EQ(toJson(rt, Value(std::nan(""))), "null");
+  EXPECT_EQ(
+      toJson(rt, Value(std::numeric_limits<double>::infinity())), "null");
+  EXPECT_EQ(toJson(rt, Value(0.5)), "0.5");
+}
+
+TEST_P(JSIJsonTest, writerAppendsToBuffer) {
+  std::string buffer = "prefix:";
+  writeJson(rt, Value(true), buffer);
+  EXPECT_EQ(buffer, "prefix:true");
+}
+
+TEST_P(JSIJsonTest, rejectInvalidNumbers) {
+  const char* numbers[] = {
+      "01", "-01", "00", "1.", ".5", "-", "+1", "1e", "1e+", "1.e3", "0x10"};
+  for (auto json : numbers) {
+    EXPECT_THROW(parse(json), JSINativeException) << json;
+  }
+}
+
+TEST_P(JSIJsonTest, rejectInvalidStrings) {
+  const char* strings[] = {
+      "\"\\x\"",
+      "\"\\u12\"",
+      "\"\\u12g4\"",
+      "\"unterminated",
+      "\"trailing backslash\\",
+      "\"control\ncharacter\"",
+  };
+  for (auto json : strings) {
+    EXPECT_THROW(parse(json), JSINativeException) << json;
+  }
+}
+
+TEST_P(JSIJsonTest, rejectTruncatedInput) {
+  const char* documents[] = {
+      "",
+      " ",
+      "[",
+      "[1",
+      "[1,",
+      "{",
+      "{\"a\"",
+      "{\"a\":",
+      "{\"a\":1",
+      "tru",
+      "nul",
+  };
+  for (auto json : documents) {
+    EXPECT_THROW(parse(json), JSINativeException) << json;
+  }
+}
+
+TEST_P(JSIJsonTest, rejectMalformedContainers) {
+  const char* documents[] = {
+      "[1,]",
+      "[,1]",
+      "{\"a\":1,}",
+      "{a:1}",
+      "{\"a\" 1}",
+      "[1 2]",
+      "[1]]",
+      "true false",
+  };
+  for (auto json : documents) {
+    EXPECT_THROW(parse(json), JSINativeException) << json;
+  }
+}
+
+TEST_P(JSIJsonTest, limitNestingDepth) {
+  EXPECT_EQ(roundTrip(nestedArrays(100)), nestedArrays(100));
+  EXPECT_THROW(parse(nestedArrays(100000)), JSINativeException);
+
+  std::string objects;
+  for (int i = 0; i < 100000; ++i) {
+    objects += "{\"a\":";
+  }
+  EXPECT_THROW(parse(objects), JSINativeException);
+}
+
+TEST_P(JSIJsonTest, limitWriteDepth) {
+  Object cyclic(rt);
+  cyclic.setProperty(rt, "self", cyclic);
+  EXPECT_THROW(toJson(rt, Value(rt, cyclic)), JSINativeException);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    JSIJsonTest,
+    ::testing::ValuesIn(runtimeGenerators()));
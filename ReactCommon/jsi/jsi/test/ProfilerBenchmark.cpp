@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsi/jsi.h>
+#include <jsi/profiler.h>
+#include <jsi/test/testlib.h>
+
+#include <memory>
+
+// Measures the overhead of ProfilingRuntimeDecorator on a mix of host
+// function calls and property accesses like a native module call, at several
+// sample intervals.  An interval of 0 only counts operations; the plain
+// benchmark is the baseline.  The runtime is supplied by the embedder through
+// runtimeGenerators().
+
+using namespace facebook::jsi;
+
+namespace {
+
+std::unique_ptr<Runtime> makeRuntime(
+    const std::shared_ptr<CallProfiler>& profiler) {
+  auto runtime = runtimeGenerators().front()();
+  if (!profiler) {
+    return runtime;
+  }
+  return makeProfilingRuntime(std::move(runtime), profiler);
+}
+
+void hostFunctionWorkload(
+    benchmark::State& state,
+    const std::shared_ptr<CallProfiler>& profiler) {
+  auto runtime = makeRuntime(profiler);
+  Runtime& rt = *runtime;
+
+  auto add = Function::createFromHostFunction(
+      rt,
+      PropNameID::forAscii(rt, "add"),
+      2,
+      [](Runtime&, const Value&, const Value* args, size_t) {
+        return Value(args[0].getNumber() + args[1].getNumber());
+      });
+  rt.global().setProperty(rt, "add", add);
+  auto loop = rt.global()
+                  .getPropertyAsFunction(rt, "eval")
+                  .call(rt,
+                        "(function(n) {"
+                        "  var sum = 0;"
+                        "  var point = {x: 1, y: 2};"
+                        "  for (var i = 0; i < n; i++) {"
+                        "    sum = add(sum, point.x + point.y);"
+                        "  }"
+                        "  return sum;"
+                        "})")
+                  .getObject(rt)
+                  .getFunction(rt);
+  Object frame(rt);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(loop.call(rt, 100));
+    for (int i = 0; i < 10; i++) {
+      frame.setProperty(rt, "width", i);
+      benchmark::DoNotOptimize(frame.getProperty(rt, "width"));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 100);
+}
+
+void plainBenchmark(benchmark::State& state) {
+  hostFunctionWorkload(state, nullptr);
+}
+BENCHMARK(plainBenchmark);
+
+void profiledBenchmark(benchmark::State& state) {
+  auto profiler =
+      std::make_shared<CallProfiler>(static_cast<uint32_t>(state.range(0)));
+  hostFunctionWorkload(state, profiler);
+  state.counters["samples"] = static_cast<double>([&] {
+    uint64_t samples = 0;
+    for (const auto& entry : profiler->getReport().entries) {
+      samples += entry.samples;
+    }
+    return samples;
+  }());
+}
+BENCHMARK(profiledBenchmark)->Arg(0)->Arg(1)->Arg(100)->Arg(1000);
+
+} // namespace
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <jsi/jsi.h>
+#include <jsi/profiler.h>
+#include <jsi/test/testlib.h>
+
+#include <memory>
+#include <string>
+
+using namespace facebook::jsi;
+
+namespace {
+
+class ProfilerTest : public JSITestBase {
+ protected:
+  std::unique_ptr<Runtime> makeRuntime(uint32_t sampleInterval) {
+    profiler = std::make_shared<CallProfiler>(sampleInterval);
+    return makeProfilingRuntime(factory(), profiler);
+  }
+
+  // Does count property reads of "x" through runtime.
+  static void readProperty(Runtime& runtime, size_t count) {
+    Object object(runtime);
+    for (size_t i = 0; i < count; i++) {
+      object.getProperty(runtime, "x");
+    }
+  }
+
+  const CallProfileReport::Entry* findEntry(
+      const CallProfileReport& report,
+      ProfiledOperation operation,
+      const std::string& name) {
+    for (const auto& entry : report.entries) {
+      if (entry.operation == operation && entry.name == name) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  uint64_t operationCount(ProfiledOperation operation) {
+    return profiler->getReport()
+        .operationCounts[static_cast<size_t>(operation)];
+  }
+
+  std::shared_ptr<CallProfiler> profiler;
+};
+
+struct Adder {
+  Value operator()(Runtime&, const Value&, const Value* args, size_t) {
+    return Value(args[0].getNumber() + args[1].getNumber());
+  }
+};
+
+} // namespace
+
+TEST_P(ProfilerTest, intervalOneSamplesEveryOperation) {
+  auto runtime = makeRuntime(1);
+  readProperty(*runtime, 10);
+
+  auto report = profiler->getReport();
+  auto entry = findEntry(report, ProfiledOperation::GetProperty, "x");
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->samples, 10);
+  EXPECT_EQ(entry->estimatedCount, 10);
+
+  entry = findEntry(report, ProfiledOperation::CreateObject, "");
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->samples, 1);
+}
+
+TEST_P(ProfilerTest, countdownSamplesOneInIntervalOnAverage) {
+  auto runtime = makeRuntime(10);
+  readProperty(*runtime, 10000);
+  runtime.reset();
+
+  // Counts are exact once the decorator has flushed them.
+  EXPECT_EQ(operationCount(ProfiledOperation::GetProperty), 10000);
+
+  auto report = profiler->getReport();
+  auto entry = findEntry(report, ProfiledOperation::GetProperty, "x");
+  ASSERT_NE(entry, nullptr);
+  EXPECT_GT(entry->samples, 800);
+  EXPECT_LT(entry->samples, 1200);
+  EXPECT_EQ(entry->estimatedCount, entry->samples * 10);
+}
+
+TEST_P(ProfilerTest, intervalZeroOnlyCounts) {
+  auto runtime = makeRuntime(0);
+  readProperty(*runtime, 100);
+  runtime.reset();
+
+  auto report = profiler->getReport();
+  EXPECT_TRUE(report.entries.empty());
+  EXPECT_EQ(
+      report.operationCounts[static_cast<size_t>(
+          ProfiledOperation::GetProperty)],
+      100);
+  EXPECT_EQ(
+      report.operationCounts[static_cast<size_t>(
+          ProfiledOperation::CreateObject)],
+      1);
+}
+
+TEST_P(ProfilerTest, newIntervalAppliesAfterNextSample) {
+  auto runtime = makeRuntime(1);
+  profiler->setSampleInterval(0);
+
+  // The countdown armed with the old interval still expires once.
+  readProperty(*runtime, 100);
+
+  auto report = profiler->getReport();
+  ASSERT_EQ(report.entries.size(), 1);
+  EXPECT_EQ(report.entries[0].operation, ProfiledOperation::CreateObject);
+  EXPECT_EQ(report.entries[0].samples, 1);
+}
+
+TEST_P(ProfilerTest, hostFunctionsAreSampledByName) {
+  auto runtime = makeRuntime(1);
+  Runtime& prt = *runtime;
+  auto add = Function::createFromHostFunction(
+      prt, PropNameID::forAscii(prt, "add"), 2, Adder());
+
+  EXPECT_EQ(add.call(prt, 1, 2).getNumber(), 3);
+  EXPECT_EQ(add.call(prt, 3, 4).getNumber(), 7);
+
+  auto report = profiler->getReport();
+  auto entry = findEntry(report, ProfiledOperation::HostFunction, "add");
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->samples, 2);
+  entry = findEntry(report, ProfiledOperation::Call, "");
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->samples, 2);
+}
+
+TEST_P(ProfilerTest, getHostFunctionUnwrapsProfiledHostFunction) {
+  auto runtime = makeRuntime(1);
+  Runtime& prt = *runtime;
+  auto add = Function::createFromHostFunction(
+      prt, PropNameID::forAscii(prt, "add"), 2, Adder());
+
+  EXPECT_TRUE(add.isHostFunction(prt));
+  auto& hostFunction = add.getHostFunction(prt);
+  EXPECT_NE(hostFunction.target<Adder>(), nullptr);
+
+  // Calling the unwrapped function directly is not sampled.
+  Value args[] = {Value(5), Value(6)};
+  EXPECT_EQ(hostFunction(prt, Value::undefined(), args, 2).getNumber(), 11);
+  auto report = profiler->getReport();
+  EXPECT_EQ(
+      findEntry(report, ProfiledOperation::HostFunction, "add"), nullptr);
+}
+
+TEST_P(ProfilerTest, reportIsSortedAndResettable) {
+  auto runtime = makeRuntime(1);
+  readProperty(*runtime, 5);
+  profiler->record(
+      ProfiledOperation::Call, "", 1, std::chrono::milliseconds(100));
+
+  auto report = profiler->getReport();
+  ASSERT_FALSE(report.entries.empty());
+  EXPECT_EQ(report.entries[0].operation, ProfiledOperation::Call);
+  for (size_t i = 1; i < report.entries.size(); i++) {
+    EXPECT_GE(
+        report.entries[i - 1].estimatedTotalNanos(),
+        report.entries[i].estimatedTotalNanos());
+  }
+  EXPECT_NE(report.toString().find("getProperty"), std::string::npos);
+
+  profiler->reset();
+  EXPECT_TRUE(profiler->getReport().entries.empty());
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    ProfilerTest,
+    ::testing::ValuesIn(runtimeGenerators()));
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Measures creating the property names and short strings that native code
+// creates over and over, e.g. for layout metrics and events, against names
+// which are all distinct.  Runtimes which intern short ASCII strings should
+// show a clear gap between the two.  The runtime is supplied by the embedder
+// through runtimeGenerators().
+
+using namespace facebook::jsi;
+
+namespace {
+
+const char* const kHotNames[] = {
+    "left", "top", "width", "height", "target", "x", "y", "pageX", "pageY"};
+constexpr size_t kHotNameCount = sizeof(kHotNames) / sizeof(kHotNames[0]);
+
+std::unique_ptr<Runtime> makeRuntime() {
+  return runtimeGenerators().front()();
+}
+
+std::vector<std::string> makeDistinctNames(size_t count) {
+  std::vector<std::string> names;
+  names.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    names.push_back("property" + std::to_string(i));
+  }
+  return names;
+}
+
+void hotPropNameIDBenchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        PropNameID::forAscii(*runtime, kHotNames[i++ % kHotNameCount]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(hotPropNameIDBenchmark);
+
+void distinctPropNameIDBenchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  auto names = makeDistinctNames(4096);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        PropNameID::forAscii(*runtime, names[i++ % names.size()]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(distinctPropNameIDBenchmark);
+
+void hotStringBenchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        String::createFromAscii(*runtime, kHotNames[i++ % kHotNameCount]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(hotStringBenchmark);
+
+void layoutMetricsObjectBenchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  for (auto _ : state) {
+    Object frame(*runtime);
+    frame.setProperty(*runtime, "left", 10);
+    frame.setProperty(*runtime, "top", 20);
+    frame.setProperty(*runtime, "width", 100);
+    frame.setProperty(*runtime, "height", 50);
+    benchmark::DoNotOptimize(frame);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(layoutMetricsObjectBenchmark);
+
+void longStringBenchmark(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  std::string value(state.range(0), 'a');
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(String::createFromAscii(*runtime, value));
+  }
+  state.SetBytesProcessed(state.iterations() * value.size());
+}
+BENCHMARK(longStringBenchmark)->Range(8, 1 << 10);
+
+} // namespace
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+#include <jsi/threadsafe.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Stresses a BatchingThreadSafeRuntime from several threads at once: each
+// thread reads properties of a shared object, either locking per operation,
+// in batches of a fixed size, or with a timed try-lock which backs off when
+// the runtime is busy.  Contention counters are reported per run.  The
+// runtime is supplied by the embedder through runtimeGenerators().
+
+using namespace facebook::jsi;
+
+namespace {
+
+constexpr int kOperationsPerThread = 1000;
+
+enum class LockMode {
+  PerOperation,
+  Batched,
+  TryLock,
+};
+
+struct SharedRuntime {
+  std::unique_ptr<BatchingThreadSafeRuntime> runtime;
+  std::unique_ptr<Object> object;
+
+  SharedRuntime()
+      : runtime(makeBatchingThreadSafeRuntime(runtimeGenerators().front()())) {
+    Runtime& rt = *runtime;
+    object.reset(new Object(rt));
+    object->setProperty(rt, "x", 1);
+    object->setProperty(rt, "y", 2);
+  }
+
+  ~SharedRuntime() {
+    // Values must be released while the runtime is alive.
+    object.reset();
+  }
+};
+
+// A read-mostly burst, like a background thread inspecting a value.
+int readObject(Runtime& rt, const Object& object) {
+  int sum = 0;
+  if (!object.isArray(rt)) {
+    sum += static_cast<int>(object.getProperty(rt, "x").getNumber());
+    sum += static_cast<int>(object.getProperty(rt, "y").getNumber());
+  }
+  return sum;
+}
+
+void worker(SharedRuntime& shared, LockMode mode, int batchSize) {
+  Runtime& rt = *shared.runtime;
+  const Object& object = *shared.object;
+  int done = 0;
+  while (done < kOperationsPerThread) {
+    switch (mode) {
+      case LockMode::PerOperation:
+        benchmark::DoNotOptimize(readObject(rt, object));
+        done++;
+        break;
+      case LockMode::Batched: {
+        BatchLock batch(*shared.runtime);
+        for (int i = 0; i < batchSize && done < kOperationsPerThread; i++) {
+          benchmark::DoNotOptimize(readObject(rt, object));
+          done++;
+        }
+        break;
+      }
+      case LockMode::TryLock: {
+        BatchLock batch(*shared.runtime, std::chrono::microseconds(50));
+        if (!batch) {
+          std::this_thread::yield();
+          break;
+        }
+        for (int i = 0; i < batchSize && done < kOperationsPerThread; i++) {
+          benchmark::DoNotOptimize(readObject(rt, object));
+          done++;
+        }
+        break;
+      }
+    }
+  }
+}
+
+void stress(benchmark::State& state, LockMode mode) {
+  SharedRuntime shared;
+  auto threadCount = static_cast<int>(state.range(0));
+  auto batchSize = static_cast<int>(state.range(1));
+  for (auto _ : state) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+      threads.emplace_back([&] { worker(shared, mode, batchSize); });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  state.SetItemsProcessed(
+      state.iterations() * threadCount * kOperationsPerThread);
+
+  auto stats = shared.runtime->getContentionStats();
+  state.counters["acquisitions"] = static_cast<double>(stats.acquisitions);
+  state.counters["contended%"] = stats.acquisitions == 0
+      ? 0
+      : 100.0 * stats.contendedAcquisitions / stats.acquisitions;
+  state.counters["meanWaitUs"] = stats.contendedAcquisitions == 0
+      ? 0
+      : stats.totalWaitNanos / 1000.0 / stats.contendedAcquisitions;
+  state.counters["maxWaitUs"] = stats.maxWaitNanos / 1000.0;
+  state.counters["timeouts"] = static_cast<double>(stats.timeouts);
+}
+
+void perOperationStress(benchmark::State& state) {
+  stress(state, LockMode::PerOperation);
+}
+BENCHMARK(perOperationStress)
+    ->ArgsProduct({{1, 2, 4, 8}, {1}})
+    ->UseRealTime();
+
+void batchedStress(benchmark::State& state) {
+  stress(state, LockMode::Batched);
+}
+BENCHMARK(batchedStress)
+    ->ArgsProduct({{1, 2, 4, 8}, {8, 64}})
+    ->UseRealTime();
+
+void tryLockStress(benchmark::State& state) {
+  stress(state, LockMode::TryLock);
+}
+BENCHMARK(tryLockStress)->ArgsProduct({{1, 2, 4, 8}, {64}})->UseRealTime();
+
+} // namespace
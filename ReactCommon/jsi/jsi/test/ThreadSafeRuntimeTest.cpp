@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+#include <jsi/threadsafe.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace facebook::jsi;
+
+namespace {
+
+class ThreadSafeRuntimeTest : public JSITestBase {
+ protected:
+  ThreadSafeRuntimeTest()
+      : threadSafe(makeBatchingThreadSafeRuntime(factory())) {}
+
+  // Returns whether another thread can take the lock right now.
+  bool lockableFromOtherThread() {
+    bool locked = false;
+    std::thread thread([&] {
+      BatchLock lock(*threadSafe, std::chrono::milliseconds(1));
+      locked = static_cast<bool>(lock);
+    });
+    thread.join();
+    return locked;
+  }
+
+  std::unique_ptr<BatchingThreadSafeRuntime> threadSafe;
+};
+
+} // namespace
+
+TEST_P(ThreadSafeRuntimeTest, operationsLockOneByOne) {
+  Runtime& tsrt = *threadSafe;
+  Object object(tsrt);
+  object.setProperty(tsrt, "x", 1);
+  EXPECT_EQ(object.getProperty(tsrt, "x").getNumber(), 1);
+
+  auto stats = threadSafe->getContentionStats();
+  EXPECT_EQ(stats.acquisitions, stats.operations);
+  EXPECT_GE(stats.operations, 3);
+  EXPECT_TRUE(lockableFromOtherThread());
+}
+
+TEST_P(ThreadSafeRuntimeTest, batchLockIsTakenOnce) {
+  Runtime& tsrt = *threadSafe;
+  {
+    BatchLock batch(*threadSafe);
+    Object object(tsrt);
+    for (int i = 0; i < 10; i++) {
+      object.setProperty(tsrt, "x", i);
+      object.getProperty(tsrt, "x");
+    }
+  }
+
+  auto stats = threadSafe->getContentionStats();
+  EXPECT_EQ(stats.acquisitions, 1);
+  EXPECT_GE(stats.operations, 21);
+  EXPECT_EQ(stats.contendedAcquisitions, 0);
+}
+
+TEST_P(ThreadSafeRuntimeTest, batchLockIsReleasedAtScopeExit) {
+  {
+    BatchLock batch(*threadSafe);
+    EXPECT_FALSE(lockableFromOtherThread());
+  }
+  EXPECT_TRUE(lockableFromOtherThread());
+}
+
+TEST_P(ThreadSafeRuntimeTest, nestedBatchLocksReleaseWithOutermost) {
+  {
+    BatchLock outer(*threadSafe);
+    {
+      BatchLock inner(*threadSafe);
+      EXPECT_TRUE(inner);
+    }
+    EXPECT_FALSE(lockableFromOtherThread());
+
+    // Operations made while the lock is held do not release it either.
+    Runtime& tsrt = *threadSafe;
+    Object object(tsrt);
+    EXPECT_FALSE(lockableFromOtherThread());
+  }
+  EXPECT_TRUE(lockableFromOtherThread());
+  EXPECT_EQ(threadSafe->getContentionStats().acquisitions, 2);
+}
+
+TEST_P(ThreadSafeRuntimeTest, movedBatchLockReleasesOnce) {
+  {
+    BatchLock first(*threadSafe);
+    BatchLock second(std::move(first));
+    EXPECT_FALSE(first);
+    EXPECT_TRUE(second);
+  }
+  EXPECT_TRUE(lockableFromOtherThread());
+
+  // The lock is not left with a negative depth by a double release.
+  BatchLock batch(*threadSafe);
+  EXPECT_FALSE(lockableFromOtherThread());
+}
+
+TEST_P(ThreadSafeRuntimeTest, timedBatchLockGivesUpWhileHeld) {
+  BatchLock batch(*threadSafe);
+  EXPECT_FALSE(lockableFromOtherThread());
+  EXPECT_FALSE(lockableFromOtherThread());
+
+  auto stats = threadSafe->getContentionStats();
+  EXPECT_EQ(stats.timeouts, 2);
+  EXPECT_EQ(stats.acquisitions, 1);
+}
+
+TEST_P(ThreadSafeRuntimeTest, waitingThreadRunsAfterRelease) {
+  std::mutex eventsMutex;
+  std::vector<int> events;
+  auto record = [&](int event) {
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    events.push_back(event);
+  };
+
+  std::atomic<bool> waiting{false};
+  std::thread thread;
+  {
+    BatchLock batch(*threadSafe);
+    thread = std::thread([&] {
+      waiting = true;
+      BatchLock lock(*threadSafe);
+      record(2);
+    });
+    while (!waiting) {
+      std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    record(1);
+  }
+  thread.join();
+
+  EXPECT_EQ(events, (std::vector<int>{1, 2}));
+  auto stats = threadSafe->getContentionStats();
+  EXPECT_EQ(stats.acquisitions, 2);
+  EXPECT_LE(stats.contendedAcquisitions, 1);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    ThreadSafeRuntimeTest,
+    ::testing::ValuesIn(runtimeGenerators()));
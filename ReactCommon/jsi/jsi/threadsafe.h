@@ -7,7 +7,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <thread>
 
 #include <jsi/decorator.h>
 #include <jsi/jsi.h>
@@ -22,6 +27,72 @@ class ThreadSafeRuntime : public Runtime {
   virtual Runtime& getUnsafeRuntime() = 0;
 };
 
+// A ThreadSafeRuntime whose lock can be held across many operations, and
+// which reports how contended it is.
+//
+// The lock is reentrant for the thread holding it, and operations made
+// while it is held skip acquiring it again.  So a background thread doing
+// many reads should take it once, with a BatchLock, rather than paying for
+// (and contending on) one acquisition per operation.
+class BatchingThreadSafeRuntime : public ThreadSafeRuntime {
+ public:
+  struct ContentionStats {
+    // Runtime operations made through this runtime.
+    uint64_t operations;
+    // Times the lock was taken while not already held by the caller.
+    uint64_t acquisitions;
+    // Acquisitions which had to wait for another thread.
+    uint64_t contendedAcquisitions;
+    // tryLockFor() calls which gave up.
+    uint64_t timeouts;
+    uint64_t totalWaitNanos;
+    uint64_t maxWaitNanos;
+  };
+
+  // Returns false if the lock could not be taken within timeout.  On
+  // success, the caller must call unlock().
+  virtual bool tryLockFor(std::chrono::nanoseconds timeout) const = 0;
+
+  virtual ContentionStats getContentionStats() const = 0;
+};
+
+// Holds the lock of a BatchingThreadSafeRuntime for its scope, so that the
+// operations made in that scope are not locked one by one.  The timed
+// variant may fail to take the lock; check it before using the runtime.
+class BatchLock {
+ public:
+  explicit BatchLock(const BatchingThreadSafeRuntime& runtime)
+      : runtime_(&runtime) {
+    runtime.lock();
+  }
+
+  BatchLock(
+      const BatchingThreadSafeRuntime& runtime,
+      std::chrono::nanoseconds timeout)
+      : runtime_(runtime.tryLockFor(timeout) ? &runtime : nullptr) {}
+
+  BatchLock(BatchLock&& other) : runtime_(other.runtime_) {
+    other.runtime_ = nullptr;
+  }
+
+  BatchLock(const BatchLock&) = delete;
+  BatchLock& operator=(const BatchLock&) = delete;
+  BatchLock& operator=(BatchLock&&) = delete;
+
+  ~BatchLock() {
+    if (runtime_) {
+      runtime_->unlock();
+    }
+  }
+
+  explicit operator bool() const {
+    return runtime_ != nullptr;
+  }
+
+ private:
+  const BatchingThreadSafeRuntime* runtime_;
+};
+
 namespace detail {
 
 template <typename R, typename L>
@@ -73,7 +144,167 @@ class ThreadSafeRuntimeImpl final
   mutable WithLock<R, L> lock_;
 };
 
+// The With type of BatchingThreadSafeRuntimeImpl: a reentrant timed mutex
+// which counts how it is used.
+class BatchingLock {
+ public:
+  void before() {
+    lock();
+  }
+
+  void after() {
+    unlock();
+  }
+
+  void lock() {
+    if (enter()) {
+      return;
+    }
+    std::chrono::steady_clock::time_point start;
+    bool contended = !mutex_.try_lock();
+    if (contended) {
+      start = std::chrono::steady_clock::now();
+      mutex_.lock();
+    }
+    acquired(contended, start);
+  }
+
+  bool tryLockFor(std::chrono::nanoseconds timeout) {
+    if (enter()) {
+      return true;
+    }
+    std::chrono::steady_clock::time_point start;
+    bool contended = !mutex_.try_lock();
+    if (contended) {
+      start = std::chrono::steady_clock::now();
+      if (!mutex_.try_lock_for(timeout)) {
+        timeouts_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+    }
+    acquired(contended, start);
+    return true;
+  }
+
+  void unlock() {
+    if (--depth_ == 0) {
+      owner_.store(std::thread::id(), std::memory_order_relaxed);
+      mutex_.unlock();
+    }
+  }
+
+  BatchingThreadSafeRuntime::ContentionStats getStats() const {
+    return {
+        operations_.load(std::memory_order_relaxed),
+        acquisitions_.load(std::memory_order_relaxed),
+        contendedAcquisitions_.load(std::memory_order_relaxed),
+        timeouts_.load(std::memory_order_relaxed),
+        totalWaitNanos_.load(std::memory_order_relaxed),
+        maxWaitNanos_.load(std::memory_order_relaxed),
+    };
+  }
+
+ private:
+  // The counters below are only written while holding mutex_, so they are
+  // updated with plain loads and stores; they are atomic so that stats can
+  // be read from any thread.
+  static void increment(std::atomic<uint64_t>& counter, uint64_t value = 1) {
+    counter.store(
+        counter.load(std::memory_order_relaxed) + value,
+        std::memory_order_relaxed);
+  }
+
+  // Only the owning thread can observe its own id in owner_, so a relaxed
+  // load is enough to tell whether the caller already holds the lock.
+  bool enter() {
+    if (owner_.load(std::memory_order_relaxed) != std::this_thread::get_id()) {
+      return false;
+    }
+    depth_++;
+    increment(operations_);
+    return true;
+  }
+
+  void acquired(bool contended, std::chrono::steady_clock::time_point start) {
+    owner_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    depth_ = 1;
+    increment(operations_);
+    increment(acquisitions_);
+    if (contended) {
+      auto wait = static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - start)
+              .count());
+      increment(contendedAcquisitions_);
+      increment(totalWaitNanos_, wait);
+      if (wait > maxWaitNanos_.load(std::memory_order_relaxed)) {
+        maxWaitNanos_.store(wait, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  std::timed_mutex mutex_;
+  std::atomic<std::thread::id> owner_{};
+  // Guarded by mutex_.
+  size_t depth_{0};
+
+  std::atomic<uint64_t> operations_{0};
+  std::atomic<uint64_t> acquisitions_{0};
+  std::atomic<uint64_t> contendedAcquisitions_{0};
+  std::atomic<uint64_t> timeouts_{0};
+  std::atomic<uint64_t> totalWaitNanos_{0};
+  std::atomic<uint64_t> maxWaitNanos_{0};
+};
+
+// The implementation of BatchingThreadSafeRuntime, wrapping an R.  R is
+// owned through a unique_ptr so runtimes made by a factory can be wrapped;
+// if R is final, calls to it are still devirtualized.
+template <typename R>
+class BatchingThreadSafeRuntimeImpl final
+    : public WithRuntimeDecorator<BatchingLock, R, BatchingThreadSafeRuntime> {
+ public:
+  explicit BatchingThreadSafeRuntimeImpl(std::unique_ptr<R> unsafe)
+      : WithRuntimeDecorator<BatchingLock, R, BatchingThreadSafeRuntime>(
+            *unsafe,
+            lock_),
+        unsafe_(std::move(unsafe)) {}
+
+  R& getUnsafeRuntime() override {
+    return WithRuntimeDecorator<BatchingLock, R, BatchingThreadSafeRuntime>::
+        plain();
+  }
+
+  void lock() const override {
+    lock_.lock();
+  }
+
+  void unlock() const override {
+    lock_.unlock();
+  }
+
+  bool tryLockFor(std::chrono::nanoseconds timeout) const override {
+    return lock_.tryLockFor(timeout);
+  }
+
+  BatchingThreadSafeRuntime::ContentionStats getContentionStats()
+      const override {
+    return lock_.getStats();
+  }
+
+ private:
+  std::unique_ptr<R> unsafe_;
+  mutable BatchingLock lock_;
+};
+
 } // namespace detail
 
+// Wraps runtime so it can be used from any thread.
+template <typename R>
+std::unique_ptr<BatchingThreadSafeRuntime> makeBatchingThreadSafeRuntime(
+    std::unique_ptr<R> runtime) {
+  return std::unique_ptr<BatchingThreadSafeRuntime>(
+      new detail::BatchingThreadSafeRuntimeImpl<R>(std::move(runtime)));
+}
+
 } // namespace jsi
 } // namespace facebook
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsi/JSCRuntime.h>
+#include <jsi/test/testlib.h>
+
+// Runs the jsi tests and benchmarks against JSC, the runtime shipped in this
+// tree.
+
+namespace facebook {
+namespace jsi {
+
+std::vector<RuntimeFactory> runtimeGenerators() {
+  return {[] { return jsc::makeJSCRuntime(); }};
+}
+
+} // namespace jsi
+} // namespace facebook
@@ -6,6 +6,7 @@
  */
 
 #include "jsireact/JSIExecutor.h"
+#include "jsireact/PreparedScriptCache.h"
 
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/ModuleRegistry.h>
@@ -79,6 +80,9 @@ JSIExecutor::JSIExecutor(
 
 void JSIExecutor::initializeRuntime() {
   SystraceSection s("JSIExecutor::initializeRuntime");
+  dynamicConversionContext_ =
+      std::make_unique<DynamicConversionContext>(*runtime_);
+
   runtime_->global().setProperty(
       *runtime_,
       "nativeModuleProxy",
@@ -149,14 +153,17 @@ void JSIExecutor::loadBundle(
 
   // TODO: check for and use precompiled HBC
 
+  // Preparing goes through a process-wide cache which, once the embedder
+  // enables it, lets other instances loading the same bundle reuse this
+  // preparation.
   bool hasLogger(ReactMarker::logTaggedMarker);
   std::string scriptName = simpleBasename(sourceURL);
   if (hasLogger) {
     ReactMarker::logTaggedMarker(
         ReactMarker::RUN_JS_BUNDLE_START, scriptName.c_str());
   }
-  runtime_->evaluateJavaScript(
-      std::make_unique<BigStringBuffer>(std::move(script)), sourceURL);
+  runtime_->evaluatePreparedJavaScript(PreparedScriptCache::get().prepare(
+      *runtime_, std::move(script), sourceURL));
   flush();
   if (hasLogger) {
     ReactMarker::logTaggedMarker(
@@ -196,9 +203,10 @@ void JSIExecutor::registerBundle(
       throw std::invalid_argument(
           "Empty bundle registered with ID " + tag + " from " + bundlePath);
     }
-    runtime_->evaluateJavaScript(
-        std::make_unique<BigStringBuffer>(std::move(script)),
-        JSExecutor::getSyntheticBundlePath(bundleId, bundlePath));
+    runtime_->evaluatePreparedJavaScript(PreparedScriptCache::get().prepare(
+        *runtime_,
+        std::move(script),
+        JSExecutor::getSyntheticBundlePath(bundleId, bundlePath)));
   }
   ReactMarker::logTaggedMarker(
       ReactMarker::REGISTER_JS_SEGMENT_STOP, tag.c_str());
@@ -232,7 +240,7 @@ void JSIExecutor::callFunction(
               *runtime_,
               moduleId,
               methodId,
-              valueFromDynamic(*runtime_, arguments));
+              valueFromDynamic(*dynamicConversionContext_, arguments));
         },
         std::move(errorProducer));
   } catch (...) {
@@ -253,7 +261,9 @@ void JSIExecutor::invokeCallback(
   Value ret;
   try {
     ret = invokeCallbackAndReturnFlushedQueue_->call(
-        *runtime_, callbackId, valueFromDynamic(*runtime_, arguments));
+        *runtime_,
+        callbackId,
+        valueFromDynamic(*dynamicConversionContext_, arguments));
   } catch (...) {
     std::throw_with_nested(std::runtime_error(
         folly::to<std::string>("Error invoking callback ", callbackId)));
@@ -344,6 +354,8 @@ void JSIExecutor::handleMemoryPressure(int pressureLevel) {
       // collections.
       LOG(INFO) << "Memory warning (pressure level: " << levelName
                 << ") received by JS VM, running a GC";
+      // Scripts being evaluated stay alive, the rest can be prepared again.
+      PreparedScriptCache::get().clear();
       runtime_->instrumentation().collectGarbage();
       break;
     default:
@@ -380,11 +392,6 @@ void JSIExecutor::callNativeModules(const Value &queue, bool isEndOfBatch) {
   // If this fails, you need to pass a fully functional delegate with a
   // module registry to the factory/ctor.
   CHECK(delegate_) << "Attempting to use native modules without a delegate";
-#if 0 // maybe useful for debugging
-  std::string json = runtime_->global().getPropertyAsObject(*runtime_, "JSON")
-    .getPropertyAsFunction(*runtime_, "stringify").call(*runtime_, queue)
-    .getString(*runtime_).utf8(*runtime_);
-#endif
   delegate_->callNativeModules(
       *this, dynamicFromValue(*runtime_, queue), isEndOfBatch);
 }
@@ -427,8 +434,8 @@ Value JSIExecutor::nativeRequire(const Value *args, size_t count) {
   uint32_t bundleId = count == 2 ? folly::to<uint32_t>(args[1].getNumber()) : 0;
   auto module = bundleRegistry_->getModule(bundleId, moduleId);
 
-  runtime_->evaluateJavaScript(
-      std::make_unique<StringBuffer>(module.code), module.name);
+  runtime_->evaluatePreparedJavaScript(PreparedScriptCache::get().prepare(
+      *runtime_, std::move(module.code), module.name));
   return facebook::jsi::Value();
 }
 
@@ -451,7 +458,7 @@ Value JSIExecutor::nativeCallSyncHook(const Value *args, size_t count) {
   if (!result.hasValue()) {
     return Value::undefined();
   }
-  return valueFromDynamic(*runtime_, result.value());
+  return valueFromDynamic(*dynamicConversionContext_, result.value());
 }
 
 #if DEBUG
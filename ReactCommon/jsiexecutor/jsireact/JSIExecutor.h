@@ -12,6 +12,7 @@
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/JSExecutor.h>
 #include <cxxreact/RAMBundleRegistry.h>
+#include <jsi/JSIDynamic.h>
 #include <jsi/jsi.h>
 #include <functional>
 #include <mutex>
@@ -131,6 +132,10 @@ class JSIExecutor : public JSExecutor {
   folly::Optional<jsi::Function> callFunctionReturnFlushedQueue_;
   folly::Optional<jsi::Function> invokeCallbackAndReturnFlushedQueue_;
   folly::Optional<jsi::Function> flushedQueue_;
+
+  // Interns the property names of arguments passed to JS.  Declared after
+  // runtime_ so it is destroyed first.
+  std::unique_ptr<jsi::DynamicConversionContext> dynamicConversionContext_;
 };
 
 using Logger =
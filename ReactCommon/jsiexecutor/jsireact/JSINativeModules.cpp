@@ -14,12 +14,75 @@
 #include <jsi/JSIDynamic.h>
 
 #include <string>
+#include <unordered_set>
 
 using namespace facebook::jsi;
 
 namespace facebook {
 namespace react {
 
+namespace {
+
+/**
+ * Exposes the constants of a module with lazy constants.  Each key is
+ * converted only when JS reads it; genModule replaces the accessor with a
+ * plain data property after the first read, so every key crosses over at
+ * most once per module object.
+ */
+class LazyConstantsHostObject : public HostObject {
+ public:
+  LazyConstantsHostObject(
+      std::weak_ptr<ModuleRegistry> moduleRegistry,
+      size_t moduleId)
+      : moduleRegistry_(std::move(moduleRegistry)), moduleId_(moduleId) {}
+
+  Value get(Runtime &rt, const PropNameID &name) override {
+    auto moduleRegistry = moduleRegistry_.lock();
+    if (!moduleRegistry) {
+      return Value::undefined();
+    }
+    std::string key = name.utf8(rt);
+    loadConstantNames(*moduleRegistry);
+    if (constantNameSet_.count(key) == 0) {
+      return Value::undefined();
+    }
+    // A constant whose value is null is exposed as null, like the eager
+    // path does.
+    return valueFromDynamic(rt, moduleRegistry->getConstant(moduleId_, key));
+  }
+
+  std::vector<PropNameID> getPropertyNames(Runtime &rt) override {
+    std::vector<PropNameID> names;
+    auto moduleRegistry = moduleRegistry_.lock();
+    if (!moduleRegistry) {
+      return names;
+    }
+    loadConstantNames(*moduleRegistry);
+    for (const auto &name : constantNames_) {
+      names.push_back(PropNameID::forUtf8(rt, name));
+    }
+    return names;
+  }
+
+ private:
+  void loadConstantNames(ModuleRegistry &moduleRegistry) {
+    if (constantNamesLoaded_) {
+      return;
+    }
+    constantNames_ = moduleRegistry.getConstantNames(moduleId_);
+    constantNameSet_.insert(constantNames_.begin(), constantNames_.end());
+    constantNamesLoaded_ = true;
+  }
+
+  std::weak_ptr<ModuleRegistry> moduleRegistry_;
+  size_t moduleId_;
+  bool constantNamesLoaded_{false};
+  std::vector<std::string> constantNames_;
+  std::unordered_set<std::string> constantNameSet_;
+};
+
+} // namespace
+
 JSINativeModules::JSINativeModules(
     std::shared_ptr<ModuleRegistry> moduleRegistry)
     : m_moduleRegistry(std::move(moduleRegistry)) {}
@@ -72,10 +135,22 @@ folly::Optional<Object> JSINativeModules::createModule(
     return folly::none;
   }
 
+  Value config = valueFromDynamic(rt, result->config);
+  if (result->lazyConstants) {
+    config.asObject(rt).asArray(rt).setValueAtIndex(
+        rt,
+        1,
+        Object::createFromHostObject(
+            rt,
+            std::make_shared<LazyConstantsHostObject>(
+                m_moduleRegistry, result->index)));
+  }
+
   Value moduleInfo = m_genNativeModuleJS->call(
       rt,
-      valueFromDynamic(rt, result->config),
-      static_cast<double>(result->index));
+      config,
+      static_cast<double>(result->index),
+      result->lazyConstants);
   CHECK(!moduleInfo.isNull()) << "Module returned from genNativeModule is null";
 
   folly::Optional<Object> module(
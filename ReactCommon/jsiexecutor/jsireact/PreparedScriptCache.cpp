@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "jsireact/PreparedScriptCache.h"
+
+#include "jsireact/JSIExecutor.h"
+
+#include <folly/Conv.h>
+#include <folly/hash/SpookyHashV2.h>
+#include <folly/portability/SysStat.h>
+#include <jsi/jsilib.h>
+
+#include <algorithm>
+#include <typeinfo>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+// How much of each end of a file-backed script is hashed, on top of the
+// file identity, in case one file holds several scripts.
+constexpr size_t kFileEdgeHashBytes = 4096;
+
+uint64_t hashBytes(const char *data, size_t size, uint64_t seed = 0) {
+  return folly::hash::SpookyHashV2::Hash64(data, size, seed);
+}
+
+std::string makeKey(
+    jsi::Runtime &runtime,
+    const std::string &sourceURL,
+    size_t size,
+    const std::string &identity) {
+  return folly::to<std::string>(
+      typeid(runtime).name(), '\0', sourceURL, '\0', size, '\0', identity);
+}
+
+std::string identityOf(const JSBigString &script) {
+  auto fileScript = dynamic_cast<const JSBigFileString *>(&script);
+  struct stat fileStat;
+  if (fileScript == nullptr || fstat(fileScript->fd(), &fileStat) != 0) {
+    return folly::to<std::string>(
+        "hash:", hashBytes(script.c_str(), script.size()));
+  }
+  size_t edge = std::min(script.size(), kFileEdgeHashBytes);
+  uint64_t edgeHash = hashBytes(script.c_str(), edge);
+  edgeHash = hashBytes(script.c_str() + script.size() - edge, edge, edgeHash);
+  return folly::to<std::string>(
+      "file:",
+      fileStat.st_dev,
+      ':',
+      fileStat.st_ino,
+      ':',
+      fileStat.st_mtime,
+      ':',
+      edgeHash);
+}
+
+} // namespace
+
+constexpr size_t PreparedScriptCache::kDefaultCapacityBytes;
+
+PreparedScriptCache &PreparedScriptCache::get() {
+  static PreparedScriptCache cache;
+  return cache;
+}
+
+PreparedScriptCache::PreparedScriptCache(size_t capacityBytes)
+    : capacityBytes_(capacityBytes) {}
+
+std::shared_ptr<const jsi::PreparedJavaScript> PreparedScriptCache::prepare(
+    jsi::Runtime &runtime,
+    std::unique_ptr<const JSBigString> script,
+    const std::string &sourceURL) {
+  if (!isCacheable(runtime)) {
+    return runtime.prepareJavaScript(
+        std::make_shared<BigStringBuffer>(std::move(script)), sourceURL);
+  }
+  auto key = makeKey(runtime, sourceURL, script->size(), identityOf(*script));
+  return prepare(
+      runtime,
+      std::move(key),
+      std::make_shared<BigStringBuffer>(std::move(script)),
+      sourceURL);
+}
+
+std::shared_ptr<const jsi::PreparedJavaScript> PreparedScriptCache::prepare(
+    jsi::Runtime &runtime,
+    std::string script,
+    const std::string &sourceURL) {
+  if (!isCacheable(runtime)) {
+    return runtime.prepareJavaScript(
+        std::make_shared<jsi::StringBuffer>(std::move(script)), sourceURL);
+  }
+  auto key = makeKey(
+      runtime,
+      sourceURL,
+      script.size(),
+      folly::to<std::string>("hash:", hashBytes(script.data(), script.size())));
+  return prepare(
+      runtime,
+      std::move(key),
+      std::make_shared<jsi::StringBuffer>(std::move(script)),
+      sourceURL);
+}
+
+bool PreparedScriptCache::isCacheable(jsi::Runtime &runtime) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (capacityBytes_ > 0 && sourceOnlyRuntimes_.count(typeid(runtime)) == 0) {
+    return true;
+  }
+  bypasses_++;
+  return false;
+}
+
+std::shared_ptr<const jsi::PreparedJavaScript> PreparedScriptCache::prepare(
+    jsi::Runtime &runtime,
+    std::string key,
+    std::shared_ptr<const jsi::Buffer> buffer,
+    const std::string &sourceURL) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      hits_++;
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return it->second->preparedScript;
+    }
+    misses_++;
+  }
+
+  // Prepared outside of the lock, since this can take a while. If another
+  // runtime prepares the same script meanwhile, the first one wins.
+  size_t bytes = buffer->size();
+  auto preparedScript = runtime.prepareJavaScript(std::move(buffer), sourceURL);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (dynamic_cast<const jsi::SourceJavaScriptPreparation *>(
+          preparedScript.get()) != nullptr) {
+    // Preparing was free, and will be for every later script of this
+    // runtime type, so those skip hashing too.
+    sourceOnlyRuntimes_.insert(typeid(runtime));
+    return preparedScript;
+  }
+  if (bytes > capacityBytes_) {
+    return preparedScript;
+  }
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    return it->second->preparedScript;
+  }
+  entries_.push_front(Entry{key, preparedScript, bytes});
+  index_.emplace(std::move(key), entries_.begin());
+  bytes_ += bytes;
+  evictToCapacity();
+  return preparedScript;
+}
+
+void PreparedScriptCache::setCapacity(size_t capacityBytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacityBytes_ = capacityBytes;
+  evictToCapacity();
+}
+
+void PreparedScriptCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  evictions_ += entries_.size();
+  entries_.clear();
+  index_.clear();
+  bytes_ = 0;
+}
+
+PreparedScriptCache::Stats PreparedScriptCache::getStats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return Stats{
+      entries_.size(),
+      bytes_,
+      capacityBytes_,
+      hits_,
+      misses_,
+      evictions_,
+      bypasses_};
+}
+
+void PreparedScriptCache::evictToCapacity() {
+  while (bytes_ > capacityBytes_) {
+    const Entry &entry = entries_.back();
+    bytes_ -= entry.bytes;
+    index_.erase(entry.key);
+    entries_.pop_back();
+    evictions_++;
+  }
+}
+
+} // namespace react
+} // namespace facebook
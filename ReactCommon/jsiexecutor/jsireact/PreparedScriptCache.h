@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <cxxreact/JSBigString.h>
+#include <jsi/jsi.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * A process-wide cache of `jsi::PreparedJavaScript`, so that runtimes
+ * loading the same bundle or RAM bundle module share one preparation.
+ *
+ * Scripts are identified by the runtime type that prepared them, their
+ * source URL, and their contents: file-backed bundles by the identity and
+ * modification time of the file, everything else by a hash of the bytes.
+ *
+ * Memory is accounted by script size, since a prepared script retains
+ * (at least) its source. Least recently used scripts are evicted once the
+ * total exceeds the capacity.
+ *
+ * Caching is opt-in: the capacity defaults to 0, which disables it without
+ * hashing anything. Only runtimes whose preparation does real work (such as
+ * compiling to bytecode) benefit, so embedders using one enable the cache
+ * with `setCapacity`. Runtimes that return a plain
+ * `jsi::SourceJavaScriptPreparation` are detected on their first miss and
+ * bypass the cache from then on, since a hit would save nothing.
+ */
+class PreparedScriptCache {
+ public:
+  struct Stats {
+    size_t entries;
+    size_t bytes;
+    size_t capacityBytes;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t bypasses;
+  };
+
+  static constexpr size_t kDefaultCapacityBytes = 0;
+
+  static PreparedScriptCache &get();
+
+  explicit PreparedScriptCache(size_t capacityBytes = kDefaultCapacityBytes);
+
+  PreparedScriptCache(const PreparedScriptCache &) = delete;
+  PreparedScriptCache &operator=(const PreparedScriptCache &) = delete;
+
+  /*
+   * Returns the prepared form of `script`, preparing it with `runtime` if
+   * it is not cached yet.
+   */
+  std::shared_ptr<const jsi::PreparedJavaScript> prepare(
+      jsi::Runtime &runtime,
+      std::unique_ptr<const JSBigString> script,
+      const std::string &sourceURL);
+  std::shared_ptr<const jsi::PreparedJavaScript> prepare(
+      jsi::Runtime &runtime,
+      std::string script,
+      const std::string &sourceURL);
+
+  void setCapacity(size_t capacityBytes);
+  void clear();
+  Stats getStats() const;
+
+ private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<const jsi::PreparedJavaScript> preparedScript;
+    size_t bytes;
+  };
+
+  // Returns whether scripts prepared by `runtime` are worth caching.
+  bool isCacheable(jsi::Runtime &runtime);
+
+  std::shared_ptr<const jsi::PreparedJavaScript> prepare(
+      jsi::Runtime &runtime,
+      std::string key,
+      std::shared_ptr<const jsi::Buffer> buffer,
+      const std::string &sourceURL);
+
+  // Must be called with mutex_ held.
+  void evictToCapacity();
+
+  mutable std::mutex mutex_;
+  // Most recently used first.
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+  // Runtime types known to prepare scripts as plain source.
+  std::unordered_set<std::type_index> sourceOnlyRuntimes_;
+  size_t bytes_{0};
+  size_t capacityBytes_;
+  uint64_t hits_{0};
+  uint64_t misses_{0};
+  uint64_t evictions_{0};
+  uint64_t bypasses_{0};
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include <cxxreact/JSBigString.h>
+#include <jsi/decorator.h>
+#include <jsi/jsi.h>
+#include <jsi/jsilib.h>
+#include <jsi/test/testlib.h>
+#include <jsireact/PreparedScriptCache.h>
+
+using namespace facebook;
+using namespace facebook::react;
+
+namespace {
+
+// Stands in for the output of a runtime which compiles scripts.
+struct CompiledScript : public jsi::PreparedJavaScript {
+  explicit CompiledScript(std::shared_ptr<const jsi::Buffer> source)
+      : source(std::move(source)) {}
+
+  std::shared_ptr<const jsi::Buffer> source;
+};
+
+// Counts preparations, and either compiles scripts or returns them as plain
+// source like JSC does.
+class PreparingRuntime : public jsi::RuntimeDecorator<jsi::Runtime> {
+ public:
+  PreparingRuntime(jsi::Runtime &plain, bool compiles)
+      : RuntimeDecorator(plain), compiles_(compiles) {}
+
+  std::shared_ptr<const jsi::PreparedJavaScript> prepareJavaScript(
+      const std::shared_ptr<const jsi::Buffer> &buffer,
+      std::string sourceURL) override {
+    prepareCount++;
+    if (!compiles_) {
+      return std::make_shared<jsi::SourceJavaScriptPreparation>(
+          buffer, std::move(sourceURL));
+    }
+    return std::make_shared<CompiledScript>(buffer);
+  }
+
+  int prepareCount{0};
+
+ private:
+  bool compiles_;
+};
+
+class PreparedScriptCacheTest : public jsi::JSITestBase {
+ protected:
+  PreparedScriptCacheTest()
+      : compiling(rt, true), sourceOnly(rt, false), cache(1024) {}
+
+  PreparingRuntime compiling;
+  PreparingRuntime sourceOnly;
+  PreparedScriptCache cache;
+};
+
+// Eight bytes per script keeps the capacity arithmetic readable.
+const std::string kScriptA = "var a=1;";
+const std::string kScriptB = "var b=2;";
+const std::string kScriptC = "var c=3;";
+
+} // namespace
+
+TEST_P(PreparedScriptCacheTest, disabledByDefault) {
+  PreparedScriptCache defaultCache;
+  defaultCache.prepare(compiling, kScriptA, "a.js");
+  defaultCache.prepare(compiling, kScriptA, "a.js");
+
+  EXPECT_EQ(compiling.prepareCount, 2);
+  auto stats = defaultCache.getStats();
+  EXPECT_EQ(stats.capacityBytes, 0);
+  EXPECT_EQ(stats.entries, 0);
+  EXPECT_EQ(stats.misses, 0);
+  EXPECT_EQ(stats.bypasses, 2);
+}
+
+TEST_P(PreparedScriptCacheTest, hitReturnsSharedPreparation) {
+  auto first = cache.prepare(compiling, kScriptA, "a.js");
+  auto second = cache.prepare(compiling, kScriptA, "a.js");
+  auto third = cache.prepare(
+      compiling, std::make_unique<JSBigStdString>(kScriptA), "a.js");
+
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(first, third);
+  EXPECT_EQ(compiling.prepareCount, 1);
+  auto stats = cache.getStats();
+  EXPECT_EQ(stats.hits, 2);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.entries, 1);
+  EXPECT_EQ(stats.bytes, kScriptA.size());
+}
+
+TEST_P(PreparedScriptCacheTest, contentsAndURLBothIdentifyScripts) {
+  auto original = cache.prepare(compiling, kScriptA, "a.js");
+  auto otherContents = cache.prepare(compiling, kScriptB, "a.js");
+  auto otherURL = cache.prepare(compiling, kScriptA, "b.js");
+
+  EXPECT_NE(original, otherContents);
+  EXPECT_NE(original, otherURL);
+  EXPECT_EQ(compiling.prepareCount, 3);
+  EXPECT_EQ(cache.getStats().misses, 3);
+}
+
+TEST_P(PreparedScriptCacheTest, evictsLeastRecentlyUsed) {
+  cache.setCapacity(2 * kScriptA.size());
+  cache.prepare(compiling, kScriptA, "a.js");
+  cache.prepare(compiling, kScriptB, "b.js");
+
+  // Touching a makes b the least recently used script.
+  cache.prepare(compiling, kScriptA, "a.js");
+  cache.prepare(compiling, kScriptC, "c.js");
+
+  auto stats = cache.getStats();
+  EXPECT_EQ(stats.entries, 2);
+  EXPECT_EQ(stats.evictions, 1);
+  EXPECT_EQ(compiling.prepareCount, 3);
+
+  cache.prepare(compiling, kScriptA, "a.js");
+  EXPECT_EQ(compiling.prepareCount, 3);
+  cache.prepare(compiling, kScriptB, "b.js");
+  EXPECT_EQ(compiling.prepareCount, 4);
+}
+
+TEST_P(PreparedScriptCacheTest, scriptsLargerThanCapacityAreNotCached) {
+  cache.setCapacity(kScriptA.size() - 1);
+  auto first = cache.prepare(compiling, kScriptA, "a.js");
+  auto second = cache.prepare(compiling, kScriptA, "a.js");
+
+  EXPECT_NE(first, second);
+  EXPECT_EQ(compiling.prepareCount, 2);
+  auto stats = cache.getStats();
+  EXPECT_EQ(stats.entries, 0);
+  EXPECT_EQ(stats.bytes, 0);
+}
+
+TEST_P(PreparedScriptCacheTest, shrinkingCapacityEvicts) {
+  cache.prepare(compiling, kScriptA, "a.js");
+  cache.prepare(compiling, kScriptB, "b.js");
+
+  cache.setCapacity(kScriptB.size());
+  auto stats = cache.getStats();
+  EXPECT_EQ(stats.entries, 1);
+  EXPECT_EQ(stats.bytes, kScriptB.size());
+  EXPECT_EQ(stats.evictions, 1);
+
+  cache.setCapacity(0);
+  EXPECT_EQ(cache.getStats().entries, 0);
+  cache.prepare(compiling, kScriptB, "b.js");
+  EXPECT_EQ(compiling.prepareCount, 3);
+  EXPECT_EQ(cache.getStats().bypasses, 1);
+}
+
+TEST_P(PreparedScriptCacheTest, sourcePreparationsBypassTheCache) {
+  cache.prepare(sourceOnly, kScriptA, "a.js");
+  cache.prepare(sourceOnly, kScriptA, "a.js");
+
+  EXPECT_EQ(sourceOnly.prepareCount, 2);
+  auto stats = cache.getStats();
+  EXPECT_EQ(stats.entries, 0);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.bypasses, 1);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    PreparedScriptCacheTest,
+    ::testing::ValuesIn(jsi::runtimeGenerators()));
@@ -7,45 +7,104 @@
 
 #include "LongLivedObject.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace facebook {
 namespace react {
 
 // LongLivedObjectCollection
-LongLivedObjectCollection &LongLivedObjectCollection::get() {
-  static LongLivedObjectCollection instance;
-  return instance;
-}
+constexpr size_t LongLivedObjectCollection::kShardCount;
 
 LongLivedObjectCollection::LongLivedObjectCollection() {}
 
-void LongLivedObjectCollection::add(std::shared_ptr<LongLivedObject> so) const {
-  std::lock_guard<std::mutex> lock(collectionMutex_);
-  collection_.insert(so);
+LongLivedObjectCollection::Shard &LongLivedObjectCollection::shardFor(
+    const LongLivedObject *o) {
+  // The low bits of heap addresses are mostly alignment.
+  return shards_[(reinterpret_cast<uintptr_t>(o) >> 4) % kShardCount];
 }
 
-void LongLivedObjectCollection::remove(const LongLivedObject *o) const {
-  std::lock_guard<std::mutex> lock(collectionMutex_);
-  auto p = collection_.begin();
-  for (; p != collection_.end(); p++) {
-    if (p->get() == o) {
-      break;
-    }
+void LongLivedObjectCollection::add(std::shared_ptr<LongLivedObject> so) {
+  LongLivedObject *o = so.get();
+  o->collection_ = shared_from_this();
+
+  Shard &shard = shardFor(o);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  if (o->owner_ != nullptr) {
+    return;
+  }
+  o->owner_ = this;
+  o->self_ = std::move(so);
+  o->previous_ = nullptr;
+  o->next_ = shard.head;
+  if (shard.head != nullptr) {
+    shard.head->previous_ = o;
+  }
+  shard.head = o;
+  shard.added++;
+}
+
+void LongLivedObjectCollection::remove(LongLivedObject *o) {
+  // Destroyed outside of the lock, since destructors may release other
+  // objects.
+  std::shared_ptr<LongLivedObject> self;
+
+  Shard &shard = shardFor(o);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  if (o->owner_ != this) {
+    return;
+  }
+  if (o->previous_ != nullptr) {
+    o->previous_->next_ = o->next_;
+  } else {
+    shard.head = o->next_;
   }
-  if (p != collection_.end()) {
-    collection_.erase(p);
+  if (o->next_ != nullptr) {
+    o->next_->previous_ = o->previous_;
+  }
+  o->owner_ = nullptr;
+  o->previous_ = nullptr;
+  o->next_ = nullptr;
+  self = std::move(o->self_);
+  shard.released++;
+}
+
+void LongLivedObjectCollection::clear() {
+  std::vector<std::shared_ptr<LongLivedObject>> released;
+  for (auto &shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    LongLivedObject *o = shard.head;
+    while (o != nullptr) {
+      LongLivedObject *next = o->next_;
+      o->owner_ = nullptr;
+      o->previous_ = nullptr;
+      o->next_ = nullptr;
+      released.push_back(std::move(o->self_));
+      shard.released++;
+      o = next;
+    }
+    shard.head = nullptr;
   }
 }
 
-void LongLivedObjectCollection::clear() const {
-  std::lock_guard<std::mutex> lock(collectionMutex_);
-  collection_.clear();
+LongLivedObjectCollection::Stats LongLivedObjectCollection::getStats() const {
+  Stats stats{0, 0, 0};
+  for (const auto &shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    stats.added += shard.added;
+    stats.released += shard.released;
+  }
+  stats.live = stats.added - stats.released;
+  return stats;
 }
 
 // LongLivedObject
 LongLivedObject::LongLivedObject() {}
 
 void LongLivedObject::allowRelease() {
-  LongLivedObjectCollection::get().remove(this);
+  if (auto collection = collection_.lock()) {
+    collection->remove(this);
+  }
 }
 
 } // namespace react
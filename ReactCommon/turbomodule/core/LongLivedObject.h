@@ -7,20 +7,23 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <mutex>
-#include <unordered_set>
 
 namespace facebook {
 namespace react {
 
+class LongLivedObjectCollection;
+
 /**
  * A simple wrapper class that can be registered to a collection that keep it
  * alive for extended period of time. This object can be removed from the
  * collection when needed.
  *
  * The subclass of this class must be created using std::make_shared<T>().
- * After creation, add it to the `LongLivedObjectCollection`.
+ * After creation, add it to the `LongLivedObjectCollection` of its runtime,
+ * which TurboModuleBinding hands to every TurboModule it exposes to JS.
  * When done with the object, call `allowRelease()` to allow the OS to release
  * it.
  */
@@ -30,26 +33,70 @@ class LongLivedObject {
 
  protected:
   LongLivedObject();
+
+ private:
+  friend class LongLivedObjectCollection;
+
+  // Set once by LongLivedObjectCollection::add().
+  std::weak_ptr<LongLivedObjectCollection> collection_;
+
+  // Guarded by the mutex of the collection shard this object is in.
+  LongLivedObjectCollection *owner_{nullptr};
+  LongLivedObject *previous_{nullptr};
+  LongLivedObject *next_{nullptr};
+  std::shared_ptr<LongLivedObject> self_;
 };
 
 /**
- * A singleton, thread-safe, write-only collection for the `LongLivedObject`s.
+ * A thread-safe, write-only collection for the `LongLivedObject`s of one
+ * runtime.
+ *
+ * Objects are kept in intrusive lists split across a few shards, each with
+ * its own mutex, so adding and releasing objects from different threads
+ * rarely contends, and removal is O(1).
  */
-class LongLivedObjectCollection {
+class LongLivedObjectCollection
+    : public std::enable_shared_from_this<LongLivedObjectCollection> {
  public:
-  static LongLivedObjectCollection &get();
+  struct Stats {
+    size_t live;
+    size_t added;
+    size_t released;
+  };
+
+  LongLivedObjectCollection();
 
   LongLivedObjectCollection(LongLivedObjectCollection const &) = delete;
   void operator=(LongLivedObjectCollection const &) = delete;
 
-  void add(std::shared_ptr<LongLivedObject> o) const;
-  void remove(const LongLivedObject *o) const;
-  void clear() const;
+  /**
+   * Keeps o alive until it is removed. An object can only be added to one
+   * collection, once.
+   */
+  void add(std::shared_ptr<LongLivedObject> o);
+  void remove(LongLivedObject *o);
+
+  /**
+   * Releases every object. Must be called before the runtime the objects
+   * refer to is destroyed.
+   */
+  void clear();
+
+  Stats getStats() const;
 
  private:
-  LongLivedObjectCollection();
-  mutable std::unordered_set<std::shared_ptr<LongLivedObject>> collection_;
-  mutable std::mutex collectionMutex_;
+  static constexpr size_t kShardCount = 8;
+
+  struct Shard {
+    mutable std::mutex mutex;
+    LongLivedObject *head{nullptr};
+    size_t added{0};
+    size_t released{0};
+  };
+
+  Shard &shardFor(const LongLivedObject *o);
+
+  Shard shards_[kShardCount];
 };
 
 } // namespace react
@@ -68,42 +68,53 @@ jsi::Value TurboCxxModule::get(
     jsi::Runtime &runtime,
     const jsi::PropNameID &propName) {
   std::string propNameUtf8 = propName.utf8(runtime);
+  if (auto method = findCachedMethod(runtime, propNameUtf8)) {
+    return jsi::Value(runtime, *method);
+  }
 
   if (propNameUtf8 == "getConstants") {
     // This is special cased because `getConstants()` is already a part of
     // CxxModule.
-    return jsi::Function::createFromHostFunction(
+    return cacheMethod(
         runtime,
-        propName,
-        0,
-        [this](
-            jsi::Runtime &rt,
-            const jsi::Value &thisVal,
-            const jsi::Value *args,
-            size_t count) {
-          jsi::Object result(rt);
-          auto constants = cxxModule_->getConstants();
-          for (auto &pair : constants) {
-            result.setProperty(
-                rt, pair.first.c_str(), jsi::valueFromDynamic(rt, pair.second));
-          }
-          return result;
-        });
+        propNameUtf8,
+        jsi::Function::createFromHostFunction(
+            runtime,
+            propName,
+            0,
+            [this](
+                jsi::Runtime &rt,
+                const jsi::Value &thisVal,
+                const jsi::Value *args,
+                size_t count) {
+              jsi::Object result(rt);
+              auto constants = cxxModule_->getConstants();
+              for (auto &pair : constants) {
+                result.setProperty(
+                    rt,
+                    pair.first.c_str(),
+                    jsi::valueFromDynamic(rt, pair.second));
+              }
+              return result;
+            }));
   }
 
   for (auto &method : cxxMethods_) {
     if (method.name == propNameUtf8) {
-      return jsi::Function::createFromHostFunction(
+      return cacheMethod(
           runtime,
-          propName,
-          0,
-          [this, propNameUtf8](
-              jsi::Runtime &rt,
-              const jsi::Value &thisVal,
-              const jsi::Value *args,
-              size_t count) {
-            return invokeMethod(rt, VoidKind, propNameUtf8, args, count);
-          });
+          propNameUtf8,
+          jsi::Function::createFromHostFunction(
+              runtime,
+              propName,
+              0,
+              [this, propNameUtf8](
+                  jsi::Runtime &rt,
+                  const jsi::Value &thisVal,
+                  const jsi::Value *args,
+                  size_t count) {
+                return invokeMethod(rt, VoidKind, propNameUtf8, args, count);
+              }));
     }
   }
 
@@ -156,17 +167,20 @@ jsi::Value TurboCxxModule::invokeMethod(
       auto wrapper = CallbackWrapper::createWeak(
           args[count - 1].getObject(runtime).getFunction(runtime),
           runtime,
-          jsInvoker_);
+          jsInvoker_,
+          *longLivedObjectCollection_);
       first = makeTurboCxxModuleCallback(runtime, wrapper);
     } else if (method.callbacks == 2) {
       auto wrapper1 = CallbackWrapper::createWeak(
           args[count - 2].getObject(runtime).getFunction(runtime),
           runtime,
-          jsInvoker_);
+          jsInvoker_,
+          *longLivedObjectCollection_);
       auto wrapper2 = CallbackWrapper::createWeak(
           args[count - 1].getObject(runtime).getFunction(runtime),
           runtime,
-          jsInvoker_);
+          jsInvoker_,
+          *longLivedObjectCollection_);
       first = makeTurboCxxModuleCallback(runtime, wrapper1);
       second = makeTurboCxxModuleCallback(runtime, wrapper2);
     }
@@ -183,9 +197,15 @@ jsi::Value TurboCxxModule::invokeMethod(
         [method, args, count, this](
             jsi::Runtime &rt, std::shared_ptr<Promise> promise) {
           auto resolveWrapper = CallbackWrapper::createWeak(
-              promise->resolve_.getFunction(rt), rt, jsInvoker_);
+              promise->resolve_.getFunction(rt),
+              rt,
+              jsInvoker_,
+              *longLivedObjectCollection_);
           auto rejectWrapper = CallbackWrapper::createWeak(
-              promise->reject_.getFunction(rt), rt, jsInvoker_);
+              promise->reject_.getFunction(rt),
+              rt,
+              jsInvoker_,
+              *longLivedObjectCollection_);
           CxxModule::Callback resolve =
               makeTurboCxxModuleCallback(rt, resolveWrapper);
           CxxModule::Callback reject =
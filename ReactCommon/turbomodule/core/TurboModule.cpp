@@ -7,6 +7,10 @@
 
 #include "TurboModule.h"
 
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
 using namespace facebook;
 
 namespace facebook {
@@ -23,21 +27,76 @@ jsi::Value TurboModule::get(
     jsi::Runtime &runtime,
     const jsi::PropNameID &propName) {
   std::string propNameUtf8 = propName.utf8(runtime);
-  auto p = methodMap_.find(propNameUtf8);
-  if (p == methodMap_.end()) {
-    // Method was not found, let JS decide what to do.
-    return jsi::Value::undefined();
+  if (auto method = findCachedMethod(runtime, propNameUtf8)) {
+    return jsi::Value(runtime, *method);
+  }
+
+  MethodMetadata meta;
+  if (methodTable_ != nullptr) {
+    auto end = methodTable_ + methodTableSize_;
+    auto p = std::lower_bound(
+        methodTable_,
+        end,
+        propNameUtf8.c_str(),
+        [](const TurboModuleMethod &method, const char *name) {
+          return strcmp(method.name, name) < 0;
+        });
+    if (p == end || strcmp(p->name, propNameUtf8.c_str()) != 0 ||
+        strlen(p->name) != propNameUtf8.size()) {
+      return jsi::Value::undefined();
+    }
+    meta = MethodMetadata{p->argCount, p->invoker};
+  } else {
+    auto p = methodMap_.find(propNameUtf8);
+    if (p == methodMap_.end()) {
+      // Method was not found, let JS decide what to do.
+      return jsi::Value::undefined();
+    }
+    meta = p->second;
   }
-  MethodMetadata meta = p->second;
-  return jsi::Function::createFromHostFunction(
+  return cacheMethod(
       runtime,
-      propName,
-      meta.argCount,
-      [this, meta](
-          facebook::jsi::Runtime &rt,
-          const facebook::jsi::Value &thisVal,
-          const facebook::jsi::Value *args,
-          size_t count) { return meta.invoker(rt, *this, args, count); });
+      std::move(propNameUtf8),
+      jsi::Function::createFromHostFunction(
+          runtime,
+          propName,
+          meta.argCount,
+          [this, meta](
+              facebook::jsi::Runtime &rt,
+              const facebook::jsi::Value &thisVal,
+              const facebook::jsi::Value *args,
+              size_t count) { return meta.invoker(rt, *this, args, count); }));
+}
+
+const jsi::Function *TurboModule::findCachedMethod(
+    jsi::Runtime &runtime,
+    const std::string &name) {
+  bindMethodCache(runtime);
+  auto it = methodCache_.find(name);
+  return it == methodCache_.end() ? nullptr : &it->second;
+}
+
+jsi::Value TurboModule::cacheMethod(
+    jsi::Runtime &runtime,
+    std::string name,
+    jsi::Function &&method) {
+  bindMethodCache(runtime);
+  auto it = methodCache_.emplace(std::move(name), std::move(method)).first;
+  return jsi::Value(runtime, it->second);
+}
+
+void TurboModule::bindMethodCache(jsi::Runtime &runtime) {
+  if (&runtime != methodCacheRuntime_) {
+    methodCache_.clear();
+    methodCacheRuntime_ = &runtime;
+  }
+}
+
+void TurboModule::releaseMethodCache(jsi::Runtime &runtime) {
+  if (&runtime == methodCacheRuntime_) {
+    methodCache_.clear();
+    methodCacheRuntime_ = nullptr;
+  }
 }
 
 } // namespace react
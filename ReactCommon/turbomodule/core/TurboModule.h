@@ -13,6 +13,7 @@
 #include <jsi/jsi.h>
 
 #include <ReactCommon/CallInvoker.h>
+#include <ReactCommon/LongLivedObject.h>
 
 namespace facebook {
 namespace react {
@@ -30,6 +31,24 @@ enum TurboModuleMethodValueKind {
   ArrayKind,
   FunctionKind,
   PromiseKind,
+  // A jsi::ArrayBuffer, backed by native memory where the platform allows.
+  ArrayBufferKind,
+};
+
+class TurboModule;
+
+/**
+ * An entry of a static, name-sorted method table. See
+ * TurboModuleMethodTable.h for how to declare one.
+ */
+struct TurboModuleMethod {
+  const char *name;
+  size_t argCount;
+  facebook::jsi::Value (*invoker)(
+      facebook::jsi::Runtime &rt,
+      TurboModule &turboModule,
+      const facebook::jsi::Value *args,
+      size_t count);
 };
 
 /**
@@ -44,10 +63,41 @@ class JSI_EXPORT TurboModule : public facebook::jsi::HostObject {
       facebook::jsi::Runtime &runtime,
       const facebook::jsi::PropNameID &propName) override;
 
+  /**
+   * Releases the method functions cached for the given runtime. Must be
+   * called before the runtime is destroyed; TurboModuleBinding does this for
+   * every module it hands out to JS.
+   */
+  void releaseMethodCache(facebook::jsi::Runtime &runtime);
+
   const std::string name_;
   std::shared_ptr<CallInvoker> jsInvoker_;
 
+  /**
+   * Keeps callbacks and promises created by this module's methods alive.
+   * TurboModuleBinding sets this to the collection of its runtime before it
+   * hands the module out to JS, and clears it before the runtime goes away.
+   */
+  std::shared_ptr<LongLivedObjectCollection> longLivedObjectCollection_;
+
  protected:
+  /**
+   * Returns the function previously cached for `name` in this runtime, or
+   * nullptr. JS code usually looks a method up right before every call, so
+   * `get` implementations should try this before creating a new function.
+   */
+  const facebook::jsi::Function *findCachedMethod(
+      facebook::jsi::Runtime &runtime,
+      const std::string &name);
+
+  /**
+   * Caches `method` as the value of `name` in this runtime and returns it.
+   */
+  facebook::jsi::Value cacheMethod(
+      facebook::jsi::Runtime &runtime,
+      std::string name,
+      facebook::jsi::Function &&method);
+
   struct MethodMetadata {
     size_t argCount;
     facebook::jsi::Value (*invoker)(
@@ -58,6 +108,28 @@ class JSI_EXPORT TurboModule : public facebook::jsi::HostObject {
   };
 
   std::unordered_map<std::string, MethodMetadata> methodMap_;
+
+  /**
+   * Makes `get` look methods up in a static table, sorted by name, instead of
+   * `methodMap_`. The table must outlive the module.
+   */
+  template <size_t N>
+  void setMethodTable(const TurboModuleMethod (&methods)[N]) {
+    methodTable_ = methods;
+    methodTableSize_ = N;
+  }
+
+ private:
+  const TurboModuleMethod *methodTable_{nullptr};
+  size_t methodTableSize_{0};
+
+  // Drops the cached methods of any other runtime.
+  void bindMethodCache(facebook::jsi::Runtime &runtime);
+
+  // Modules are bound to a single runtime in practice, so the cache only
+  // holds the methods of the runtime which accessed the module last.
+  facebook::jsi::Runtime *methodCacheRuntime_{nullptr};
+  std::unordered_map<std::string, facebook::jsi::Function> methodCache_;
 };
 
 /**
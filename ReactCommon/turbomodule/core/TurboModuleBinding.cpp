@@ -10,7 +10,6 @@
 #include <stdexcept>
 #include <string>
 
-#include <ReactCommon/LongLivedObject.h>
 #include <cxxreact/SystraceSection.h>
 
 using namespace facebook;
@@ -23,7 +22,9 @@ namespace react {
  */
 TurboModuleBinding::TurboModuleBinding(
     const TurboModuleProviderFunctionType &&moduleProvider)
-    : moduleProvider_(std::move(moduleProvider)) {}
+    : moduleProvider_(std::move(moduleProvider)),
+      longLivedObjectCollection_(
+          std::make_shared<LongLivedObjectCollection>()) {}
 
 void TurboModuleBinding::install(
     jsi::Runtime &runtime,
@@ -46,7 +47,14 @@ void TurboModuleBinding::install(
 }
 
 TurboModuleBinding::~TurboModuleBinding() {
-  LongLivedObjectCollection::get().clear();
+  longLivedObjectCollection_->clear();
+  if (runtime_ != nullptr) {
+    for (auto &pair : modules_) {
+      if (auto module = pair.second.lock()) {
+        module->releaseMethodCache(*runtime_);
+      }
+    }
+  }
 }
 
 std::shared_ptr<TurboModule> TurboModuleBinding::getModule(
@@ -75,6 +83,10 @@ jsi::Value TurboModuleBinding::jsProxy(
     return jsi::Value::null();
   }
 
+  runtime_ = &runtime;
+  modules_.emplace(module.get(), module);
+  module->longLivedObjectCollection_ = longLivedObjectCollection_;
+
   return jsi::Object::createFromHostObject(runtime, std::move(module));
 }
 
@@ -8,7 +8,9 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 
+#include <ReactCommon/LongLivedObject.h>
 #include <ReactCommon/TurboModule.h>
 #include <jsi/jsi.h>
 
@@ -50,6 +52,14 @@ class TurboModuleBinding {
       size_t count);
 
   TurboModuleProviderFunctionType moduleProvider_;
+
+  // The long-lived objects of the runtime this binding is installed in.
+  std::shared_ptr<LongLivedObjectCollection> longLivedObjectCollection_;
+
+  // Modules handed out to JS, whose method caches must be released before
+  // the runtime goes away.
+  jsi::Runtime *runtime_{nullptr};
+  std::unordered_map<TurboModule *, std::weak_ptr<TurboModule>> modules_;
 };
 
 } // namespace react
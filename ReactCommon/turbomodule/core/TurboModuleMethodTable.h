@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <ReactCommon/TurboModule.h>
+#include <jsi/jsi.h>
+
+/**
+ * Helpers for C++ TurboModules which declare their methods in a static table
+ * instead of filling `methodMap_` at runtime:
+ *
+ *   class MyModule : public TurboModule {
+ *    public:
+ *     MyModule(std::shared_ptr<CallInvoker> jsInvoker);
+ *     double add(jsi::Runtime &rt, double a, double b);
+ *     std::string greet(jsi::Runtime &rt, const std::string &name);
+ *   };
+ *
+ *   constexpr TurboModuleMethod kMyModuleMethods[] = {
+ *       TURBOMODULE_METHOD(MyModule, add),
+ *       TURBOMODULE_METHOD(MyModule, greet),
+ *   };
+ *   static_assert(isSortedMethodTable(kMyModuleMethods), "Sort by name");
+ *
+ *   MyModule::MyModule(std::shared_ptr<CallInvoker> jsInvoker)
+ *       : TurboModule("MyModule", jsInvoker) {
+ *     setMethodTable(kMyModuleMethods);
+ *   }
+ *
+ * Arguments are converted straight from jsi::Value to the declared parameter
+ * types, and results straight back, without going through folly::dynamic.
+ * A missing or mistyped argument throws a JSIException into JS. Binary data
+ * can be taken as a jsi::ArrayBuffer, and returned without a copy as a
+ * std::shared_ptr to a jsi::MutableBuffer subclass.
+ */
+
+namespace facebook {
+namespace react {
+
+constexpr int compareMethodNames(const char *a, const char *b) {
+  return (*a != *b || *a == '\0')
+      ? (static_cast<unsigned char>(*a) < static_cast<unsigned char>(*b)
+             ? -1
+             : (*a == *b ? 0 : 1))
+      : compareMethodNames(a + 1, b + 1);
+}
+
+/**
+ * Checks at compile time that a method table is sorted by name and free of
+ * duplicates, as TurboModule's binary search requires.
+ */
+template <size_t N>
+constexpr bool isSortedMethodTable(const TurboModuleMethod (&methods)[N]) {
+  for (size_t i = 1; i < N; i++) {
+    if (compareMethodNames(methods[i - 1].name, methods[i].name) >= 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Converts a JS argument to the C++ parameter type T.
+ */
+template <typename T, typename Enable = void>
+struct TurboModuleArgument;
+
+template <>
+struct TurboModuleArgument<double> {
+  static double convert(jsi::Runtime &, const jsi::Value &value) {
+    return value.asNumber();
+  }
+};
+
+// Follows ToInt32 from the JS spec, as `value | 0` does in JS: casting NaN
+// or an out of range double to int directly is undefined behavior.
+template <>
+struct TurboModuleArgument<int> {
+  static int convert(jsi::Runtime &, const jsi::Value &value) {
+    constexpr double kTwoTo31 = 2147483648.0;
+    constexpr double kTwoTo32 = 4294967296.0;
+    double number = value.asNumber();
+    if (!std::isfinite(number)) {
+      return 0;
+    }
+    double wrapped = std::fmod(std::trunc(number), kTwoTo32);
+    if (wrapped < -kTwoTo31) {
+      wrapped += kTwoTo32;
+    } else if (wrapped >= kTwoTo31) {
+      wrapped -= kTwoTo32;
+    }
+    return static_cast<int>(wrapped);
+  }
+};
+
+template <>
+struct TurboModuleArgument<bool> {
+  static bool convert(jsi::Runtime &runtime, const jsi::Value &value) {
+    if (!value.isBool()) {
+      throw jsi::JSError(runtime, "Expected a boolean argument");
+    }
+    return value.getBool();
+  }
+};
+
+template <>
+struct TurboModuleArgument<std::string> {
+  static std::string convert(jsi::Runtime &runtime, const jsi::Value &value) {
+    return value.asString(runtime).utf8(runtime);
+  }
+};
+
+template <>
+struct TurboModuleArgument<jsi::String> {
+  static jsi::String convert(jsi::Runtime &runtime, const jsi::Value &value) {
+    return value.asString(runtime);
+  }
+};
+
+template <>
+struct TurboModuleArgument<jsi::Object> {
+  static jsi::Object convert(jsi::Runtime &runtime, const jsi::Value &value) {
+    return value.asObject(runtime);
+  }
+};
+
+template <>
+struct TurboModuleArgument<jsi::Array> {
+  static jsi::Array convert(jsi::Runtime &runtime, const jsi::Value &value) {
+    return value.asObject(runtime).asArray(runtime);
+  }
+};
+
+template <>
+struct TurboModuleArgument<jsi::Function> {
+  static jsi::Function convert(jsi::Runtime &runtime, const jsi::Value &value) {
+    return value.asObject(runtime).asFunction(runtime);
+  }
+};
+
+template <>
+struct TurboModuleArgument<jsi::ArrayBuffer> {
+  static jsi::ArrayBuffer convert(
+      jsi::Runtime &runtime,
+      const jsi::Value &value) {
+    jsi::Object object = value.asObject(runtime);
+    if (!object.isArrayBuffer(runtime)) {
+      throw jsi::JSError(runtime, "Expected an ArrayBuffer argument");
+    }
+    return std::move(object).getArrayBuffer(runtime);
+  }
+};
+
+template <>
+struct TurboModuleArgument<jsi::Value> {
+  static const jsi::Value &convert(jsi::Runtime &, const jsi::Value &value) {
+    return value;
+  }
+};
+
+/**
+ * Converts a C++ result to a JS value.
+ */
+template <typename T, typename Enable = void>
+struct TurboModuleResult {
+  // jsi::String, jsi::Object, jsi::Array, jsi::ArrayBuffer, jsi::Function
+  // and jsi::Value.
+  static jsi::Value convert(jsi::Runtime &, T &&result) {
+    return jsi::Value(std::move(result));
+  }
+};
+
+template <>
+struct TurboModuleResult<bool> {
+  static jsi::Value convert(jsi::Runtime &, bool result) {
+    return jsi::Value(result);
+  }
+};
+
+template <typename T>
+struct TurboModuleResult<
+    T,
+    typename std::enable_if<
+        std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>::type> {
+  static jsi::Value convert(jsi::Runtime &, T result) {
+    return jsi::Value(static_cast<double>(result));
+  }
+};
+
+template <>
+struct TurboModuleResult<std::string> {
+  static jsi::Value convert(jsi::Runtime &runtime, std::string &&result) {
+    return jsi::String::createFromUtf8(runtime, result);
+  }
+};
+
+// Native memory is handed to JS as an ArrayBuffer without being copied.
+template <typename T>
+struct TurboModuleResult<
+    std::shared_ptr<T>,
+    typename std::enable_if<
+        std::is_base_of<jsi::MutableBuffer, T>::value>::type> {
+  static jsi::Value convert(
+      jsi::Runtime &runtime,
+      std::shared_ptr<T> &&result) {
+    if (!result) {
+      return jsi::Value::null();
+    }
+    return jsi::ArrayBuffer(runtime, std::move(result));
+  }
+};
+
+namespace detail {
+
+inline const jsi::Value &
+argumentAt(const jsi::Value *args, size_t count, size_t index) {
+  static const jsi::Value undefined;
+  return index < count ? args[index] : undefined;
+}
+
+template <typename T, typename Result, typename... Args>
+struct TurboModuleMethodCall {
+  template <typename Method, size_t... I>
+  static jsi::Value call(
+      jsi::Runtime &runtime,
+      T &module,
+      Method method,
+      const jsi::Value *args,
+      size_t count,
+      std::index_sequence<I...>) {
+    return TurboModuleResult<Result>::convert(
+        runtime,
+        (module.*method)(
+            runtime,
+            TurboModuleArgument<typename std::decay<Args>::type>::convert(
+                runtime, argumentAt(args, count, I))...));
+  }
+
+  template <typename Method>
+  static jsi::Value call(
+      jsi::Runtime &runtime,
+      T &module,
+      Method method,
+      const jsi::Value *,
+      size_t,
+      std::index_sequence<>) {
+    return TurboModuleResult<Result>::convert(
+        runtime, (module.*method)(runtime));
+  }
+};
+
+template <typename T, typename... Args>
+struct TurboModuleMethodCall<T, void, Args...> {
+  template <typename Method, size_t... I>
+  static jsi::Value call(
+      jsi::Runtime &runtime,
+      T &module,
+      Method method,
+      const jsi::Value *args,
+      size_t count,
+      std::index_sequence<I...>) {
+    (module.*method)(
+        runtime,
+        TurboModuleArgument<typename std::decay<Args>::type>::convert(
+            runtime, argumentAt(args, count, I))...);
+    return jsi::Value::undefined();
+  }
+
+  template <typename Method>
+  static jsi::Value call(
+      jsi::Runtime &runtime,
+      T &module,
+      Method method,
+      const jsi::Value *,
+      size_t,
+      std::index_sequence<>) {
+    (module.*method)(runtime);
+    return jsi::Value::undefined();
+  }
+};
+
+} // namespace detail
+
+/**
+ * Adapts a member function `Result T::method(jsi::Runtime &, Args...)` to the
+ * TurboModuleMethod invoker signature.
+ */
+template <typename MethodType, MethodType Method>
+struct TurboModuleMethodInvoker;
+
+template <
+    typename T,
+    typename Result,
+    typename... Args,
+    Result (T::*Method)(jsi::Runtime &, Args...)>
+struct TurboModuleMethodInvoker<
+    Result (T::*)(jsi::Runtime &, Args...),
+    Method> {
+  static constexpr size_t kArgCount = sizeof...(Args);
+
+  static jsi::Value invoke(
+      jsi::Runtime &runtime,
+      TurboModule &turboModule,
+      const jsi::Value *args,
+      size_t count) {
+    return detail::TurboModuleMethodCall<T, Result, Args...>::call(
+        runtime,
+        static_cast<T &>(turboModule),
+        Method,
+        args,
+        count,
+        std::index_sequence_for<Args...>{});
+  }
+};
+
+template <
+    typename T,
+    typename Result,
+    typename... Args,
+    Result (T::*Method)(jsi::Runtime &, Args...) const>
+struct TurboModuleMethodInvoker<
+    Result (T::*)(jsi::Runtime &, Args...) const,
+    Method> {
+  static constexpr size_t kArgCount = sizeof...(Args);
+
+  static jsi::Value invoke(
+      jsi::Runtime &runtime,
+      TurboModule &turboModule,
+      const jsi::Value *args,
+      size_t count) {
+    return detail::TurboModuleMethodCall<const T, Result, Args...>::call(
+        runtime,
+        static_cast<const T &>(turboModule),
+        Method,
+        args,
+        count,
+        std::index_sequence_for<Args...>{});
+  }
+};
+
+} // namespace react
+} // namespace facebook
+
+/**
+ * Declares a method table entry for `Class::method`, exposed to JS under the
+ * same name.
+ */
+#define TURBOMODULE_METHOD(Class, method)                                   \
+  ::facebook::react::TurboModuleMethod {                                    \
+    #method,                                                                \
+        ::facebook::react::TurboModuleMethodInvoker<                        \
+            decltype(&Class::method),                                       \
+            &Class::method>::kArgCount,                                     \
+        &::facebook::react::TurboModuleMethodInvoker<                       \
+            decltype(&Class::method),                                       \
+            &Class::method>::invoke                                         \
+  }
@@ -57,13 +57,18 @@ class CallbackWrapper : public LongLivedObject {
   std::shared_ptr<CallInvoker> jsInvoker_;
 
  public:
+  /**
+   * The wrapper is kept alive by `longLivedObjects`, which must be the
+   * collection of `runtime`, until `destroy()` is called.
+   */
   static std::weak_ptr<CallbackWrapper> createWeak(
       jsi::Function &&callback,
       jsi::Runtime &runtime,
-      std::shared_ptr<CallInvoker> jsInvoker) {
+      std::shared_ptr<CallInvoker> jsInvoker,
+      LongLivedObjectCollection &longLivedObjects) {
     auto wrapper = std::shared_ptr<CallbackWrapper>(
         new CallbackWrapper(std::move(callback), runtime, jsInvoker));
-    LongLivedObjectCollection::get().add(wrapper);
+    longLivedObjects.add(wrapper);
     return wrapper;
   }
 
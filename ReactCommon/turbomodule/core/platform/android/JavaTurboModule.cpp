@@ -5,11 +5,14 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
 
 #include <fbjni/fbjni.h>
+#include <folly/Optional.h>
 #include <jsi/jsi.h>
 
 #include <ReactCommon/TurboModule.h>
@@ -30,6 +33,7 @@ JavaTurboModule::JavaTurboModule(
     std::shared_ptr<CallInvoker> nativeInvoker)
     : TurboModule(name, jsInvoker),
       instance_(jni::make_global(instance)),
+      instanceClass_(jni::make_global(instance->getClass())),
       nativeInvoker_(nativeInvoker) {}
 
 namespace {
@@ -37,9 +41,10 @@ namespace {
 jni::local_ref<JCxxCallbackImpl::JavaPart> createJavaCallbackFromJSIFunction(
     jsi::Function &&function,
     jsi::Runtime &rt,
-    std::shared_ptr<CallInvoker> jsInvoker) {
-  auto weakWrapper =
-      react::CallbackWrapper::createWeak(std::move(function), rt, jsInvoker);
+    std::shared_ptr<CallInvoker> jsInvoker,
+    LongLivedObjectCollection &longLivedObjects) {
+  auto weakWrapper = react::CallbackWrapper::createWeak(
+      std::move(function), rt, jsInvoker, longLivedObjects);
 
   std::function<void(folly::dynamic)> fn =
       [weakWrapper,
@@ -86,6 +91,29 @@ jni::local_ref<JCxxCallbackImpl::JavaPart> createJavaCallbackFromJSIFunction(
   return JCxxCallbackImpl::newObjectCxxArgs(fn);
 }
 
+// Keeps a direct java.nio.ByteBuffer alive while JS refers to its memory.
+class DirectByteBufferMutableBuffer : public jsi::MutableBuffer {
+ public:
+  DirectByteBufferMutableBuffer(
+      jni::global_ref<jobject> byteBuffer,
+      uint8_t *data,
+      size_t size)
+      : byteBuffer_(std::move(byteBuffer)), data_(data), size_(size) {}
+
+  size_t size() const override {
+    return size_;
+  }
+
+  uint8_t *data() override {
+    return data_;
+  }
+
+ private:
+  jni::global_ref<jobject> byteBuffer_;
+  uint8_t *data_;
+  size_t size_;
+};
+
 template <typename T>
 std::string to_string(T v) {
   std::ostringstream stream;
@@ -158,50 +186,6 @@ class JavaTurboModuleInvalidArgumentCountException : public std::runtime_error {
             to_string(expectedArgCount) + ").") {}
 };
 
-/**
- * See
- * https://docs.oracle.com/javase/7/docs/technotes/guides/jni/spec/types.html
- * for a description of Java method signature structure.
- */
-std::vector<std::string> getMethodArgTypesFromSignature(
-    const std::string &methodSignature) {
-  std::vector<std::string> methodArgs;
-
-  for (auto it = methodSignature.begin(); it != methodSignature.end();
-       it += 1) {
-    if (*it == '(') {
-      continue;
-    }
-
-    if (*it == ')') {
-      break;
-    }
-
-    std::string type;
-
-    if (*it == '[') {
-      type += *it;
-      it += 1;
-    }
-
-    if (*it == 'L') {
-      for (; it != methodSignature.end(); it += 1) {
-        type += *it;
-
-        if (*it == ';') {
-          break;
-        }
-      }
-    } else {
-      type += *it;
-    }
-
-    methodArgs.push_back(type);
-  }
-
-  return methodArgs;
-}
-
 } // namespace
 
 // fnjni already does this conversion, but since we are using plain JNI, this
@@ -211,8 +195,8 @@ std::vector<std::string> getMethodArgTypesFromSignature(
 JNIArgs JavaTurboModule::convertJSIArgsToJNIArgs(
     JNIEnv *env,
     jsi::Runtime &rt,
-    std::string methodName,
-    std::vector<std::string> methodArgTypes,
+    const std::string &methodName,
+    const std::vector<std::string> &methodArgTypes,
     const jsi::Value *args,
     size_t count,
     std::shared_ptr<CallInvoker> jsInvoker,
@@ -242,11 +226,10 @@ JNIArgs JavaTurboModule::convertJSIArgsToJNIArgs(
     return obj;
   };
 
-  jclass booleanClass = nullptr;
-  jclass doubleClass = nullptr;
+  const auto &classes = JavaTurboModuleClasses::get(env);
 
   for (unsigned int argIndex = 0; argIndex < count; argIndex += 1) {
-    std::string type = methodArgTypes.at(argIndex);
+    const std::string &type = methodArgTypes.at(argIndex);
 
     const jsi::Value *arg = &args[argIndex];
     jvalue *jarg = &jargs[argIndex];
@@ -275,7 +258,8 @@ JNIArgs JavaTurboModule::convertJSIArgsToJNIArgs(
           type == "Ljava/lang/String;" ||
           type == "Lcom/facebook/react/bridge/ReadableArray;" ||
           type == "Lcom/facebook/react/bridge/Callback;" ||
-          type == "Lcom/facebook/react/bridge/ReadableMap;")) {
+          type == "Lcom/facebook/react/bridge/ReadableMap;" ||
+          type == "Ljava/nio/ByteBuffer;")) {
       throw JavaTurboModuleInvalidArgumentTypeException(
           type, argIndex, methodName);
     }
@@ -291,14 +275,8 @@ JNIArgs JavaTurboModule::convertJSIArgsToJNIArgs(
             "number", argIndex, methodName, arg, &rt);
       }
 
-      if (doubleClass == nullptr) {
-        doubleClass = env->FindClass("java/lang/Double");
-      }
-
-      jmethodID doubleConstructor =
-          env->GetMethodID(doubleClass, "<init>", "(D)V");
-      jarg->l = makeGlobalIfNecessary(
-          env->NewObject(doubleClass, doubleConstructor, arg->getNumber()));
+      jarg->l = makeGlobalIfNecessary(env->NewObject(
+          classes.doubleClass, classes.doubleConstructor, arg->getNumber()));
       continue;
     }
 
@@ -308,14 +286,8 @@ JNIArgs JavaTurboModule::convertJSIArgsToJNIArgs(
             "boolean", argIndex, methodName, arg, &rt);
       }
 
-      if (booleanClass == nullptr) {
-        booleanClass = env->FindClass("java/lang/Boolean");
-      }
-
-      jmethodID booleanConstructor =
-          env->GetMethodID(booleanClass, "<init>", "(Z)V");
-      jarg->l = makeGlobalIfNecessary(
-          env->NewObject(booleanClass, booleanConstructor, arg->getBool()));
+      jarg->l = makeGlobalIfNecessary(env->NewObject(
+          classes.booleanClass, classes.booleanConstructor, arg->getBool()));
       continue;
     }
 
@@ -351,7 +323,8 @@ JNIArgs JavaTurboModule::convertJSIArgsToJNIArgs(
 
       jsi::Function fn = arg->getObject(rt).getFunction(rt);
       jarg->l = makeGlobalIfNecessary(
-          createJavaCallbackFromJSIFunction(std::move(fn), rt, jsInvoker)
+          createJavaCallbackFromJSIFunction(
+              std::move(fn), rt, jsInvoker, *longLivedObjectCollection_)
               .release());
       continue;
     }
@@ -368,6 +341,38 @@ JNIArgs JavaTurboModule::convertJSIArgsToJNIArgs(
       jarg->l = makeGlobalIfNecessary(jParams.release());
       continue;
     }
+
+    if (type == "Ljava/nio/ByteBuffer;") {
+      if (!(arg->isObject() && arg->getObject(rt).isArrayBuffer(rt))) {
+        throw JavaTurboModuleArgumentConversionException(
+            "ArrayBuffer", argIndex, methodName, arg, &rt);
+      }
+
+      // The ArrayBuffer's memory belongs to the JS heap and may be collected
+      // or detached before an async method runs, so it is copied into a
+      // direct buffer which Java owns.
+      auto arrayBuffer = arg->getObject(rt).getArrayBuffer(rt);
+      size_t size = arrayBuffer.size(rt);
+      if (size > static_cast<size_t>(std::numeric_limits<jint>::max())) {
+        throw std::runtime_error(
+            "ArrayBuffer argument " + to_string(argIndex) + " of method \"" +
+            methodName + "\" is too large for a ByteBuffer (" +
+            to_string(size) + " bytes)");
+      }
+      jobject byteBuffer = env->CallStaticObjectMethod(
+          classes.byteBufferClass,
+          classes.allocateDirect,
+          static_cast<jint>(size));
+      FACEBOOK_JNI_THROW_PENDING_EXCEPTION();
+      if (size > 0) {
+        memcpy(
+            env->GetDirectBufferAddress(byteBuffer),
+            arrayBuffer.data(rt),
+            size);
+      }
+      jarg->l = makeGlobalIfNecessary(byteBuffer);
+      continue;
+    }
   }
 
   return jniArgs;
@@ -378,13 +383,9 @@ jsi::Value convertFromJMapToValue(JNIEnv *env, jsi::Runtime &rt, jobject arg) {
   // This could also be done purely in C++, but iterative over map methods
   // but those may end up calling reflection methods anyway
   // TODO (axe) Investigate the best way to convert Java Map to Value
-  jclass jArguments = env->FindClass("com/facebook/react/bridge/Arguments");
-  static jmethodID jMakeNativeMap = env->GetStaticMethodID(
-      jArguments,
-      "makeNativeMap",
-      "(Ljava/util/Map;)Lcom/facebook/react/bridge/WritableNativeMap;");
-  auto constants =
-      (jobject)env->CallStaticObjectMethod(jArguments, jMakeNativeMap, arg);
+  const auto &classes = JavaTurboModuleClasses::get(env);
+  auto constants = (jobject)env->CallStaticObjectMethod(
+      classes.argumentsClass, classes.makeNativeMap, arg);
   auto jResult = jni::adopt_local(constants);
   auto result = jni::static_ref_cast<NativeMap::jhybridobject>(jResult);
   return jsi::valueFromDynamic(rt, result->cthis()->consume());
@@ -400,8 +401,17 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
   JNIEnv *env = jni::Environment::current();
   auto instance = instance_.get();
 
+  const JavaTurboModuleMethod *method = methodCache_.get(
+      env, instanceClass_.get(), methodName, methodSignature);
+
+  // If the method signature doesn't match, show a redbox here instead of
+  // crashing later.
+  FACEBOOK_JNI_THROW_PENDING_EXCEPTION();
+
+  jmethodID methodID = method->methodID;
+
   /**
-   * To account for jclasses and other misc LocalReferences we create.
+   * To account for misc LocalReferences we create.
    */
   unsigned int buffer = 6;
   /**
@@ -415,7 +425,8 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
    * GlobalReferences. The LocalReferences are then promptly deleted
    * after the conversion.
    */
-  unsigned int actualArgCount = valueKind == VoidKind ? 0 : argCount;
+  unsigned int actualArgCount =
+      valueKind == VoidKind ? 0 : method->objectArgCount;
   unsigned int estimatedLocalRefCount =
       actualArgCount + maxReturnObjects + buffer;
 
@@ -429,16 +440,14 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
    * so that PushLocalFrame can throw an out of memory error when the total
    * number of alive LocalReferences is estimatedLocalRefCount smaller than
    * kJniLocalRefMax.
+   *
+   * Methods which only take and return primitives create no
+   * LocalReferences, so they skip the frame altogether.
    */
-  jni::JniLocalScope scope(env, estimatedLocalRefCount);
-
-  jclass cls = env->GetObjectClass(instance);
-  jmethodID methodID =
-      env->GetMethodID(cls, methodName.c_str(), methodSignature.c_str());
-
-  // If the method signature doesn't match, show a redbox here instead of
-  // crashing later.
-  FACEBOOK_JNI_THROW_PENDING_EXCEPTION();
+  folly::Optional<jni::JniLocalScope> scope;
+  if (method->needsLocalFrame) {
+    scope.emplace(env, estimatedLocalRefCount);
+  }
 
   // TODO(T43933641): Refactor to remove this special-casing
   if (methodName == "getConstants") {
@@ -452,14 +461,11 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
     return convertFromJMapToValue(env, runtime, constantsMap);
   }
 
-  std::vector<std::string> methodArgTypes =
-      getMethodArgTypesFromSignature(methodSignature);
-
   JNIArgs jniArgs = convertJSIArgsToJNIArgs(
       env,
       runtime,
       methodName,
-      methodArgTypes,
+      method->argTypes,
       args,
       argCount,
       jsInvoker_,
@@ -491,8 +497,7 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
       return jsi::Value::undefined();
     }
     case BooleanKind: {
-      std::string returnType =
-          methodSignature.substr(methodSignature.find_last_of(')') + 1);
+      const std::string &returnType = method->returnType;
       if (returnType == "Ljava/lang/Boolean;") {
         auto returnObject =
             (jobject)env->CallObjectMethodA(instance, methodID, jargs.data());
@@ -502,11 +507,8 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
           return jsi::Value::null();
         }
 
-        jclass booleanClass = env->FindClass("java/lang/Boolean");
-        jmethodID booleanValueMethod =
-            env->GetMethodID(booleanClass, "booleanValue", "()Z");
-        bool returnBoolean =
-            (bool)env->CallBooleanMethod(returnObject, booleanValueMethod);
+        bool returnBoolean = (bool)env->CallBooleanMethod(
+            returnObject, JavaTurboModuleClasses::get(env).booleanValue);
         FACEBOOK_JNI_THROW_PENDING_EXCEPTION();
 
         return jsi::Value(returnBoolean);
@@ -519,8 +521,7 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
       return jsi::Value(returnBoolean);
     }
     case NumberKind: {
-      std::string returnType =
-          methodSignature.substr(methodSignature.find_last_of(')') + 1);
+      const std::string &returnType = method->returnType;
       if (returnType == "Ljava/lang/Double;") {
         auto returnObject =
             (jobject)env->CallObjectMethodA(instance, methodID, jargs.data());
@@ -530,11 +531,8 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
           return jsi::Value::null();
         }
 
-        jclass doubleClass = env->FindClass("java/lang/Double");
-        jmethodID doubleValueMethod =
-            env->GetMethodID(doubleClass, "doubleValue", "()D");
-        double returnDouble =
-            (double)env->CallDoubleMethod(returnObject, doubleValueMethod);
+        double returnDouble = (double)env->CallDoubleMethod(
+            returnObject, JavaTurboModuleClasses::get(env).doubleValue);
         FACEBOOK_JNI_THROW_PENDING_EXCEPTION();
 
         return jsi::Value(returnDouble);
@@ -583,6 +581,29 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
       auto result = jni::static_ref_cast<NativeArray::jhybridobject>(jResult);
       return jsi::valueFromDynamic(runtime, result->cthis()->consume());
     }
+    case ArrayBufferKind: {
+      auto returnObject =
+          (jobject)env->CallObjectMethodA(instance, methodID, jargs.data());
+      FACEBOOK_JNI_THROW_PENDING_EXCEPTION();
+
+      if (returnObject == nullptr) {
+        return jsi::Value::null();
+      }
+      auto byteBuffer = jni::adopt_local(returnObject);
+      auto data = static_cast<uint8_t *>(
+          env->GetDirectBufferAddress(byteBuffer.get()));
+      if (data == nullptr) {
+        throw std::runtime_error(
+            "TurboModule method \"" + methodName +
+            "\" must return a direct ByteBuffer");
+      }
+      auto size = static_cast<size_t>(
+          env->GetDirectBufferCapacity(byteBuffer.get()));
+      return jsi::ArrayBuffer(
+          runtime,
+          std::make_shared<DirectByteBufferMutableBuffer>(
+              jni::make_global(byteBuffer), data, size));
+    }
     case PromiseKind: {
       jsi::Function Promise =
           runtime.global().getPropertyAsFunction(runtime, "Promise");
@@ -608,21 +629,24 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
                     runtime);
 
             auto resolve = createJavaCallbackFromJSIFunction(
-                               std::move(resolveJSIFn), runtime, jsInvoker_)
+                               std::move(resolveJSIFn),
+                               runtime,
+                               jsInvoker_,
+                               *longLivedObjectCollection_)
                                .release();
             auto reject = createJavaCallbackFromJSIFunction(
-                              std::move(rejectJSIFn), runtime, jsInvoker_)
+                              std::move(rejectJSIFn),
+                              runtime,
+                              jsInvoker_,
+                              *longLivedObjectCollection_)
                               .release();
 
-            jclass jPromiseImpl =
-                env->FindClass("com/facebook/react/bridge/PromiseImpl");
-            jmethodID jPromiseImplConstructor = env->GetMethodID(
-                jPromiseImpl,
-                "<init>",
-                "(Lcom/facebook/react/bridge/Callback;Lcom/facebook/react/bridge/Callback;)V");
-
+            const auto &classes = JavaTurboModuleClasses::get(env);
             jobject promise = env->NewObject(
-                jPromiseImpl, jPromiseImplConstructor, resolve, reject);
+                classes.promiseImplClass,
+                classes.promiseImplConstructor,
+                resolve,
+                reject);
 
             jargs[argCount].l = promise;
             env->CallVoidMethodA(instance, methodID, jargs.data());
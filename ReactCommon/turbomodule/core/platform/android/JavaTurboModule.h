@@ -16,6 +16,8 @@
 #include <jsi/jsi.h>
 #include <react/jni/JCallback.h>
 
+#include "JavaTurboModuleMethodCache.h"
+
 namespace facebook {
 namespace react {
 
@@ -47,13 +49,15 @@ class JSI_EXPORT JavaTurboModule : public TurboModule {
 
  private:
   jni::global_ref<JTurboModule> instance_;
+  jni::global_ref<jni::JClass> instanceClass_;
   std::shared_ptr<CallInvoker> nativeInvoker_;
+  JavaTurboModuleMethodCache methodCache_;
 
   JNIArgs convertJSIArgsToJNIArgs(
       JNIEnv *env,
       jsi::Runtime &rt,
-      std::string methodName,
-      std::vector<std::string> methodArgTypes,
+      const std::string &methodName,
+      const std::vector<std::string> &methodArgTypes,
       const jsi::Value *args,
       size_t count,
       std::shared_ptr<CallInvoker> jsInvoker,
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "JavaTurboModuleMethodCache.h"
+
+#include <stdexcept>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+bool isObjectType(const std::string &type) {
+  return !type.empty() && (type[0] == 'L' || type[0] == '[');
+}
+
+// Turns a failed lookup, and the Java exception it left pending, into a C++
+// exception, so that no further JNI calls are made with an exception pending.
+template <typename T>
+T checkResolved(JNIEnv *env, T result, const char *name) {
+  if (result == nullptr || env->ExceptionCheck()) {
+    env->ExceptionClear();
+    throw std::runtime_error(
+        std::string("JavaTurboModule could not resolve ") + name);
+  }
+  return result;
+}
+
+jclass findGlobalClass(JNIEnv *env, const char *name) {
+  jclass localClass = checkResolved(env, env->FindClass(name), name);
+  auto globalClass = static_cast<jclass>(env->NewGlobalRef(localClass));
+  env->DeleteLocalRef(localClass);
+  return checkResolved(env, globalClass, name);
+}
+
+} // namespace
+
+std::vector<std::string> getMethodArgTypesFromSignature(
+    const std::string &methodSignature) {
+  std::vector<std::string> methodArgs;
+
+  for (auto it = methodSignature.begin(); it != methodSignature.end();
+       it += 1) {
+    if (*it == '(') {
+      continue;
+    }
+
+    if (*it == ')') {
+      break;
+    }
+
+    std::string type;
+
+    if (*it == '[') {
+      type += *it;
+      it += 1;
+    }
+
+    if (*it == 'L') {
+      for (; it != methodSignature.end(); it += 1) {
+        type += *it;
+
+        if (*it == ';') {
+          break;
+        }
+      }
+    } else {
+      type += *it;
+    }
+
+    methodArgs.push_back(type);
+  }
+
+  return methodArgs;
+}
+
+const JavaTurboModuleMethod *JavaTurboModuleMethodCache::get(
+    JNIEnv *env,
+    jclass cls,
+    const std::string &name,
+    const std::string &signature) {
+  auto it = methods_.find(name);
+  if (it != methods_.end() && it->second.signature == signature) {
+    return &it->second;
+  }
+
+  jmethodID methodID = env->GetMethodID(cls, name.c_str(), signature.c_str());
+  if (methodID == nullptr) {
+    return nullptr;
+  }
+
+  JavaTurboModuleMethod method;
+  method.methodID = methodID;
+  method.signature = signature;
+  method.argTypes = getMethodArgTypesFromSignature(signature);
+  method.returnType = signature.substr(signature.find_last_of(')') + 1);
+  method.objectArgCount = 0;
+  for (const auto &type : method.argTypes) {
+    if (isObjectType(type)) {
+      method.objectArgCount++;
+    }
+  }
+  method.needsLocalFrame =
+      method.objectArgCount > 0 || isObjectType(method.returnType);
+
+  auto &entry = methods_[name];
+  entry = std::move(method);
+  return &entry;
+}
+
+JavaTurboModuleClasses JavaTurboModuleClasses::resolve(JNIEnv *env) {
+  JavaTurboModuleClasses classes{};
+  try {
+    classes.doubleClass = findGlobalClass(env, "java/lang/Double");
+    classes.doubleConstructor = checkResolved(
+        env,
+        env->GetMethodID(classes.doubleClass, "<init>", "(D)V"),
+        "Double.<init>");
+    classes.doubleValue = checkResolved(
+        env,
+        env->GetMethodID(classes.doubleClass, "doubleValue", "()D"),
+        "Double.doubleValue");
+    classes.booleanClass = findGlobalClass(env, "java/lang/Boolean");
+    classes.booleanConstructor = checkResolved(
+        env,
+        env->GetMethodID(classes.booleanClass, "<init>", "(Z)V"),
+        "Boolean.<init>");
+    classes.booleanValue = checkResolved(
+        env,
+        env->GetMethodID(classes.booleanClass, "booleanValue", "()Z"),
+        "Boolean.booleanValue");
+    classes.promiseImplClass =
+        findGlobalClass(env, "com/facebook/react/bridge/PromiseImpl");
+    classes.promiseImplConstructor = checkResolved(
+        env,
+        env->GetMethodID(
+            classes.promiseImplClass,
+            "<init>",
+            "(Lcom/facebook/react/bridge/Callback;Lcom/facebook/react/bridge/Callback;)V"),
+        "PromiseImpl.<init>");
+    classes.argumentsClass =
+        findGlobalClass(env, "com/facebook/react/bridge/Arguments");
+    classes.makeNativeMap = checkResolved(
+        env,
+        env->GetStaticMethodID(
+            classes.argumentsClass,
+            "makeNativeMap",
+            "(Ljava/util/Map;)Lcom/facebook/react/bridge/WritableNativeMap;"),
+        "Arguments.makeNativeMap");
+    classes.byteBufferClass = findGlobalClass(env, "java/nio/ByteBuffer");
+    classes.allocateDirect = checkResolved(
+        env,
+        env->GetStaticMethodID(
+            classes.byteBufferClass,
+            "allocateDirect",
+            "(I)Ljava/nio/ByteBuffer;"),
+        "ByteBuffer.allocateDirect");
+  } catch (const std::runtime_error &) {
+    for (jclass cls : {classes.doubleClass,
+                       classes.booleanClass,
+                       classes.promiseImplClass,
+                       classes.argumentsClass,
+                       classes.byteBufferClass}) {
+      if (cls != nullptr) {
+        env->DeleteGlobalRef(cls);
+      }
+    }
+    throw;
+  }
+  return classes;
+}
+
+const JavaTurboModuleClasses &JavaTurboModuleClasses::get(JNIEnv *env) {
+  // The global references are intentionally never released.  If resolve()
+  // throws, the next call tries again.
+  static const JavaTurboModuleClasses classes = resolve(env);
+  return classes;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <jni.h>
+
+namespace facebook {
+namespace react {
+
+/**
+ * A JavaTurboModule method, with its jmethodID and parsed signature.
+ */
+struct JavaTurboModuleMethod {
+  jmethodID methodID;
+  std::string signature;
+  std::vector<std::string> argTypes;
+  std::string returnType;
+  // Number of arguments which are passed as Java objects.
+  unsigned int objectArgCount;
+  // False if the method only takes and returns primitives, in which case
+  // calling it creates no JNI local references.
+  bool needsLocalFrame;
+};
+
+/**
+ * Resolves the methods of one JavaTurboModule, calling GetMethodID and parsing
+ * the signature only the first time each method is invoked.
+ *
+ * Not thread safe; JavaTurboModule only uses it on the JS thread.
+ */
+class JavaTurboModuleMethodCache {
+ public:
+  /**
+   * @return the method, or nullptr with a pending Java exception if `cls`
+   * has no method with this name and signature.
+   */
+  const JavaTurboModuleMethod *get(
+      JNIEnv *env,
+      jclass cls,
+      const std::string &name,
+      const std::string &signature);
+
+  size_t size() const {
+    return methods_.size();
+  }
+
+ private:
+  std::unordered_map<std::string, JavaTurboModuleMethod> methods_;
+};
+
+/**
+ * Global references to the Java classes JavaTurboModule converts arguments
+ * and results with, and their method ids.
+ */
+struct JavaTurboModuleClasses {
+  jclass doubleClass;
+  jmethodID doubleConstructor;
+  jmethodID doubleValue;
+  jclass booleanClass;
+  jmethodID booleanConstructor;
+  jmethodID booleanValue;
+  jclass promiseImplClass;
+  jmethodID promiseImplConstructor;
+  jclass argumentsClass;
+  jmethodID makeNativeMap;
+  jclass byteBufferClass;
+  jmethodID allocateDirect;
+
+  /**
+   * Throws std::runtime_error, with no Java exception left pending, if a
+   * class or method cannot be found.
+   */
+  static JavaTurboModuleClasses resolve(JNIEnv *env);
+
+  /**
+   * The process-wide instance, resolved on first successful use.
+   */
+  static const JavaTurboModuleClasses &get(JNIEnv *env);
+};
+
+/**
+ * See
+ * https://docs.oracle.com/javase/7/docs/technotes/guides/jni/spec/types.html
+ * for a description of Java method signature structure.
+ */
+std::vector<std::string> getMethodArgTypesFromSignature(
+    const std::string &methodSignature);
+
+} // namespace react
+} // namespace facebook
@@ -43,6 +43,38 @@ static jsi::String convertNSStringToJSIString(jsi::Runtime &runtime, NSString *v
   return jsi::String::createFromUtf8(runtime, [value UTF8String] ?: "");
 }
 
+namespace {
+/**
+ * Keeps an NSMutableData alive while JS refers to its bytes. The data must not
+ * be resized afterwards, since that may move its bytes.
+ */
+class NSMutableDataBuffer : public jsi::MutableBuffer {
+ public:
+  NSMutableDataBuffer(NSMutableData *data) : data_(data) {}
+
+  size_t size() const override
+  {
+    return data_.length;
+  }
+
+  uint8_t *data() override
+  {
+    return static_cast<uint8_t *>(data_.mutableBytes);
+  }
+
+ private:
+  NSMutableData *data_;
+};
+} // namespace
+
+static jsi::ArrayBuffer convertNSDataToJSIArrayBuffer(jsi::Runtime &runtime, NSData *value)
+{
+  // Immutable data may be shared or mapped read-only, so only mutable data is
+  // handed to JS without a copy.
+  NSMutableData *data = [value isKindOfClass:[NSMutableData class]] ? (NSMutableData *)value : [value mutableCopy];
+  return jsi::ArrayBuffer(runtime, std::make_shared<NSMutableDataBuffer>(data));
+}
+
 static jsi::Value convertObjCObjectToJSIValue(jsi::Runtime &runtime, id value);
 static jsi::Object convertNSDictionaryToJSIObject(jsi::Runtime &runtime, NSDictionary *value)
 {
@@ -93,21 +125,26 @@ static jsi::Value convertObjCObjectToJSIValue(jsi::Runtime &runtime, id value)
 static id convertJSIValueToObjCObject(
     jsi::Runtime &runtime,
     const jsi::Value &value,
-    std::shared_ptr<react::CallInvoker> jsInvoker);
+    std::shared_ptr<react::CallInvoker> jsInvoker,
+    react::LongLivedObjectCollection &longLivedObjects);
 static NSString *convertJSIStringToNSString(jsi::Runtime &runtime, const jsi::String &value)
 {
   return [NSString stringWithUTF8String:value.utf8(runtime).c_str()];
 }
 
-static NSArray *
-convertJSIArrayToNSArray(jsi::Runtime &runtime, const jsi::Array &value, std::shared_ptr<react::CallInvoker> jsInvoker)
+static NSArray *convertJSIArrayToNSArray(
+    jsi::Runtime &runtime,
+    const jsi::Array &value,
+    std::shared_ptr<react::CallInvoker> jsInvoker,
+    react::LongLivedObjectCollection &longLivedObjects)
 {
   size_t size = value.size(runtime);
   NSMutableArray *result = [NSMutableArray new];
   for (size_t i = 0; i < size; i++) {
     // Insert kCFNull when it's `undefined` value to preserve the indices.
-    [result
-        addObject:convertJSIValueToObjCObject(runtime, value.getValueAtIndex(runtime, i), jsInvoker) ?: (id)kCFNull];
+    [result addObject:convertJSIValueToObjCObject(
+                          runtime, value.getValueAtIndex(runtime, i), jsInvoker, longLivedObjects)
+                  ?: (id)kCFNull];
   }
   return [result copy];
 }
@@ -115,7 +152,8 @@ convertJSIArrayToNSArray(jsi::Runtime &runtime, const jsi::Array &value, std::sh
 static NSDictionary *convertJSIObjectToNSDictionary(
     jsi::Runtime &runtime,
     const jsi::Object &value,
-    std::shared_ptr<react::CallInvoker> jsInvoker)
+    std::shared_ptr<react::CallInvoker> jsInvoker,
+    react::LongLivedObjectCollection &longLivedObjects)
 {
   jsi::Array propertyNames = value.getPropertyNames(runtime);
   size_t size = propertyNames.size(runtime);
@@ -123,7 +161,7 @@ static NSDictionary *convertJSIObjectToNSDictionary(
   for (size_t i = 0; i < size; i++) {
     jsi::String name = propertyNames.getValueAtIndex(runtime, i).getString(runtime);
     NSString *k = convertJSIStringToNSString(runtime, name);
-    id v = convertJSIValueToObjCObject(runtime, value.getProperty(runtime, name), jsInvoker);
+    id v = convertJSIValueToObjCObject(runtime, value.getProperty(runtime, name), jsInvoker, longLivedObjects);
     if (v) {
       result[k] = v;
     }
@@ -134,11 +172,13 @@ static NSDictionary *convertJSIObjectToNSDictionary(
 static RCTResponseSenderBlock convertJSIFunctionToCallback(
     jsi::Runtime &runtime,
     const jsi::Function &value,
-    std::shared_ptr<react::CallInvoker> jsInvoker);
+    std::shared_ptr<react::CallInvoker> jsInvoker,
+    react::LongLivedObjectCollection &longLivedObjects);
 static id convertJSIValueToObjCObject(
     jsi::Runtime &runtime,
     const jsi::Value &value,
-    std::shared_ptr<react::CallInvoker> jsInvoker)
+    std::shared_ptr<react::CallInvoker> jsInvoker,
+    react::LongLivedObjectCollection &longLivedObjects)
 {
   if (value.isUndefined() || value.isNull()) {
     return nil;
@@ -155,12 +195,17 @@ static id convertJSIValueToObjCObject(
   if (value.isObject()) {
     jsi::Object o = value.getObject(runtime);
     if (o.isArray(runtime)) {
-      return convertJSIArrayToNSArray(runtime, o.getArray(runtime), jsInvoker);
+      return convertJSIArrayToNSArray(runtime, o.getArray(runtime), jsInvoker, longLivedObjects);
+    }
+    if (o.isArrayBuffer(runtime)) {
+      // Copied, since async methods may run after JS released the buffer.
+      jsi::ArrayBuffer arrayBuffer = o.getArrayBuffer(runtime);
+      return [NSData dataWithBytes:arrayBuffer.data(runtime) length:arrayBuffer.size(runtime)];
     }
     if (o.isFunction(runtime)) {
-      return convertJSIFunctionToCallback(runtime, std::move(o.getFunction(runtime)), jsInvoker);
+      return convertJSIFunctionToCallback(runtime, std::move(o.getFunction(runtime)), jsInvoker, longLivedObjects);
     }
-    return convertJSIObjectToNSDictionary(runtime, o, jsInvoker);
+    return convertJSIObjectToNSDictionary(runtime, o, jsInvoker, longLivedObjects);
   }
 
   throw std::runtime_error("Unsupported jsi::jsi::Value kind");
@@ -169,9 +214,11 @@ static id convertJSIValueToObjCObject(
 static RCTResponseSenderBlock convertJSIFunctionToCallback(
     jsi::Runtime &runtime,
     const jsi::Function &value,
-    std::shared_ptr<react::CallInvoker> jsInvoker)
+    std::shared_ptr<react::CallInvoker> jsInvoker,
+    react::LongLivedObjectCollection &longLivedObjects)
 {
-  auto weakWrapper = react::CallbackWrapper::createWeak(value.getFunction(runtime), runtime, jsInvoker);
+  auto weakWrapper =
+      react::CallbackWrapper::createWeak(value.getFunction(runtime), runtime, jsInvoker, longLivedObjects);
   BOOL __block wrapperWasCalled = NO;
   return ^(NSArray *responses) {
     if (wrapperWasCalled) {
@@ -219,7 +266,8 @@ jsi::Value ObjCTurboModule::createPromise(
       runtime,
       jsi::PropNameID::forAscii(runtime, "fn"),
       2,
-      [invokeCopy, jsInvoker](jsi::Runtime &rt, const jsi::Value &thisVal, const jsi::Value *args, size_t count) {
+      [invokeCopy, jsInvoker, longLivedObjects = longLivedObjectCollection_](
+          jsi::Runtime &rt, const jsi::Value &thisVal, const jsi::Value *args, size_t count) {
         if (count != 2) {
           throw std::invalid_argument(
               "Promise must pass constructor function two args. Passed " + std::to_string(count) + " args.");
@@ -228,10 +276,10 @@ jsi::Value ObjCTurboModule::createPromise(
           return jsi::Value::undefined();
         }
 
-        auto weakResolveWrapper =
-            react::CallbackWrapper::createWeak(args[0].getObject(rt).getFunction(rt), rt, jsInvoker);
-        auto weakRejectWrapper =
-            react::CallbackWrapper::createWeak(args[1].getObject(rt).getFunction(rt), rt, jsInvoker);
+        auto weakResolveWrapper = react::CallbackWrapper::createWeak(
+            args[0].getObject(rt).getFunction(rt), rt, jsInvoker, *longLivedObjects);
+        auto weakRejectWrapper = react::CallbackWrapper::createWeak(
+            args[1].getObject(rt).getFunction(rt), rt, jsInvoker, *longLivedObjects);
 
         __block BOOL resolveWasCalled = NO;
         __block BOOL rejectWasCalled = NO;
@@ -401,6 +449,10 @@ jsi::Value ObjCTurboModule::performMethodInvocation(
       returnValue = convertNSArrayToJSIArray(*rt, (NSArray *)result);
       break;
     }
+    case ArrayBufferKind: {
+      returnValue = convertNSDataToJSIArrayBuffer(*rt, (NSData *)result);
+      break;
+    }
     case FunctionKind:
       throw std::runtime_error("convertInvocationResultToJSIValue: FunctionKind is not supported yet.");
     case PromiseKind:
@@ -540,7 +592,7 @@ NSInvocation *ObjCTurboModule::getMethodInvocation(
     /**
      * Convert arg to ObjC objects.
      */
-    id objCArg = convertJSIValueToObjCObject(runtime, *arg, jsInvoker_);
+    id objCArg = convertJSIValueToObjCObject(runtime, *arg, jsInvoker_, *longLivedObjectCollection_);
 
     if (objCArg) {
       NSString *methodNameNSString = @(methodName);
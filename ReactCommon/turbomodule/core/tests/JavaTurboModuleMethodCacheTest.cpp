@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include <ReactCommon/JavaTurboModuleMethodCache.h>
+
+using namespace facebook::react;
+
+namespace {
+
+// A JNIEnv which only implements the calls the cache makes, and counts them.
+// Method ids and references are fake pointers, never dereferenced.
+struct FakeJNI {
+  int findClassCount{0};
+  int getMethodIDCount{0};
+  int getStaticMethodIDCount{0};
+  int newGlobalRefCount{0};
+  int deleteLocalRefCount{0};
+  int deleteGlobalRefCount{0};
+  bool hasMethod{true};
+  // FindClass fails, with a pending exception, for this class.
+  std::string missingClass;
+  bool exceptionPending{false};
+
+  JNINativeInterface functions{};
+  JNIEnv env{};
+
+  FakeJNI() {
+    functions.FindClass = [](JNIEnv *env, const char *name) -> jclass {
+      auto &fake = self(env);
+      fake.findClassCount++;
+      if (fake.missingClass == name) {
+        fake.exceptionPending = true;
+        return nullptr;
+      }
+      return reinterpret_cast<jclass>(0x1);
+    };
+    functions.GetMethodID =
+        [](JNIEnv *env, jclass, const char *, const char *) -> jmethodID {
+      auto &fake = self(env);
+      fake.getMethodIDCount++;
+      return fake.hasMethod ? reinterpret_cast<jmethodID>(0x2) : nullptr;
+    };
+    functions.GetStaticMethodID =
+        [](JNIEnv *env, jclass, const char *, const char *) -> jmethodID {
+      self(env).getStaticMethodIDCount++;
+      return reinterpret_cast<jmethodID>(0x3);
+    };
+    functions.NewGlobalRef = [](JNIEnv *env, jobject) -> jobject {
+      self(env).newGlobalRefCount++;
+      return reinterpret_cast<jobject>(0x4);
+    };
+    functions.DeleteLocalRef = [](JNIEnv *env, jobject) {
+      self(env).deleteLocalRefCount++;
+    };
+    functions.DeleteGlobalRef = [](JNIEnv *env, jobject) {
+      self(env).deleteGlobalRefCount++;
+    };
+    functions.ExceptionCheck = [](JNIEnv *env) -> jboolean {
+      return self(env).exceptionPending ? JNI_TRUE : JNI_FALSE;
+    };
+    functions.ExceptionClear = [](JNIEnv *env) {
+      self(env).exceptionPending = false;
+    };
+    env.functions = &functions;
+  }
+
+  static FakeJNI &self(JNIEnv *env) {
+    return *reinterpret_cast<FakeJNI *>(
+        reinterpret_cast<char *>(env) - offsetof(FakeJNI, env));
+  }
+};
+
+jclass moduleClass() {
+  return reinterpret_cast<jclass>(0x10);
+}
+
+} // namespace
+
+TEST(JavaTurboModuleMethodCacheTest, resolvesEachMethodOnce) {
+  FakeJNI jni;
+  JavaTurboModuleMethodCache cache;
+
+  auto method = cache.get(
+      &jni.env,
+      moduleClass(),
+      "getString",
+      "(Ljava/lang/String;)Ljava/lang/String;");
+  ASSERT_NE(method, nullptr);
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(
+        cache.get(
+            &jni.env,
+            moduleClass(),
+            "getString",
+            "(Ljava/lang/String;)Ljava/lang/String;"),
+        method);
+  }
+  EXPECT_EQ(jni.getMethodIDCount, 1);
+
+  cache.get(&jni.env, moduleClass(), "getNumber", "(D)D");
+  cache.get(&jni.env, moduleClass(), "getNumber", "(D)D");
+  EXPECT_EQ(jni.getMethodIDCount, 2);
+  EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(JavaTurboModuleMethodCacheTest, parsesSignatureOnce) {
+  FakeJNI jni;
+  JavaTurboModuleMethodCache cache;
+
+  auto method = cache.get(
+      &jni.env,
+      moduleClass(),
+      "getValue",
+      "(DLjava/lang/String;Lcom/facebook/react/bridge/ReadableMap;Z)V");
+  ASSERT_NE(method, nullptr);
+  ASSERT_EQ(method->argTypes.size(), 4);
+  EXPECT_EQ(method->argTypes[0], "D");
+  EXPECT_EQ(method->argTypes[1], "Ljava/lang/String;");
+  EXPECT_EQ(method->argTypes[3], "Z");
+  EXPECT_EQ(method->returnType, "V");
+  EXPECT_EQ(method->objectArgCount, 2);
+  EXPECT_TRUE(method->needsLocalFrame);
+
+  auto primitive = cache.get(&jni.env, moduleClass(), "add", "(DD)D");
+  ASSERT_NE(primitive, nullptr);
+  EXPECT_EQ(primitive->objectArgCount, 0);
+  EXPECT_FALSE(primitive->needsLocalFrame);
+
+  auto boxedResult =
+      cache.get(&jni.env, moduleClass(), "maybe", "(Z)Ljava/lang/Boolean;");
+  ASSERT_NE(boxedResult, nullptr);
+  EXPECT_TRUE(boxedResult->needsLocalFrame);
+}
+
+TEST(JavaTurboModuleMethodCacheTest, missingMethodIsNotCached) {
+  FakeJNI jni;
+  JavaTurboModuleMethodCache cache;
+
+  jni.hasMethod = false;
+  EXPECT_EQ(cache.get(&jni.env, moduleClass(), "missing", "()V"), nullptr);
+  EXPECT_EQ(cache.get(&jni.env, moduleClass(), "missing", "()V"), nullptr);
+  EXPECT_EQ(jni.getMethodIDCount, 2);
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(JavaTurboModuleMethodCacheTest, changedSignatureIsResolvedAgain) {
+  FakeJNI jni;
+  JavaTurboModuleMethodCache cache;
+
+  cache.get(&jni.env, moduleClass(), "method", "(D)V");
+  auto method = cache.get(&jni.env, moduleClass(), "method", "(Z)V");
+  ASSERT_NE(method, nullptr);
+  EXPECT_EQ(method->argTypes[0], "Z");
+  EXPECT_EQ(jni.getMethodIDCount, 2);
+}
+
+TEST(JavaTurboModuleMethodCacheTest, resolvesClassesAsGlobalRefs) {
+  FakeJNI jni;
+
+  auto classes = JavaTurboModuleClasses::resolve(&jni.env);
+  EXPECT_EQ(jni.findClassCount, 5);
+  EXPECT_EQ(jni.newGlobalRefCount, 5);
+  EXPECT_EQ(jni.deleteLocalRefCount, 5);
+  EXPECT_EQ(jni.getMethodIDCount, 5);
+  EXPECT_EQ(jni.getStaticMethodIDCount, 2);
+  EXPECT_NE(classes.doubleConstructor, nullptr);
+
+  // The shared instance is resolved on first use only.
+  JavaTurboModuleClasses::get(&jni.env);
+  JavaTurboModuleClasses::get(&jni.env);
+  EXPECT_EQ(jni.findClassCount, 10);
+}
+
+TEST(JavaTurboModuleMethodCacheTest, failedClassLookupIsNotCached) {
+  FakeJNI jni;
+  jni.missingClass = "com/facebook/react/bridge/PromiseImpl";
+
+  EXPECT_THROW(JavaTurboModuleClasses::resolve(&jni.env), std::runtime_error);
+  EXPECT_FALSE(jni.exceptionPending);
+  // Double and Boolean were resolved before the failure and are released.
+  EXPECT_EQ(jni.newGlobalRefCount, 2);
+  EXPECT_EQ(jni.deleteGlobalRefCount, 2);
+  EXPECT_EQ(jni.findClassCount, 3);
+
+  // Nothing about the failure is remembered.
+  jni.missingClass.clear();
+  auto classes = JavaTurboModuleClasses::resolve(&jni.env);
+  EXPECT_NE(classes.promiseImplConstructor, nullptr);
+  EXPECT_EQ(jni.findClassCount, 8);
+}
+
+TEST(JavaTurboModuleMethodCacheTest, failedMethodLookupThrows) {
+  FakeJNI jni;
+  jni.hasMethod = false;
+
+  EXPECT_THROW(JavaTurboModuleClasses::resolve(&jni.env), std::runtime_error);
+  EXPECT_EQ(jni.getMethodIDCount, 1);
+  EXPECT_EQ(jni.deleteGlobalRefCount, 1);
+}
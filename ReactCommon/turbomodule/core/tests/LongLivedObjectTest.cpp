@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <ReactCommon/LongLivedObject.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class TestObject : public LongLivedObject {
+ public:
+  explicit TestObject(int &destroyed) : destroyed_(destroyed) {}
+
+  ~TestObject() {
+    destroyed_++;
+  }
+
+ private:
+  int &destroyed_;
+};
+
+} // namespace
+
+TEST(LongLivedObjectTest, collectionKeepsObjectsAlive) {
+  auto collection = std::make_shared<LongLivedObjectCollection>();
+  int destroyed = 0;
+  std::weak_ptr<TestObject> weak;
+  {
+    auto object = std::make_shared<TestObject>(destroyed);
+    weak = object;
+    collection->add(object);
+  }
+  EXPECT_EQ(destroyed, 0);
+  EXPECT_EQ(collection->getStats().live, 1);
+
+  weak.lock()->allowRelease();
+  EXPECT_EQ(destroyed, 1);
+  EXPECT_TRUE(weak.expired());
+
+  auto stats = collection->getStats();
+  EXPECT_EQ(stats.live, 0);
+  EXPECT_EQ(stats.added, 1);
+  EXPECT_EQ(stats.released, 1);
+}
+
+TEST(LongLivedObjectTest, removeUnlinksFromAnyPosition) {
+  auto collection = std::make_shared<LongLivedObjectCollection>();
+  int destroyed = 0;
+  std::vector<std::weak_ptr<TestObject>> objects;
+  for (int i = 0; i < 64; i++) {
+    auto object = std::make_shared<TestObject>(destroyed);
+    objects.push_back(object);
+    collection->add(object);
+  }
+
+  // Every other object, then the rest in reverse.
+  for (size_t i = 0; i < objects.size(); i += 2) {
+    objects[i].lock()->allowRelease();
+  }
+  EXPECT_EQ(destroyed, 32);
+  for (size_t i = objects.size() - 1; i < objects.size(); i -= 2) {
+    objects[i].lock()->allowRelease();
+  }
+  EXPECT_EQ(destroyed, 64);
+  EXPECT_EQ(collection->getStats().live, 0);
+}
+
+TEST(LongLivedObjectTest, releasingTwiceOrAfterClearIsNoop) {
+  auto collection = std::make_shared<LongLivedObjectCollection>();
+  int destroyed = 0;
+  auto object = std::make_shared<TestObject>(destroyed);
+  collection->add(object);
+  collection->add(object);
+  EXPECT_EQ(collection->getStats().added, 1);
+
+  object->allowRelease();
+  object->allowRelease();
+  EXPECT_EQ(collection->getStats().released, 1);
+
+  auto other = std::make_shared<TestObject>(destroyed);
+  collection->add(other);
+  collection->clear();
+  other->allowRelease();
+  collection.reset();
+  other->allowRelease();
+  EXPECT_EQ(destroyed, 0);
+}
+
+TEST(LongLivedObjectTest, clearReleasesEverything) {
+  auto collection = std::make_shared<LongLivedObjectCollection>();
+  int destroyed = 0;
+  for (int i = 0; i < 100; i++) {
+    collection->add(std::make_shared<TestObject>(destroyed));
+  }
+  EXPECT_EQ(collection->getStats().live, 100);
+
+  collection->clear();
+  EXPECT_EQ(destroyed, 100);
+  EXPECT_EQ(collection->getStats().live, 0);
+  EXPECT_EQ(collection->getStats().released, 100);
+}
+
+TEST(LongLivedObjectTest, concurrentAddAndRelease) {
+  constexpr int kThreads = 4;
+  constexpr int kObjectsPerThread = 10000;
+
+  auto collection = std::make_shared<LongLivedObjectCollection>();
+  std::vector<int> destroyed(kThreads, 0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < kObjectsPerThread; i++) {
+        auto object = std::make_shared<TestObject>(destroyed[t]);
+        collection->add(object);
+        object->allowRelease();
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (int count : destroyed) {
+    EXPECT_EQ(count, kObjectsPerThread);
+  }
+  auto stats = collection->getStats();
+  EXPECT_EQ(stats.live, 0);
+  EXPECT_EQ(stats.added, kThreads * kObjectsPerThread);
+}
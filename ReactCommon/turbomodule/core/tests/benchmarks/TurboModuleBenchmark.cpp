@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <ReactCommon/TurboCxxModule.h>
+#include <ReactCommon/TurboModule.h>
+#include <ReactCommon/TurboModuleMethodTable.h>
+#include <cxxreact/CxxModule.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Measures the overhead of looking up and calling TurboModule methods from
+// JS, the way call sites like `NativeModule.method(...)` do on every call.
+// The runtime is supplied by the embedder through runtimeGenerators().
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+class BenchmarkTurboModule : public TurboModule {
+ public:
+  BenchmarkTurboModule() : TurboModule("BenchmarkTurboModule", nullptr) {
+    methodMap_["noop"] = MethodMetadata{0, noop};
+    methodMap_["add"] = MethodMetadata{2, add};
+    methodMap_["echo"] = MethodMetadata{1, echo};
+  }
+
+ private:
+  static jsi::Value noop(
+      jsi::Runtime &rt,
+      TurboModule &turboModule,
+      const jsi::Value *args,
+      size_t count) {
+    return jsi::Value::undefined();
+  }
+
+  static jsi::Value add(
+      jsi::Runtime &rt,
+      TurboModule &turboModule,
+      const jsi::Value *args,
+      size_t count) {
+    return jsi::Value(args[0].getNumber() + args[1].getNumber());
+  }
+
+  static jsi::Value echo(
+      jsi::Runtime &rt,
+      TurboModule &turboModule,
+      const jsi::Value *args,
+      size_t count) {
+    return jsi::Value(rt, args[0]);
+  }
+};
+
+class BenchmarkTypedTurboModule : public TurboModule {
+ public:
+  BenchmarkTypedTurboModule();
+
+  void noop(jsi::Runtime &rt) {}
+
+  double add(jsi::Runtime &rt, double a, double b) {
+    return a + b;
+  }
+
+  std::string echo(jsi::Runtime &rt, const std::string &value) {
+    return value;
+  }
+};
+
+constexpr TurboModuleMethod kBenchmarkMethods[] = {
+    TURBOMODULE_METHOD(BenchmarkTypedTurboModule, add),
+    TURBOMODULE_METHOD(BenchmarkTypedTurboModule, echo),
+    TURBOMODULE_METHOD(BenchmarkTypedTurboModule, noop),
+};
+static_assert(isSortedMethodTable(kBenchmarkMethods), "Sort by name");
+
+BenchmarkTypedTurboModule::BenchmarkTypedTurboModule()
+    : TurboModule("BenchmarkTypedTurboModule", nullptr) {
+  setMethodTable(kBenchmarkMethods);
+}
+
+class BenchmarkCxxModule : public xplat::module::CxxModule {
+ public:
+  std::string getName() override {
+    return "BenchmarkCxxModule";
+  }
+
+  std::map<std::string, folly::dynamic> getConstants() override {
+    return {};
+  }
+
+  std::vector<Method> getMethods() override {
+    return {
+        Method(
+            "noop",
+            [](folly::dynamic) -> folly::dynamic { return nullptr; },
+            SyncTag),
+        Method(
+            "add",
+            [](folly::dynamic args) -> folly::dynamic {
+              return args[0].asDouble() + args[1].asDouble();
+            },
+            SyncTag),
+        Method(
+            "echo",
+            [](folly::dynamic args) -> folly::dynamic { return args[0]; },
+            SyncTag),
+    };
+  }
+};
+
+std::unique_ptr<jsi::Runtime> makeRuntime() {
+  return jsi::runtimeGenerators().front()();
+}
+
+enum class ModuleKind {
+  MethodMap,
+  MethodTable,
+  CxxModule,
+};
+
+jsi::Object makeModule(jsi::Runtime &runtime, ModuleKind kind) {
+  std::shared_ptr<TurboModule> module;
+  switch (kind) {
+    case ModuleKind::MethodMap:
+      module = std::make_shared<BenchmarkTurboModule>();
+      break;
+    case ModuleKind::MethodTable:
+      module = std::make_shared<BenchmarkTypedTurboModule>();
+      break;
+    case ModuleKind::CxxModule:
+      module = std::make_shared<TurboCxxModule>(
+          std::make_unique<BenchmarkCxxModule>(), nullptr);
+      break;
+  }
+  return jsi::Object::createFromHostObject(runtime, module);
+}
+
+void methodLookup(benchmark::State &state, ModuleKind kind) {
+  auto runtime = makeRuntime();
+  {
+    auto module = makeModule(*runtime, kind);
+    auto name = jsi::PropNameID::forAscii(*runtime, "add");
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(module.getProperty(*runtime, name));
+    }
+  }
+}
+BENCHMARK_CAPTURE(methodLookup, MethodMap, ModuleKind::MethodMap);
+BENCHMARK_CAPTURE(methodLookup, MethodTable, ModuleKind::MethodTable);
+BENCHMARK_CAPTURE(methodLookup, TurboCxxModule, ModuleKind::CxxModule);
+
+// Runs `calls` in a JS loop so that lookup and call happen on the JS side,
+// as they would in app code.
+void callFromJS(benchmark::State &state, ModuleKind kind, const char *calls) {
+  auto runtime = makeRuntime();
+  {
+    auto module = makeModule(*runtime, kind);
+    auto loop = runtime
+                    ->evaluateJavaScript(
+                        std::make_shared<jsi::StringBuffer>(
+                            std::string("(function(m, n) {"
+                                        "  var r;"
+                                        "  for (var i = 0; i < n; i++) {") +
+                            calls +
+                            "  }"
+                            "  return r;"
+                            "})"),
+                        "")
+                    .getObject(*runtime)
+                    .getFunction(*runtime);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          loop.call(*runtime, module, (double)state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+}
+BENCHMARK_CAPTURE(
+    callFromJS,
+    MethodMap_noop,
+    ModuleKind::MethodMap,
+    "r = m.noop();")
+    ->Arg(1000);
+BENCHMARK_CAPTURE(
+    callFromJS,
+    MethodTable_noop,
+    ModuleKind::MethodTable,
+    "r = m.noop();")
+    ->Arg(1000);
+BENCHMARK_CAPTURE(
+    callFromJS,
+    TurboCxxModule_noop,
+    ModuleKind::CxxModule,
+    "r = m.noop();")
+    ->Arg(1000);
+BENCHMARK_CAPTURE(
+    callFromJS,
+    MethodMap_add,
+    ModuleKind::MethodMap,
+    "r = m.add(i, 1);")
+    ->Arg(1000);
+BENCHMARK_CAPTURE(
+    callFromJS,
+    MethodTable_add,
+    ModuleKind::MethodTable,
+    "r = m.add(i, 1);")
+    ->Arg(1000);
+BENCHMARK_CAPTURE(
+    callFromJS,
+    TurboCxxModule_add,
+    ModuleKind::CxxModule,
+    "r = m.add(i, 1);")
+    ->Arg(1000);
+BENCHMARK_CAPTURE(
+    callFromJS,
+    MethodMap_echo,
+    ModuleKind::MethodMap,
+    "r = m.echo('x');")
+    ->Arg(1000);
+BENCHMARK_CAPTURE(
+    callFromJS,
+    MethodTable_echo,
+    ModuleKind::MethodTable,
+    "r = m.echo('x');")
+    ->Arg(1000);
+BENCHMARK_CAPTURE(
+    callFromJS,
+    TurboCxxModule_echo,
+    ModuleKind::CxxModule,
+    "r = m.echo('x');")
+    ->Arg(1000);
+
+} // namespace
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <ReactCommon/LongLivedObject.h>
+#include <ReactCommon/TurboModule.h>
+#include <ReactCommon/TurboModuleBinding.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+
+using namespace facebook;
+using namespace facebook::react;
+
+namespace {
+
+class TurboModuleBindingTest : public jsi::JSITestBase {};
+
+class TestObject : public LongLivedObject {
+ public:
+  explicit TestObject(int &destroyed) : destroyed_(destroyed) {}
+
+  ~TestObject() {
+    destroyed_++;
+  }
+
+ private:
+  int &destroyed_;
+};
+
+} // namespace
+
+TEST_P(TurboModuleBindingTest, bindingOwnsTheLongLivedObjectsOfItsRuntime) {
+  std::unordered_map<std::string, std::shared_ptr<TurboModule>> modules;
+  int destroyed = 0;
+  {
+    auto runtime = factory();
+    TurboModuleBinding::install(
+        *runtime, [&modules](const std::string &name) {
+          auto module = std::make_shared<TurboModule>(name, nullptr);
+          modules[name] = module;
+          return module;
+        });
+
+    auto proxy =
+        runtime->global().getPropertyAsFunction(*runtime, "__turboModuleProxy");
+    proxy.call(*runtime, "First");
+    proxy.call(*runtime, "Second");
+
+    auto collection = modules["First"]->longLivedObjectCollection_;
+    ASSERT_NE(collection, nullptr);
+    EXPECT_EQ(modules["Second"]->longLivedObjectCollection_, collection);
+
+    collection->add(std::make_shared<TestObject>(destroyed));
+    EXPECT_EQ(destroyed, 0);
+  }
+
+  // Destroying the runtime destroys the binding, which releases the objects
+  // even though the modules outlive it.
+  EXPECT_EQ(destroyed, 1);
+  EXPECT_EQ(modules["First"]->longLivedObjectCollection_->getStats().live, 0);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    TurboModuleBindingTest,
+    ::testing::ValuesIn(jsi::runtimeGenerators()));
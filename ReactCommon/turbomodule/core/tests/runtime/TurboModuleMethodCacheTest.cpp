@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <ReactCommon/TurboModule.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+
+using namespace facebook;
+using namespace facebook::react;
+
+namespace {
+
+class TurboModuleMethodCacheTest : public jsi::JSITestBase {};
+
+class EchoModule : public TurboModule {
+ public:
+  EchoModule() : TurboModule("EchoModule", nullptr) {
+    methodMap_["echo"] = MethodMetadata{1, echo};
+  }
+
+ private:
+  static jsi::Value echo(
+      jsi::Runtime &rt,
+      TurboModule &turboModule,
+      const jsi::Value *args,
+      size_t count) {
+    return jsi::Value(rt, args[0]);
+  }
+};
+
+jsi::Object getMethod(jsi::Runtime &rt, TurboModule &module) {
+  return module.get(rt, jsi::PropNameID::forAscii(rt, "echo")).getObject(rt);
+}
+
+} // namespace
+
+TEST_P(TurboModuleMethodCacheTest, methodsAreCachedByName) {
+  EchoModule module;
+  auto first = getMethod(rt, module);
+  auto second = getMethod(rt, module);
+  EXPECT_TRUE(jsi::Object::strictEquals(rt, first, second));
+  EXPECT_EQ(first.getFunction(rt).call(rt, 7).getNumber(), 7);
+
+  EXPECT_TRUE(
+      module.get(rt, jsi::PropNameID::forAscii(rt, "missing")).isUndefined());
+  module.releaseMethodCache(rt);
+}
+
+TEST_P(TurboModuleMethodCacheTest, cacheFollowsTheRuntime) {
+  EchoModule module;
+  auto first = getMethod(rt, module);
+
+  auto other = factory();
+  {
+    auto echo = getMethod(*other, module).getFunction(*other);
+    EXPECT_EQ(echo.call(*other, 3).getNumber(), 3);
+  }
+
+  // Switching back to rt dropped the methods cached for the other runtime,
+  // so the other runtime can go away, and rt gets a new function.
+  auto second = getMethod(rt, module);
+  other.reset();
+  EXPECT_FALSE(jsi::Object::strictEquals(rt, first, second));
+  EXPECT_TRUE(jsi::Object::strictEquals(rt, second, getMethod(rt, module)));
+  module.releaseMethodCache(rt);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    TurboModuleMethodCacheTest,
+    ::testing::ValuesIn(jsi::runtimeGenerators()));
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <ReactCommon/TurboModuleMethodTable.h>
+#include <jsi/jsi.h>
+#include <jsi/test/testlib.h>
+
+using namespace facebook;
+using namespace facebook::react;
+
+namespace {
+
+class TurboModuleMethodTableTest : public jsi::JSITestBase {};
+
+class VectorBuffer : public jsi::MutableBuffer {
+ public:
+  explicit VectorBuffer(std::vector<uint8_t> bytes)
+      : bytes_(std::move(bytes)) {}
+
+  size_t size() const override {
+    return bytes_.size();
+  }
+
+  uint8_t *data() override {
+    return bytes_.data();
+  }
+
+ private:
+  std::vector<uint8_t> bytes_;
+};
+
+class BufferModule : public TurboModule {
+ public:
+  BufferModule() : TurboModule("BufferModule", nullptr) {}
+
+  // Returns a copy of the bytes of buffer, starting at offset.
+  std::shared_ptr<VectorBuffer>
+  slice(jsi::Runtime &rt, jsi::ArrayBuffer buffer, int offset) {
+    auto data = buffer.data(rt);
+    return std::make_shared<VectorBuffer>(
+        std::vector<uint8_t>(data + offset, data + buffer.size(rt)));
+  }
+
+  std::shared_ptr<VectorBuffer> nothing(jsi::Runtime &) {
+    return nullptr;
+  }
+};
+
+jsi::ArrayBuffer makeArrayBuffer(
+    jsi::Runtime &rt,
+    std::vector<uint8_t> bytes) {
+  return jsi::ArrayBuffer(rt, std::make_shared<VectorBuffer>(std::move(bytes)));
+}
+
+} // namespace
+
+TEST_P(TurboModuleMethodTableTest, arrayBufferArgument) {
+  jsi::Value value(rt, makeArrayBuffer(rt, {1, 2, 3}));
+
+  auto arrayBuffer =
+      TurboModuleArgument<jsi::ArrayBuffer>::convert(rt, value);
+  ASSERT_EQ(arrayBuffer.size(rt), 3);
+  EXPECT_EQ(arrayBuffer.data(rt)[2], 3);
+}
+
+TEST_P(TurboModuleMethodTableTest, arrayBufferArgumentRejectsOtherValues) {
+  jsi::Value object(rt, jsi::Object(rt));
+  EXPECT_THROW(
+      TurboModuleArgument<jsi::ArrayBuffer>::convert(rt, object),
+      jsi::JSIException);
+  EXPECT_THROW(
+      TurboModuleArgument<jsi::ArrayBuffer>::convert(rt, jsi::Value(1)),
+      jsi::JSIException);
+  EXPECT_THROW(
+      TurboModuleArgument<jsi::ArrayBuffer>::convert(
+          rt, jsi::Value::undefined()),
+      jsi::JSIException);
+}
+
+TEST_P(TurboModuleMethodTableTest, mutableBufferResult) {
+  auto buffer = std::make_shared<VectorBuffer>(std::vector<uint8_t>{4, 5});
+  std::weak_ptr<VectorBuffer> weakBuffer = buffer;
+
+  auto value =
+      TurboModuleResult<std::shared_ptr<VectorBuffer>>::convert(
+          rt, std::move(buffer));
+  ASSERT_TRUE(value.isObject());
+  auto object = value.getObject(rt);
+  ASSERT_TRUE(object.isArrayBuffer(rt));
+  auto arrayBuffer = object.getArrayBuffer(rt);
+  ASSERT_EQ(arrayBuffer.size(rt), 2);
+  EXPECT_EQ(arrayBuffer.data(rt)[1], 5);
+
+  // Unless the runtime copied the bytes, the ArrayBuffer now owns the buffer.
+  if (!weakBuffer.expired()) {
+    EXPECT_EQ(arrayBuffer.data(rt), weakBuffer.lock()->data());
+  }
+}
+
+TEST_P(TurboModuleMethodTableTest, nullMutableBufferResult) {
+  auto value = TurboModuleResult<std::shared_ptr<VectorBuffer>>::convert(
+      rt, std::shared_ptr<VectorBuffer>());
+  EXPECT_TRUE(value.isNull());
+}
+
+TEST_P(TurboModuleMethodTableTest, invokeMethodWithArrayBuffers) {
+  BufferModule module;
+  jsi::Value args[] = {
+      jsi::Value(rt, makeArrayBuffer(rt, {1, 2, 3, 4})), jsi::Value(1)};
+
+  auto result = TurboModuleMethodInvoker<
+      decltype(&BufferModule::slice),
+      &BufferModule::slice>::invoke(rt, module, args, 2);
+  auto arrayBuffer = result.getObject(rt).getArrayBuffer(rt);
+  ASSERT_EQ(arrayBuffer.size(rt), 3);
+  EXPECT_EQ(arrayBuffer.data(rt)[0], 2);
+  EXPECT_EQ(arrayBuffer.data(rt)[2], 4);
+
+  auto nothing = TurboModuleMethodInvoker<
+      decltype(&BufferModule::nothing),
+      &BufferModule::nothing>::invoke(rt, module, nullptr, 0);
+  EXPECT_TRUE(nothing.isNull());
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    TurboModuleMethodTableTest,
+    ::testing::ValuesIn(jsi::runtimeGenerators()));
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#import "SampleTypedTurboCxxModule.h"
+
+#import <ReactCommon/TurboModuleMethodTable.h>
+#import <ReactCommon/TurboModuleUtils.h>
+
+using namespace facebook;
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+constexpr TurboModuleMethod kMethods[] = {
+    TURBOMODULE_METHOD(SampleTypedTurboCxxModule, getArray),
+    TURBOMODULE_METHOD(SampleTypedTurboCxxModule, getBool),
+    TURBOMODULE_METHOD(SampleTypedTurboCxxModule, getConstants),
+    TURBOMODULE_METHOD(SampleTypedTurboCxxModule, getNumber),
+    TURBOMODULE_METHOD(SampleTypedTurboCxxModule, getObject),
+    TURBOMODULE_METHOD(SampleTypedTurboCxxModule, getString),
+    TURBOMODULE_METHOD(SampleTypedTurboCxxModule, getValue),
+    TURBOMODULE_METHOD(SampleTypedTurboCxxModule, getValueWithCallback),
+    TURBOMODULE_METHOD(SampleTypedTurboCxxModule, getValueWithPromise),
+    TURBOMODULE_METHOD(SampleTypedTurboCxxModule, voidFunc),
+};
+
+static_assert(
+    isSortedMethodTable(kMethods),
+    "SampleTypedTurboCxxModule methods must be sorted by name");
+
+} // namespace
+
+SampleTypedTurboCxxModule::SampleTypedTurboCxxModule(
+    std::shared_ptr<CallInvoker> jsInvoker)
+    : TurboModule("SampleTurboCxxModule", jsInvoker) {
+  setMethodTable(kMethods);
+}
+
+void SampleTypedTurboCxxModule::voidFunc(jsi::Runtime &rt) {
+  // Nothing to do
+}
+
+bool SampleTypedTurboCxxModule::getBool(jsi::Runtime &rt, bool arg) {
+  return arg;
+}
+
+double SampleTypedTurboCxxModule::getNumber(jsi::Runtime &rt, double arg) {
+  return arg;
+}
+
+std::string SampleTypedTurboCxxModule::getString(
+    jsi::Runtime &rt,
+    const std::string &arg) {
+  return arg;
+}
+
+jsi::Array SampleTypedTurboCxxModule::getArray(
+    jsi::Runtime &rt,
+    const jsi::Array &arg) {
+  return deepCopyJSIArray(rt, arg);
+}
+
+jsi::Object SampleTypedTurboCxxModule::getObject(
+    jsi::Runtime &rt,
+    const jsi::Object &arg) {
+  return deepCopyJSIObject(rt, arg);
+}
+
+jsi::Object SampleTypedTurboCxxModule::getValue(
+    jsi::Runtime &rt,
+    double x,
+    const std::string &y,
+    const jsi::Object &z) {
+  jsi::Object result(rt);
+  result.setProperty(rt, "x", jsi::Value(x));
+  result.setProperty(rt, "y", jsi::String::createFromUtf8(rt, y));
+  result.setProperty(rt, "z", deepCopyJSIObject(rt, z));
+  return result;
+}
+
+void SampleTypedTurboCxxModule::getValueWithCallback(
+    jsi::Runtime &rt,
+    const jsi::Function &callback) {
+  callback.call(rt, jsi::String::createFromUtf8(rt, "value from callback!"));
+}
+
+jsi::Value SampleTypedTurboCxxModule::getValueWithPromise(
+    jsi::Runtime &rt,
+    bool error) {
+  return createPromiseAsJSIValue(
+      rt, [error](jsi::Runtime &rt2, std::shared_ptr<Promise> promise) {
+        if (error) {
+          promise->reject("intentional promise rejection");
+        } else {
+          promise->resolve(jsi::String::createFromUtf8(rt2, "result!"));
+        }
+      });
+}
+
+jsi::Object SampleTypedTurboCxxModule::getConstants(jsi::Runtime &rt) {
+  jsi::Object result(rt);
+  result.setProperty(rt, "const1", jsi::Value(true));
+  result.setProperty(rt, "const2", jsi::Value(375));
+  result.setProperty(
+      rt, "const3", jsi::String::createFromUtf8(rt, "something"));
+  return result;
+}
+
+} // namespace react
+} // namespace facebook
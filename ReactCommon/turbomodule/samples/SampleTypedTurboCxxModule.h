@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#import <memory>
+#import <string>
+
+#import <ReactCommon/TurboModule.h>
+
+namespace facebook {
+namespace react {
+
+/**
+ * The same module as SampleTurboCxxModule, with its methods declared in a
+ * static method table (see TurboModuleMethodTable.h) instead of a spec class.
+ * Arguments and results are converted from their C++ types directly.
+ */
+class SampleTypedTurboCxxModule : public TurboModule {
+ public:
+  SampleTypedTurboCxxModule(std::shared_ptr<CallInvoker> jsInvoker);
+
+  void voidFunc(jsi::Runtime &rt);
+  bool getBool(jsi::Runtime &rt, bool arg);
+  double getNumber(jsi::Runtime &rt, double arg);
+  std::string getString(jsi::Runtime &rt, const std::string &arg);
+  jsi::Array getArray(jsi::Runtime &rt, const jsi::Array &arg);
+  jsi::Object getObject(jsi::Runtime &rt, const jsi::Object &arg);
+  jsi::Object getValue(
+      jsi::Runtime &rt,
+      double x,
+      const std::string &y,
+      const jsi::Object &z);
+  void getValueWithCallback(jsi::Runtime &rt, const jsi::Function &callback);
+  jsi::Value getValueWithPromise(jsi::Runtime &rt, bool error);
+  jsi::Object getConstants(jsi::Runtime &rt);
+};
+
+} // namespace react
+} // namespace facebook
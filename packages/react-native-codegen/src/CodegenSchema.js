@@ -194,6 +194,7 @@ export type PrimitiveTypeAnnotationType =
   | 'DoubleTypeAnnotation'
   | 'FloatTypeAnnotation'
   | 'BooleanTypeAnnotation'
+  | 'ArrayBufferTypeAnnotation'
   | 'GenericObjectTypeAnnotation';
 
 export type PrimitiveTypeAnnotation = $ReadOnly<{|
@@ -78,6 +78,8 @@ function traverseArg(arg, index): string {
       return wrap('.getNumber()');
     case 'ArrayTypeAnnotation':
       return wrap('.getObject(rt).getArray(rt)');
+    case 'ArrayBufferTypeAnnotation':
+      return wrap('.getObject(rt).getArrayBuffer(rt)');
     case 'FunctionTypeAnnotation':
       return `std::move(${wrap('.getObject(rt).getFunction(rt)')})`;
     case 'GenericObjectTypeAnnotation':
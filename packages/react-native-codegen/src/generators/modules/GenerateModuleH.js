@@ -71,6 +71,8 @@ function translatePrimitiveJSTypeToCpp(
       return 'jsi::Object';
     case 'ArrayTypeAnnotation':
       return 'jsi::Array';
+    case 'ArrayBufferTypeAnnotation':
+      return 'jsi::ArrayBuffer';
     case 'FunctionTypeAnnotation':
       return 'jsi::Function';
     case 'GenericPromiseTypeAnnotation':
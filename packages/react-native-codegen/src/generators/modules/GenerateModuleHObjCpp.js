@@ -111,6 +111,8 @@ function translatePrimitiveJSTypeToObjCType(
       return wrapIntoNullableIfNeeded('NSDictionary *');
     case 'ArrayTypeAnnotation':
       return wrapIntoNullableIfNeeded('NSArray *');
+    case 'ArrayBufferTypeAnnotation':
+      return wrapIntoNullableIfNeeded('NSData *');
     case 'FunctionTypeAnnotation':
       return 'RCTResponseSenderBlock';
     case 'ObjectTypeAnnotation':
@@ -143,6 +145,8 @@ function translatePrimitiveJSTypeToObjCTypeForReturn(
       return wrapIntoNullableIfNeeded('NSDictionary *');
     case 'ArrayTypeAnnotation':
       return wrapIntoNullableIfNeeded('NSArray<id<NSObject>> *');
+    case 'ArrayBufferTypeAnnotation':
+      return wrapIntoNullableIfNeeded('NSData *');
     case 'ObjectTypeAnnotation':
       return wrapIntoNullableIfNeeded('NSDictionary *');
     default:
@@ -91,6 +91,8 @@ function translateReturnTypeToKind(type): string {
       return 'ObjectKind';
     case 'ArrayTypeAnnotation':
       return 'ArrayKind';
+    case 'ArrayBufferTypeAnnotation':
+      return 'ArrayBufferKind';
     default:
       (type: empty);
       throw new Error(`Unknown prop type for returning value, found: ${type}"`);
@@ -264,6 +264,58 @@ const SIMPLE_NATIVE_MODULES: SchemaType = {
   },
 };
 
+const ARRAY_BUFFER_NATIVE_MODULES: SchemaType = {
+  modules: {
+    SampleTurboModule: {
+      nativeModules: {
+        SampleTurboModule: {
+          properties: [
+            {
+              name: 'getBuffer',
+              typeAnnotation: {
+                type: 'FunctionTypeAnnotation',
+                returnTypeAnnotation: {
+                  nullable: false,
+                  type: 'ArrayBufferTypeAnnotation',
+                },
+                params: [],
+                optional: false,
+              },
+            },
+            {
+              name: 'transformBuffer',
+              typeAnnotation: {
+                type: 'FunctionTypeAnnotation',
+                returnTypeAnnotation: {
+                  nullable: true,
+                  type: 'ArrayBufferTypeAnnotation',
+                },
+                params: [
+                  {
+                    nullable: false,
+                    name: 'buffer',
+                    typeAnnotation: {
+                      type: 'ArrayBufferTypeAnnotation',
+                    },
+                  },
+                  {
+                    nullable: false,
+                    name: 'offset',
+                    typeAnnotation: {
+                      type: 'NumberTypeAnnotation',
+                    },
+                  },
+                ],
+                optional: false,
+              },
+            },
+          ],
+        },
+      },
+    },
+  },
+};
+
 const TWO_MODULES_SAME_FILE: SchemaType = {
   modules: {
     NativeSampleTurboModule: {
@@ -465,6 +517,7 @@ const COMPLEX_OBJECTS: SchemaType = {
   },
 };
 module.exports = {
+  ARRAY_BUFFER_NATIVE_MODULES,
   COMPLEX_OBJECTS,
   TWO_MODULES_SAME_FILE,
   TWO_MODULES_DIFFERENT_FILES,
@@ -191,6 +191,30 @@ export interface Spec extends TurboModule {
 export default TurboModuleRegistry.getEnforcing<Spec>('SampleTurboModule');
 `;
 
+const NATIVE_MODULE_WITH_ARRAY_BUFFER = `
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @flow strict-local
+ * @format
+ */
+
+'use strict';
+
+import type {TurboModule} from '../RCTExport';
+import * as TurboModuleRegistry from '../TurboModuleRegistry';
+
+export interface Spec extends TurboModule {
+  +getBuffer: () => ArrayBuffer;
+  +transformBuffer: (buffer: ArrayBuffer, offset: number) => ?ArrayBuffer;
+}
+
+export default TurboModuleRegistry.getEnforcing<Spec>('SampleTurboModule');
+`;
+
 const NATIVE_MODULE_WITH_SIMPLE_OBJECT = `
 /**
  * Copyright (c) Facebook, Inc. and its affiliates.
@@ -435,6 +459,7 @@ module.exports = {
   NATIVE_MODULE_WITH_ARRAY_WITH_UNION_AND_TOUPLE,
   NATIVE_MODULE_WITH_WITH_FLOAT_AND_INT32,
   NATIVE_MODULE_WITH_WITH_ALIASES,
+  NATIVE_MODULE_WITH_ARRAY_BUFFER,
   NATIVE_MODULE_WITH_PROMISE,
   NATIVE_MODULE_WITH_COMPLEX_OBJECTS,
   NATIVE_MODULE_WITH_COMPLEX_OBJECTS_WITH_NULLABLE_KEY,
@@ -272,6 +272,14 @@ function getTypeAnnotationForParam(
           type: 'FloatTypeAnnotation',
         },
       };
+    case 'ArrayBuffer':
+      return {
+        nullable,
+        name: paramName,
+        typeAnnotation: {
+          type: 'ArrayBufferTypeAnnotation',
+        },
+      };
     default:
       return {
         nullable,
@@ -390,6 +398,11 @@ function getReturnTypeAnnotation(
         nullable,
         type: 'FloatTypeAnnotation',
       };
+    case 'ArrayBuffer':
+      return {
+        nullable,
+        type: 'ArrayBufferTypeAnnotation',
+      };
     default:
       return {
         type: 'GenericObjectTypeAnnotation',